@@ -0,0 +1,96 @@
+//===-- llvm/Analysis/CFG.h - Cached control flow graph ----------*- C++ -*--=//
+//
+// This file defines the MethodCFG analysis, which records the predecessors and
+// successors of each basic block in a method.  BasicBlock::pred_begin computes
+// these by walking the use list of the block every time it is called, and
+// succ_begin makes a virtual call for every successor, which gets expensive
+// when the same question is asked over and over.
+//
+// The blocks are numbered in the order that they are in the method when the
+// CFG is built, and the edges are kept in arrays indexed by block number.
+// Passes that change the CFG may keep it up to date by making their changes
+// through the editing methods at the bottom of the class.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_ANALYSIS_CFG_H
+#define LLVM_ANALYSIS_CFG_H
+
+#include "llvm/Pass.h"
+#include <hash_map>
+class BasicBlock;
+class TerminatorInst;
+
+class MethodCFG : public AnalysisResult {
+  struct BlockPtrHash {
+    size_t operator()(const BasicBlock *BB) const { return (size_t)BB >> 3; }
+  };
+  hash_map<const BasicBlock*, unsigned, BlockPtrHash> BlockNumbers;
+
+  vector<BasicBlock*> Blocks;                 // Block number -> block
+  vector<vector<BasicBlock*> > Preds, Succs;  // Indexed by block number
+public:
+  static const AnalysisInfo ID;     // Method level analysis
+
+  MethodCFG(Method *M);
+
+  // getNumBlocks - Return the number of block numbers that have been handed
+  // out.  Blocks that have been removed keep their number, and getBlock
+  // returns null for it.
+  //
+  inline unsigned getNumBlocks() const { return Blocks.size(); }
+  inline BasicBlock *getBlock(unsigned No) const { return Blocks[No]; }
+  unsigned getBlockNumber(const BasicBlock *BB) const;
+
+  // getPredecessors - Return the blocks that branch to BB.  A block that
+  // branches to BB more than once is listed more than once.
+  //
+  inline const vector<BasicBlock*> &getPredecessors(unsigned No) const {
+    return Preds[No];
+  }
+  inline const vector<BasicBlock*> &getPredecessors(const BasicBlock *BB) const{
+    return Preds[getBlockNumber(BB)];
+  }
+
+  // getSuccessors - Return the blocks that BB branches to, in the order of the
+  // successors of its terminator.
+  //
+  inline const vector<BasicBlock*> &getSuccessors(unsigned No) const {
+    return Succs[No];
+  }
+  inline const vector<BasicBlock*> &getSuccessors(const BasicBlock *BB) const {
+    return Succs[getBlockNumber(BB)];
+  }
+
+  //===--------------------------------------------------------------------===//
+  // Editing the CFG.  Each of these changes the method, or is told about a
+  // change to it, and updates the edges to match.
+  //
+
+  // setSuccessor - Make successor #i of the terminator of BB be NewSucc.
+  void setSuccessor(BasicBlock *BB, unsigned i, BasicBlock *NewSucc);
+
+  // redirectBranches - Make every branch to From go to To instead.  This uses
+  // replaceAllUsesWith, so references from the constant pool move too.
+  //
+  void redirectBranches(BasicBlock *From, BasicBlock *To);
+
+  // addBlock - BB has been added to the method.  It gets the next number.
+  void addBlock(BasicBlock *BB);
+
+  // removeBlock - BB is about to be removed from the method.  Its outgoing
+  // edges are forgotten.  Nothing may branch to it any more.
+  //
+  void removeBlock(BasicBlock *BB);
+
+  // terminatorChanged - The terminator of BB has been changed or replaced in
+  // some other way, so its successors must be found again.
+  //
+  void terminatorChanged(BasicBlock *BB);
+
+private:
+  void addEdges(unsigned No);
+  void removeEdges(unsigned No);
+};
+
+#endif
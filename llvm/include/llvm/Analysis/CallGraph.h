@@ -0,0 +1,31 @@
+//===-- llvm/Analysis/CallGraph.h - Build a Module's call graph --*- C++ -*--=//
+//
+// This file defines the CallGraph analysis, which records, for every method in
+// a module, the methods that it calls and the methods that call it.  Each list
+// holds a method once, in the order that the calls are first seen.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_ANALYSIS_CALLGRAPH_H
+#define LLVM_ANALYSIS_CALLGRAPH_H
+
+#include "llvm/Pass.h"
+class Method;
+
+class CallGraph : public AnalysisResult {
+  typedef map<const Method*, vector<Method*> > MethodMapType;
+  MethodMapType Callees, Callers;
+  vector<Method*> NoMethods;        // Returned for methods without calls
+public:
+  static const AnalysisInfo ID;     // Module level analysis
+
+  CallGraph(Module *M);
+
+  // getCallees - Return the methods called by M.
+  const vector<Method*> &getCallees(const Method *M) const;
+
+  // getCallers - Return the methods that call M.
+  const vector<Method*> &getCallers(const Method *M) const;
+};
+
+#endif
@@ -0,0 +1,96 @@
+//===-- llvm/Analysis/Dominators.h - Dominator tree of a method --*- C++ -*--=//
+//
+// This file defines the DominatorTree analysis, which computes the immediate
+// dominator of each basic block of a method, and the dominance frontier of each
+// block.  Block A dominates block B if every path from the entry block to B
+// goes through A.
+//
+// The tree is built with the iterative algorithm of Cooper, Harvey and
+// Kennedy, over the blocks in reverse postorder.  The nodes of the tree are
+// then numbered in a depth first walk, so that asking whether one block
+// dominates another takes constant time.
+//
+// Blocks that cannot be reached from the entry block are not in the tree.
+// They have no immediate dominator and no frontier, and are only dominated by
+// themselves.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_ANALYSIS_DOMINATORS_H
+#define LLVM_ANALYSIS_DOMINATORS_H
+
+#include "llvm/Analysis/CFG.h"
+
+class DominatorTree : public AnalysisResult {
+  MethodCFG CFG;                    // Numbers the blocks and holds the edges
+
+  enum { NoBlock = ~0U };
+  vector<unsigned> IDoms;           // Block number -> immediate dominator #
+  vector<vector<BasicBlock*> > Children;   // Immediately dominated blocks
+  vector<vector<BasicBlock*> > Frontiers;  // Dominance frontiers
+  vector<unsigned> DFSIn, DFSOut;   // Numbers of a depth first walk of the tree
+public:
+  static const AnalysisInfo ID;     // Method level analysis
+
+  DominatorTree(Method *M);
+
+  // getCFG - Return the CFG that the tree was built from.
+  inline const MethodCFG &getCFG() const { return CFG; }
+
+  // getRoot - Return the entry block of the method, or null if the method has
+  // no body.
+  //
+  inline BasicBlock *getRoot() const {
+    return CFG.getNumBlocks() ? CFG.getBlock(0) : 0;
+  }
+
+  // isReachable - Return true if BB can be reached from the entry block.
+  inline bool isReachable(const BasicBlock *BB) const {
+    return DFSIn[CFG.getBlockNumber(BB)] != NoBlock;
+  }
+
+  // getIDom - Return the immediate dominator of BB, or null for the entry block
+  // and blocks that cannot be reached.
+  //
+  inline BasicBlock *getIDom(const BasicBlock *BB) const {
+    unsigned IDom = IDoms[CFG.getBlockNumber(BB)];
+    return IDom == NoBlock ? 0 : CFG.getBlock(IDom);
+  }
+
+  // getChildren - Return the blocks whose immediate dominator is BB.
+  inline const vector<BasicBlock*> &getChildren(const BasicBlock *BB) const {
+    return Children[CFG.getBlockNumber(BB)];
+  }
+
+  // dominates - Return true if A dominates B.  Every block dominates itself.
+  bool dominates(const BasicBlock *A, const BasicBlock *B) const {
+    unsigned ANo = CFG.getBlockNumber(A), BNo = CFG.getBlockNumber(B);
+    if (ANo == BNo) return true;
+    if (DFSIn[ANo] == NoBlock || DFSIn[BNo] == NoBlock) return false;
+    return DFSIn[ANo] < DFSIn[BNo] && DFSOut[BNo] < DFSOut[ANo];
+  }
+
+  // properlyDominates - Return true if A dominates B, and is not B.
+  inline bool properlyDominates(const BasicBlock *A,
+                                const BasicBlock *B) const {
+    return A != B && dominates(A, B);
+  }
+
+  // getDominanceFrontier - Return the blocks that are just out of the region
+  // that BB dominates: the blocks that BB does not properly dominate, which
+  // have a predecessor that BB dominates.  Each block is listed once.
+  //
+  inline const vector<BasicBlock*> &
+  getDominanceFrontier(const BasicBlock *BB) const {
+    return Frontiers[CFG.getBlockNumber(BB)];
+  }
+
+private:
+  void computePostOrder(vector<unsigned> &PostOrder, vector<unsigned> &PONum);
+  void computeIDoms(const vector<unsigned> &PostOrder,
+                    const vector<unsigned> &PONum);
+  void numberTree();
+  void computeFrontiers();
+};
+
+#endif
@@ -0,0 +1,87 @@
+//===-- llvm/Analysis/LoopInfo.h - Natural loops of a method -----*- C++ -*--=//
+//
+// This file defines the LoopInfo analysis, which finds the natural loops of a
+// method and how they nest.  A natural loop is found for each block (the
+// header) that is the target of a back edge, an edge from a block that the
+// header dominates.  The loop is the header, plus every block that can reach
+// the source of a back edge without going through the header.  Back edges to
+// the same header make up one loop.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_ANALYSIS_LOOPINFO_H
+#define LLVM_ANALYSIS_LOOPINFO_H
+
+#include "llvm/Pass.h"
+#include <hash_map>
+class BasicBlock;
+
+class Loop {
+  Loop *ParentLoop;
+  vector<Loop*> SubLoops;           // Loops nested directly inside this one
+  vector<BasicBlock*> Blocks;       // The header first, then the rest
+
+  friend class LoopInfo;
+  inline Loop(BasicBlock *Header) : ParentLoop(0) { Blocks.push_back(Header); }
+  ~Loop();                          // Deletes the subloops
+public:
+  inline BasicBlock *getHeader() const { return Blocks.front(); }
+  inline Loop *getParentLoop() const { return ParentLoop; }
+  inline const vector<Loop*> &getSubLoops() const { return SubLoops; }
+
+  // getBlocks - Return the blocks of the loop, including the blocks of its
+  // subloops.
+  //
+  inline const vector<BasicBlock*> &getBlocks() const { return Blocks; }
+
+  // getLoopDepth - Return the number of loops that this one is inside, plus
+  // one.  Outermost loops have a depth of 1.
+  //
+  unsigned getLoopDepth() const {
+    unsigned Depth = 1;
+    for (const Loop *L = ParentLoop; L; L = L->ParentLoop) ++Depth;
+    return Depth;
+  }
+
+  // contains - Return true if L is this loop, or is nested inside of it.  A
+  // null loop is not contained in anything.
+  //
+  bool contains(const Loop *L) const {
+    for (; L; L = L->ParentLoop)
+      if (L == this) return true;
+    return false;
+  }
+};
+
+class LoopInfo : public AnalysisResult {
+  struct BlockPtrHash {
+    size_t operator()(const BasicBlock *BB) const { return (size_t)BB >> 3; }
+  };
+  hash_map<const BasicBlock*, Loop*, BlockPtrHash> BlockLoops;  // Innermost
+  vector<Loop*> TopLevelLoops;
+public:
+  static const AnalysisInfo ID;     // Method level analysis
+
+  LoopInfo(Method *M);
+  ~LoopInfo();
+
+  // getTopLevelLoops - Return the loops that are not inside of another loop.
+  inline const vector<Loop*> &getTopLevelLoops() const { return TopLevelLoops; }
+
+  // getLoopFor - Return the innermost loop that BB is in, or null if it is not
+  // in a loop.
+  //
+  Loop *getLoopFor(const BasicBlock *BB) const {
+    hash_map<const BasicBlock*, Loop*, BlockPtrHash>::const_iterator I =
+      BlockLoops.find(BB);
+    return I != BlockLoops.end() ? I->second : 0;
+  }
+
+  // addBlockToLoop - BB has been added to the method, inside of loop L (which
+  // may be null).  Add it to L and the loops around L.  This is used by passes
+  // that create blocks and keep LoopInfo up to date.
+  //
+  void addBlockToLoop(BasicBlock *BB, Loop *L);
+};
+
+#endif
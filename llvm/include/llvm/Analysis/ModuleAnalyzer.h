@@ -4,49 +4,82 @@
 // way.  This is used by the AssemblyWriter, BytecodeWriter, and SlotCalculator
 // to do analysis of a module.
 //
+// ModuleAnalyzer is a template that is passed the class deriving from it, and
+// calls the process* hooks of that class directly instead of through virtual
+// functions.  The hooks that a subclass does not define fall back to the
+// defaults here, which mostly do nothing and compile away.  Subclasses that
+// keep their hooks protected must make ModuleAnalyzer a friend:
+//
+//   class SlotCalculator : public ModuleAnalyzer<SlotCalculator> {
+//     friend class ModuleAnalyzer<SlotCalculator>;
+//   protected:
+//     bool processConstant(const ConstPoolVal *CPV);
+//     ...
+//
 //===----------------------------------------------------------------------===//
 
 #ifndef LLVM_ANALYSIS_MODULEANALYZER_H
 #define LLVM_ANALYSIS_MODULEANALYZER_H
 
 #include "llvm/ConstantPool.h"
-#include <set>
-
-class Module;
-class Method;
-class BasicBlock;
-class Instruction;
-class ConstPoolVal;
-class MethodType;
-class MethodArgument;
+#include "llvm/ConstPoolVals.h"
+#include "llvm/DerivedTypes.h"
+#include "llvm/Module.h"
+#include "llvm/Method.h"
+#include "llvm/BasicBlock.h"
+#include <vector>
 
+template<class SubClass>
 class ModuleAnalyzer {
   ModuleAnalyzer(const ModuleAnalyzer &);                   // do not impl
   const ModuleAnalyzer &operator=(const ModuleAnalyzer &);  // do not impl
+
+  // TypeSeen - Keep track of which types have already been processType'ed
+  // while processing a constant pool.  We don't want to reprocess the same
+  // type more than once.  This is indexed by type UID, and TypesSeen lists
+  // the UIDs that are set, so that it may be cleared without touching every
+  // entry.
+  //
+  vector<bool> TypeSeen;
+  vector<unsigned> TypesSeen;
+
+  inline SubClass *getDerived() { return (SubClass*)this; }
 public:
   ModuleAnalyzer() {}
-  virtual ~ModuleAnalyzer() {}
-  
+  ~ModuleAnalyzer() {}
+
 protected:
-  // processModule - Driver function to call all of my subclasses virtual 
-  // methods.  Commonly called by derived type's constructor.
+  // processModule - Driver function to call all of my subclasses methods.
+  // Commonly called by derived type's constructor.
   //
-  bool processModule(const Module *M);
+  bool processModule(const Module *M) {
+    // Loop over the constant pool, process all of the constants...
+    if (getDerived()->processConstPool(M->getConstantPool(), false))
+      return true;
+
+    return getDerived()->processMethods(M);
+  }
 
   //===--------------------------------------------------------------------===//
   //  Stages of processing Module level information
   //
-  virtual bool processConstPool(const ConstantPool &CP, bool isMethod);
+  bool processConstPool(const ConstantPool &CP, bool isMethod);
 
   // processType - This callback occurs when an derived type is discovered
   // at the class level. This activity occurs when processing a constant pool.
   //
-  virtual bool processType(const Type *Ty) { return false; }
+  bool processType(const Type *Ty) { return false; }
 
-  // processMethods - The default implementation of this method loops through 
+  // processMethods - The default implementation of this method loops through
   // all of the methods in the module and processModule's them.
   //
-  virtual bool processMethods(const Module *M);
+  bool processMethods(const Module *M) {
+    for (Module::MethodListType::const_iterator I = M->getMethodList().begin();
+         I != M->getMethodList().end(); I++)
+      if (getDerived()->processMethod(*I)) return true;
+
+    return false;
+  }
 
   //===--------------------------------------------------------------------===//
   //  Stages of processing a constant pool
@@ -56,23 +89,23 @@ protected:
   // constant pool.  The default action is to do nothing.  The processConstPool
   // method does the iteration over constants.
   //
-  virtual bool processConstPoolPlane(const ConstantPool &CP,
-				     const ConstantPool::PlaneType &Pl, 
-				     bool isMethod) {
+  bool processConstPoolPlane(const ConstantPool &CP,
+                             const ConstantPool::PlaneType &Pl,
+                             bool isMethod) {
     return false;
   }
 
   // processConstant is called once per each constant in the constant pool.  It
   // traverses the constant pool such that it visits each constant in the
-  // order of its type.  Thus, all 'int' typed constants shall be visited 
+  // order of its type.  Thus, all 'int' typed constants shall be visited
   // sequentially, etc...
   //
-  virtual bool processConstant(const ConstPoolVal *CPV) { return false; }
+  bool processConstant(const ConstPoolVal *CPV) { return false; }
 
-  // visitMethod - This member is called after the constant pool has been 
+  // visitMethod - This member is called after the constant pool has been
   // processed.  The default implementation of this is a noop.
   //
-  virtual bool visitMethod(const Method *M) { return false; }
+  bool visitMethod(const Method *M) { return false; }
 
   //===--------------------------------------------------------------------===//
   //  Stages of processing Method level information
@@ -82,32 +115,150 @@ protected:
 
   // processMethod - Process all aspects of a method.
   //
-  virtual bool processMethod(const Method *M);
+  bool processMethod(const Method *M);
 
-  // processMethodArgument - This member is called for every argument that 
+  // processMethodArgument - This member is called for every argument that
   // is passed into the method.
   //
-  virtual bool processMethodArgument(const MethodArgument *MA) { return false; }
+  bool processMethodArgument(const MethodArgument *MA) { return false; }
 
   // processBasicBlock - This member is called for each basic block in a methd.
   //
-  virtual bool processBasicBlock(const BasicBlock *BB);
+  bool processBasicBlock(const BasicBlock *BB) {
+    // Process all of the instructions in the basic block
+    BasicBlock::InstListType::const_iterator Inst = BB->getInstList().begin();
+    for (; Inst != BB->getInstList().end(); Inst++) {
+      if (getDerived()->preProcessInstruction(*Inst) ||
+          getDerived()->processInstruction(*Inst)) return true;
+    }
+    return false;
+  }
 
   //===--------------------------------------------------------------------===//
   //  Stages of processing BasicBlock level information
   //
 
-  // preProcessInstruction - This member is called for each Instruction in a 
+  // preProcessInstruction - This member is called for each Instruction in a
   // method before processInstruction.
   //
-  virtual bool preProcessInstruction(const Instruction *I);
+  bool preProcessInstruction(const Instruction *I) { return false; }
 
   // processInstruction - This member is called for each Instruction in a method
   //
-  virtual bool processInstruction(const Instruction *I) { return false; }
+  bool processInstruction(const Instruction *I) { return false; }
 
 private:
-  bool handleType(set<const Type *> &TypeSet, const Type *T);
+  bool handleType(const Type *T);
 };
 
+
+template<class SubClass>
+bool ModuleAnalyzer<SubClass>::handleType(const Type *T) {
+  if (!T->isDerivedType()) return false;    // Boring boring types...
+
+  unsigned UID = T->getUniqueID();
+  if (UID >= TypeSeen.size()) TypeSeen.resize(UID+1, false);
+  if (TypeSeen[UID]) return false;          // Already found this type...
+  TypeSeen[UID] = true;                     // Add it to the set
+  TypesSeen.push_back(UID);
+
+  // Recursively process interesting types...
+  switch (T->getPrimitiveID()) {
+  case Type::MethodTyID: {
+    const MethodType *MT = (const MethodType *)T;
+    if (handleType(MT->getReturnType())) return true;
+    const MethodType::ParamTypes &Params = MT->getParamTypes();
+
+    for (MethodType::ParamTypes::const_iterator I = Params.begin();
+         I != Params.end(); ++I)
+      if (handleType(*I)) return true;
+    break;
+  }
+
+  case Type::ArrayTyID:
+    if (handleType(((const ArrayType *)T)->getElementType()))
+      return true;
+    break;
+
+  case Type::StructTyID: {
+    const StructType *ST = (const StructType*)T;
+    const StructType::ElementTypes &Elements = ST->getElementTypes();
+    for (StructType::ElementTypes::const_iterator I = Elements.begin();
+         I != Elements.end(); ++I)
+      if (handleType(*I)) return true;
+    break;
+  }
+
+  case Type::PointerTyID:
+    if (handleType(((const PointerType *)T)->getValueType()))
+      return true;
+    break;
+
+  default:
+    cerr << "ModuleAnalyzer::handleType, type unknown: '"
+         << T->getName() << "'\n";
+    break;
+  }
+
+  return getDerived()->processType(T);
+}
+
+
+template<class SubClass>
+bool ModuleAnalyzer<SubClass>::processConstPool(const ConstantPool &CP,
+                                                bool isMethod) {
+  // Each constant pool starts with no types seen...
+  for (unsigned i = 0; i < TypesSeen.size(); ++i)
+    TypeSeen[TypesSeen[i]] = false;
+  TypesSeen.clear();
+
+  for (ConstantPool::plane_const_iterator PI = CP.begin();
+       PI != CP.end(); ++PI) {
+    const ConstantPool::PlaneType &Plane = **PI;
+    if (Plane.empty()) continue;        // Skip empty type planes...
+
+    if (getDerived()->processConstPoolPlane(CP, Plane, isMethod)) return true;
+
+    for (ConstantPool::PlaneType::const_iterator CI = Plane.begin();
+         CI != Plane.end(); CI++) {
+      if ((*CI)->getType() == Type::TypeTy)
+        if (handleType(((const ConstPoolType*)(*CI))->getValue()))
+          return true;
+      if (handleType((*CI)->getType())) return true;
+
+      if (getDerived()->processConstant(*CI)) return true;
+    }
+  }
+
+  if (!isMethod) {
+    assert(CP.getParent()->getValueType() == Value::ModuleVal);
+    const Module *M = (const Module*)CP.getParent();
+    // Process the method types after the constant pool...
+    for (Module::MethodListType::const_iterator I = M->getMethodList().begin();
+         I != M->getMethodList().end(); I++) {
+      if (handleType((*I)->getType())) return true;
+      if (getDerived()->visitMethod(*I)) return true;
+    }
+  }
+  return false;
+}
+
+template<class SubClass>
+bool ModuleAnalyzer<SubClass>::processMethod(const Method *M) {
+  // Loop over the arguments, processing them...
+  const Method::ArgumentListType &ArgList = M->getArgumentList();
+  for (Method::ArgumentListType::const_iterator AI = ArgList.begin();
+       AI != ArgList.end(); AI++)
+    if (getDerived()->processMethodArgument(*AI)) return true;
+
+  // Loop over the constant pool, adding the constants to the table...
+  getDerived()->processConstPool(M->getConstantPool(), true);
+
+  // Loop over all the basic blocks, in order...
+  Method::BasicBlocksType::const_iterator BBI = M->getBasicBlocks().begin();
+  for (; BBI != M->getBasicBlocks().end(); BBI++)
+    if (getDerived()->processBasicBlock(*BBI)) return true;
+  return false;
+}
+
 #endif
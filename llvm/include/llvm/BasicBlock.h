@@ -80,12 +80,19 @@ public:
   //
   void dropAllReferences();
 
+  // removePHIOperand - Edge #i into this block is going away, so remove
+  // incoming value #i from each of the PHI nodes that the block starts with.
+  //
+  void removePHIOperand(unsigned i);
+
   // splitBasicBlock - This splits a basic block into two at the specified
   // instruction.  Note that all instructions BEFORE the specified iterator stay
   // as part of the original basic block, an unconditional branch is added to 
   // the new BB, and the rest of the instructions in the BB are moved to the new
   // BB, including the old terminator.  The newly formed BasicBlock is returned.
-  // This function invalidates the specified iterator.
+  // It is placed right after this one in the method, so that the PHI nodes of
+  // the successors keep the order of their incoming values.  This function
+  // invalidates the specified iterator.
   //
   // Note that this only works on well formed basic blocks (must have a 
   // terminator), and 'I' must not be the end of instruction list (which would
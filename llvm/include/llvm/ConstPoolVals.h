@@ -54,14 +54,7 @@ public:
   inline const SymTabValue *getParent() const { return Parent; }
   inline       SymTabValue *getParent()       { return Parent; }
 
-  // if i > the number of operands, then getOperand() returns 0, and setOperand
-  // returns false.  setOperand() may also return false if the operand is of
-  // the wrong type.
-  //
-  // Note that some subclasses may change this default no argument behavior
-  //
-  virtual Value *getOperand(unsigned i) { return 0; }
-  virtual const Value *getOperand(unsigned i) const { return 0; }
+  // setOperand fails! You can't change a constant!
   virtual bool setOperand(unsigned i, Value *Val) { return false; }
   virtual void dropAllReferences() {}
 };
@@ -172,7 +165,7 @@ public:
 // ConstPoolArray - Constant Array Declarations
 //
 class ConstPoolArray : public ConstPoolVal {
-  vector<ConstPoolUse> Val;
+  vector<Use> Val;              // The elements, which are all ConstPoolVals
   ConstPoolArray(const ConstPoolArray &CPT);
 public:
   ConstPoolArray(const ArrayType *T, vector<ConstPoolVal*> &V, 
@@ -183,20 +176,15 @@ public:
   virtual string getStrValue() const;
   virtual bool equals(const ConstPoolVal *V) const;
 
-  inline const vector<ConstPoolUse> &getValues() const { return Val; }
-
-  // Implement User stuff...
-  //
-  virtual Value *getOperand(unsigned i) { 
-    return (i < Val.size()) ? Val[i] : 0; 
-  }
-  virtual const Value *getOperand(unsigned i) const {
-    return (i < Val.size()) ? Val[i] : 0; 
+  inline const vector<Use> &getValues() const { return Val; }
+  inline const ConstPoolVal *getElement(unsigned i) const {
+    return (const ConstPoolVal*)(const Value*)Val[i];
   }
 
-  // setOperand fails! You can't change a constant!
-  virtual bool setOperand(unsigned i, Value *Val) { return false; }
-  virtual void dropAllReferences() { Val.clear(); }
+  virtual void dropAllReferences() {
+    Val.clear();
+    Operands = 0; NumOperands = 0;
+  }
 };
 
 
@@ -204,7 +192,7 @@ public:
 // ConstPoolStruct - Constant Struct Declarations
 //
 class ConstPoolStruct : public ConstPoolVal {
-  vector<ConstPoolUse> Val;
+  vector<Use> Val;              // The elements, which are all ConstPoolVals
   ConstPoolStruct(const ConstPoolStruct &CPT);
 public:
   ConstPoolStruct(const StructType *T, vector<ConstPoolVal*> &V, 
@@ -215,20 +203,15 @@ public:
   virtual string getStrValue() const;
   virtual bool equals(const ConstPoolVal *V) const;
 
-  inline const vector<ConstPoolUse> &getValues() const { return Val; }
-
-  // Implement User stuff...
-  //
-  virtual Value *getOperand(unsigned i) { 
-    return (i < Val.size()) ? Val[i] : 0; 
-  }
-  virtual const Value *getOperand(unsigned i) const {
-    return (i < Val.size()) ? Val[i] : 0; 
+  inline const vector<Use> &getValues() const { return Val; }
+  inline const ConstPoolVal *getElement(unsigned i) const {
+    return (const ConstPoolVal*)(const Value*)Val[i];
   }
 
-  // setOperand fails! You can't change a constant!
-  virtual bool setOperand(unsigned i, Value *Val) { return false; }
-  virtual void dropAllReferences() { Val.clear(); }
+  virtual void dropAllReferences() {
+    Val.clear();
+    Operands = 0; NumOperands = 0;
+  }
 };
 
 #endif
@@ -17,6 +17,11 @@
 //          note that these may return a null object if I don't know how to 
 //          perform those operations on the specified constant types.
 //
+// Integer arithmetic wraps around on overflow, as it does on the machine.  An
+// integer division or remainder by zero, and a floating point value that is out
+// of the range of the integer type it is cast to, are not folded (null is
+// returned), so that the program does whatever it would have done at run time.
+//
 //===----------------------------------------------------------------------===//
 //
 // Implementation notes:
@@ -56,7 +61,9 @@ class ConstRules {
 protected:
   inline ConstRules() {}  // Can only be subclassed...
 public:
-  // Unary Operators...
+  // Unary Operators...  not flips every bit of an integer, like ~ in C, and
+  // is logical negation for bool.
+  //
   virtual ConstPoolVal *neg(const ConstPoolVal *V) const = 0;
   virtual ConstPoolVal *not(const ConstPoolVal *V) const = 0;
 
@@ -65,19 +72,55 @@ public:
                             const ConstPoolVal *V2) const = 0;
   virtual ConstPoolVal *sub(const ConstPoolVal *V1, 
                             const ConstPoolVal *V2) const = 0;
+  virtual ConstPoolVal *mul(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const = 0;
+  virtual ConstPoolVal *div(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const = 0;
+  virtual ConstPoolVal *rem(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const = 0;
+  virtual ConstPoolVal *and(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const = 0;
+  virtual ConstPoolVal *or (const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const = 0;
+  virtual ConstPoolVal *xor(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const = 0;
+
+  // Shift Operators...  The shift amount may have any integral type.
+  virtual ConstPoolVal *shl(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const = 0;
+  virtual ConstPoolVal *shr(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const = 0;
 
   virtual ConstPoolBool *lessthan(const ConstPoolVal *V1, 
                                   const ConstPoolVal *V2) const = 0;
 
-  // ConstRules::get - A type will cache its own type rules if one is needed...
-  // we just want to make sure to hit the cache instead of doing it indirectly,
-  //  if possible...
+  // Casting operators...
+  virtual ConstPoolBool *castToBool  (const ConstPoolVal *V) const = 0;
+  virtual ConstPoolSInt *castToSByte (const ConstPoolVal *V) const = 0;
+  virtual ConstPoolUInt *castToUByte (const ConstPoolVal *V) const = 0;
+  virtual ConstPoolSInt *castToShort (const ConstPoolVal *V) const = 0;
+  virtual ConstPoolUInt *castToUShort(const ConstPoolVal *V) const = 0;
+  virtual ConstPoolSInt *castToInt   (const ConstPoolVal *V) const = 0;
+  virtual ConstPoolUInt *castToUInt  (const ConstPoolVal *V) const = 0;
+  virtual ConstPoolSInt *castToLong  (const ConstPoolVal *V) const = 0;
+  virtual ConstPoolUInt *castToULong (const ConstPoolVal *V) const = 0;
+  virtual ConstPoolFP   *castToFloat (const ConstPoolVal *V) const = 0;
+  virtual ConstPoolFP   *castToDouble(const ConstPoolVal *V) const = 0;
+
+  // castTo - Convert V to the primitive type Ty, by calling the castTo method
+  // for Ty.
+  //
+  ConstPoolVal *castTo(const ConstPoolVal *V, const Type *Ty) const;
+
+  // ConstRules::get - Each type finds its rules when it is created, and keeps
+  // them, so this is just a load.  Nothing writes them after that, so threads
+  // may call this at the same time without a lock.
   //
   static inline const ConstRules *get(const ConstPoolVal &V) {
-    const ConstRules *Result = V.getType()->getConstRules();
-    return Result ? Result : find(V.getType());
+    return V.getType()->getConstRules();
   }
 private :
+  friend class Type;                          // Type's ctor calls find
   static const ConstRules *find(const Type *Ty);
 
   ConstRules(const ConstRules &);             // Do not implement
@@ -105,6 +148,47 @@ inline ConstPoolVal *operator-(const ConstPoolVal &V1, const ConstPoolVal &V2) {
   return ConstRules::get(V1)->sub(&V1, &V2);
 }
 
+inline ConstPoolVal *operator*(const ConstPoolVal &V1, const ConstPoolVal &V2) {
+  assert(V1.getType() == V2.getType() && "Constant types must be identical!");
+  return ConstRules::get(V1)->mul(&V1, &V2);
+}
+
+inline ConstPoolVal *operator/(const ConstPoolVal &V1, const ConstPoolVal &V2) {
+  assert(V1.getType() == V2.getType() && "Constant types must be identical!");
+  return ConstRules::get(V1)->div(&V1, &V2);
+}
+
+inline ConstPoolVal *operator%(const ConstPoolVal &V1, const ConstPoolVal &V2) {
+  assert(V1.getType() == V2.getType() && "Constant types must be identical!");
+  return ConstRules::get(V1)->rem(&V1, &V2);
+}
+
+inline ConstPoolVal *operator&(const ConstPoolVal &V1, const ConstPoolVal &V2) {
+  assert(V1.getType() == V2.getType() && "Constant types must be identical!");
+  return ConstRules::get(V1)->and(&V1, &V2);
+}
+
+inline ConstPoolVal *operator|(const ConstPoolVal &V1, const ConstPoolVal &V2) {
+  assert(V1.getType() == V2.getType() && "Constant types must be identical!");
+  return ConstRules::get(V1)->or(&V1, &V2);
+}
+
+inline ConstPoolVal *operator^(const ConstPoolVal &V1, const ConstPoolVal &V2) {
+  assert(V1.getType() == V2.getType() && "Constant types must be identical!");
+  return ConstRules::get(V1)->xor(&V1, &V2);
+}
+
+// The shift amount does not have to be the same type as the value shifted...
+inline ConstPoolVal *operator<<(const ConstPoolVal &V1, 
+                                const ConstPoolVal &V2) {
+  return ConstRules::get(V1)->shl(&V1, &V2);
+}
+
+inline ConstPoolVal *operator>>(const ConstPoolVal &V1, 
+                                const ConstPoolVal &V2) {
+  return ConstRules::get(V1)->shr(&V1, &V2);
+}
+
 inline ConstPoolBool *operator<(const ConstPoolVal &V1, 
                                 const ConstPoolVal &V2) {
   assert(V1.getType() == V2.getType() && "Constant types must be identical!");
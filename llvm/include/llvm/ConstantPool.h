@@ -19,11 +19,20 @@ class ConstantPool {
 public:
   typedef ValueHolder<ConstPoolVal, SymTabValue> PlaneType;
 private:
+  // Only the planes of types that have been used are allocated.  Planes is
+  // kept sorted by the UID of the plane's type, so that iterating over it
+  // always visits the planes in the same order.  PlaneUIDs[i] is the type UID
+  // of Planes[i], and is binary searched to find the plane for a type.
+  //
   typedef vector<PlaneType*> PlanesType;
   PlanesType Planes;
+  vector<unsigned> PlaneUIDs;
   SymTabValue *Parent;
 
-  inline void resize(unsigned size);
+  // findPlane - Return the index that the plane for the specified type UID
+  // is at, or would be inserted at if it does not exist.
+  //
+  unsigned findPlane(unsigned UID) const;
 public:
   inline ConstantPool(SymTabValue *P) { Parent = P; }
   inline ~ConstantPool() { delete_all(); }
@@ -41,8 +50,8 @@ public:
   bool getPlane(const Type *T, const PlaneType *&Plane) const;
   bool getPlane(const Type *T,       PlaneType *&Plane);
 
-  // Normal getPlane - Resizes constant pool to contain type even if it doesn't
-  // already have it.
+  // Normal getPlane - Adds a plane for the type to the constant pool if it
+  // doesn't already have one.
   //
   PlaneType &getPlane(const Type *T);
 
@@ -52,6 +61,11 @@ public:
 
   void delete_all();
 
+  // sortPlanes - Put the planes back in order, after the UIDs of their types
+  // have been changed by TypeContext::renumberTypes.
+  //
+  void sortPlanes();
+
   // find - Search to see if a constant of the specified value is already in
   // the constant table.
   //
@@ -49,6 +49,12 @@ public:
   const Type *getReturnType() const;
   const MethodType *getMethodType() const;
 
+  // setMethodType - Change the signature of the method.  The caller must make
+  // the argument list match the new parameter types, and must rewrite the
+  // calls to the method.
+  //
+  void setMethodType(const MethodType *Ty);
+
   // Is the body of this method unknown? (the basic block list is empty if so)
   // this is true for "extern"al methods.
   bool isMethodExternal() const { return BasicBlocks.empty(); }
@@ -0,0 +1,111 @@
+//===- llvm/InstVisitor.h - Dispatch on the type of an instruction -*- C++ -*-=//
+//
+// This file defines the InstVisitor class template, which calls a different
+// visit method for each kind of instruction.  It switches on the opcode of the
+// instruction instead of making virtual calls, and hands each visit method a
+// pointer of the right type, so that users do not have to write the switch
+// and the casts themselves.
+//
+// To use it, derive a class from InstVisitor, passing the derived class as the
+// first template argument, and define the visit methods that you care about.
+// The others default to the visit method of the parent class of the
+// instruction (visitMallocInst calls visitAllocationInst, which calls
+// visitInstruction, for example).  Because the methods are found at compile
+// time, the defaults that are not overridden compile away.  For example:
+//
+//   struct CountPHIs : public InstVisitor<CountPHIs> {
+//     unsigned Count;
+//     CountPHIs() : Count(0) {}
+//     void visitPHINode(PHINode *PN) { ++Count; }
+//   };
+//
+//   CountPHIs C;
+//   C.visit(M);          // Visit every instruction in method M
+//
+// The second template argument is the return type of the visit methods.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_INSTVISITOR_H
+#define LLVM_INSTVISITOR_H
+
+#include "llvm/Method.h"
+#include "llvm/BasicBlock.h"
+#include "llvm/iTerminators.h"
+#include "llvm/iBinary.h"
+#include "llvm/iMemory.h"
+#include "llvm/iOther.h"
+
+#define DELEGATE(TO, I) return ((SubClass*)this)->visit##TO(I)
+
+template<class SubClass, class RetTy = void>
+class InstVisitor {
+public:
+  // visit - Visit every instruction in a method or a basic block.
+  //
+  void visit(Method *M) {
+    for (Method::inst_iterator I = M->inst_begin(), E = M->inst_end();
+         I != E; ++I)
+      ((SubClass*)this)->visit(*I);
+  }
+  void visit(BasicBlock *BB) {
+    BasicBlock::InstListType &Insts = BB->getInstList();
+    for (BasicBlock::InstListType::iterator I = Insts.begin(), E = Insts.end();
+         I != E; ++I)
+      ((SubClass*)this)->visit(*I);
+  }
+
+  // visit - Call the visit method for the kind of instruction that I is.
+  //
+  RetTy visit(Instruction *I) {
+    switch (I->getInstType()) {
+    case Instruction::Ret:    DELEGATE(ReturnInst, (ReturnInst*)I);
+    case Instruction::Br:     DELEGATE(BranchInst, (BranchInst*)I);
+    case Instruction::Switch: DELEGATE(SwitchInst, (SwitchInst*)I);
+
+    case Instruction::SetEQ: case Instruction::SetNE:
+    case Instruction::SetLE: case Instruction::SetGE:
+    case Instruction::SetLT: case Instruction::SetGT:
+      DELEGATE(SetCondInst, (SetCondInst*)I);
+
+    case Instruction::Malloc: DELEGATE(MallocInst, (MallocInst*)I);
+    case Instruction::Alloca: DELEGATE(AllocaInst, (AllocaInst*)I);
+    case Instruction::Free:   DELEGATE(FreeInst,   (FreeInst*)I);
+
+    case Instruction::PHINode: DELEGATE(PHINode,  (PHINode*)I);
+    case Instruction::Call:    DELEGATE(CallInst, (CallInst*)I);
+
+    default:
+      if (I->isUnaryOp())  DELEGATE(UnaryOperator,  (UnaryOperator*)I);
+      if (I->isBinaryOp()) DELEGATE(BinaryOperator, (BinaryOperator*)I);
+      DELEGATE(Instruction, I);
+    }
+  }
+
+  // The default visit methods.  Each calls the visit method of the parent
+  // class of its instruction.
+  //
+  RetTy visitReturnInst(ReturnInst *I)   { DELEGATE(TerminatorInst, I); }
+  RetTy visitBranchInst(BranchInst *I)   { DELEGATE(TerminatorInst, I); }
+  RetTy visitSwitchInst(SwitchInst *I)   { DELEGATE(TerminatorInst, I); }
+  RetTy visitSetCondInst(SetCondInst *I) { DELEGATE(BinaryOperator, I); }
+  RetTy visitMallocInst(MallocInst *I)   { DELEGATE(AllocationInst, I); }
+  RetTy visitAllocaInst(AllocaInst *I)   { DELEGATE(AllocationInst, I); }
+  RetTy visitFreeInst(FreeInst *I)       { DELEGATE(Instruction, I); }
+  RetTy visitPHINode(PHINode *I)         { DELEGATE(Instruction, I); }
+  RetTy visitCallInst(CallInst *I)       { DELEGATE(Instruction, I); }
+
+  RetTy visitTerminatorInst(TerminatorInst *I) { DELEGATE(Instruction, I); }
+  RetTy visitUnaryOperator(UnaryOperator *I)   { DELEGATE(Instruction, I); }
+  RetTy visitBinaryOperator(BinaryOperator *I) { DELEGATE(Instruction, I); }
+  RetTy visitAllocationInst(AllocationInst *I) { DELEGATE(Instruction, I); }
+
+  // visitInstruction - The instructions that nothing else handles end up here.
+  // It does nothing by default.
+  //
+  RetTy visitInstruction(Instruction *I) { return RetTy(); }
+};
+
+#undef DELEGATE
+
+#endif
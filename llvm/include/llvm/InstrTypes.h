@@ -30,11 +30,6 @@ public:
 
   // Terminators must implement the methods required by Instruction...
   virtual Instruction *clone() const = 0;
-  virtual void dropAllReferences() = 0;
-  virtual string getOpcode() const = 0;
-
-  virtual bool setOperand(unsigned i, Value *Val) = 0;
-  virtual const Value *getOperand(unsigned i) const = 0;
 
   // Additionally, they must provide a method to get at the successors of this
   // terminator instruction.  If 'idx' is out of range, a null pointer shall be
@@ -43,6 +38,11 @@ public:
   virtual const BasicBlock *getSuccessor(unsigned idx) const = 0;
   virtual unsigned getNumSuccessors() const = 0;
 
+  // setSuccessor - Make successor #idx of the terminator be B, whichever 
+  // operand it is kept in.
+  //
+  virtual void setSuccessor(unsigned idx, BasicBlock *B) = 0;
+
   inline BasicBlock *getSuccessor(unsigned idx) {
     return (BasicBlock*)((const TerminatorInst *)this)->getSuccessor(idx);
   }
@@ -54,32 +54,17 @@ public:
 //===----------------------------------------------------------------------===//
 
 class UnaryOperator : public Instruction {
-  Use Source;
+  Use Ops[1];
 public:
   UnaryOperator(Value *S, unsigned iType, const string &Name = "")
-      : Instruction(S->getType(), iType, Name), Source(S, this) {
+      : Instruction(S->getType(), iType, Name) {
+    Ops[0].init(S, this);
+    Operands = Ops; NumOperands = 1;
   }
   inline ~UnaryOperator() { dropAllReferences(); }
 
   virtual Instruction *clone() const { 
-    return Instruction::getUnaryOperator(getInstType(), Source);
-  }
-
-  virtual void dropAllReferences() {
-    Source = 0;
-  }
-
-  virtual string getOpcode() const = 0;
-
-  virtual unsigned getNumOperands() const { return 1; }
-  virtual const Value *getOperand(unsigned i) const {
-    return (i == 0) ? Source : 0;
-  }
-  virtual bool setOperand(unsigned i, Value *Val) {
-    // assert(Val && "operand must not be null!");
-    if (i) return false;
-    Source = Val;
-    return true;
+    return Instruction::getUnaryOperator(getInstType(), Ops[0]);
   }
 };
 
@@ -90,41 +75,20 @@ public:
 //===----------------------------------------------------------------------===//
 
 class BinaryOperator : public Instruction {
-  Use Source1, Source2;
+  Use Ops[2];
 public:
   BinaryOperator(unsigned iType, Value *S1, Value *S2, 
                  const string &Name = "") 
-    : Instruction(S1->getType(), iType, Name), Source1(S1, this), 
-      Source2(S2, this){
+    : Instruction(S1->getType(), iType, Name) {
     assert(S1 && S2 && S1->getType() == S2->getType());
+    Ops[0].init(S1, this);
+    Ops[1].init(S2, this);
+    Operands = Ops; NumOperands = 2;
   }
   inline ~BinaryOperator() { dropAllReferences(); }
 
   virtual Instruction *clone() const { 
-    return Instruction::getBinaryOperator(getInstType(), Source1, Source2);
-  }
-
-  virtual void dropAllReferences() {
-    Source1 = Source2 = 0;
-  }
-
-  virtual string getOpcode() const = 0;
-
-  virtual unsigned getNumOperands() const { return 2; }
-  virtual const Value *getOperand(unsigned i) const {
-    return (i == 0) ? Source1 : ((i == 1) ? Source2 : 0);
-  }
-
-  virtual bool setOperand(unsigned i, Value *Val) {
-    // assert(Val && "operand must not be null!");
-    if (i == 0) {
-      Source1 = Val; //assert(Val->getType() == Source2->getType());
-    } else if (i == 1) {
-      Source2 = Val; //assert(Val->getType() == Source1->getType());
-    } else {
-      return false;
-    }
-    return true;
+    return Instruction::getBinaryOperator(getInstType(), Ops[0], Ops[1]);
   }
 };
 
@@ -16,7 +16,6 @@ class Method;
 
 class Instruction : public User {
   BasicBlock *Parent;
-  unsigned iType;      // InstructionType
 
   friend class ValueHolder<Instruction,BasicBlock>;
   inline void setParent(BasicBlock *P) { Parent = P; }
@@ -43,48 +42,54 @@ public:
 
   // ---------------------------------------------------------------------------
   // Implement the User interface 
-  // if i > the number of operands, then getOperand() returns 0, and setOperand
-  // returns false.  setOperand() may also return false if the operand is of
-  // the wrong type.
+  // setOperand returns false if i > the number of operands.
   //
-  inline Value *getOperand(unsigned i) {
-    return (Value*)((const Instruction *)this)->getOperand(i);
-  }
-  virtual const Value *getOperand(unsigned i) const = 0;
-  virtual bool setOperand(unsigned i, Value *Val) = 0;
-  virtual unsigned getNumOperands() const = 0;
+  virtual bool setOperand(unsigned i, Value *Val);
+
+  // dropAllReferences - By default, null out all of the operands.
+  virtual void dropAllReferences();
 
   // ---------------------------------------------------------------------------
-  // Operand Iterator interface...
+  // Operand Iterator interface...  The operands of an instruction are always
+  // stored contiguously, so these are just pointers into the operand array.
   //
-  template <class _Inst, class _Val> class OperandIterator;
-  typedef OperandIterator<Instruction *, Value *> op_iterator;
-  typedef OperandIterator<const Instruction *, const Value *> op_const_iterator;
-
-  inline op_iterator       op_begin()      ;
-  inline op_const_iterator op_begin() const;
-  inline op_iterator       op_end()        ;
-  inline op_const_iterator op_end()   const;
+  typedef Use       *op_iterator;
+  typedef const Use *op_const_iterator;
 
+  inline op_iterator       op_begin()       { return Operands; }
+  inline op_const_iterator op_begin() const { return Operands; }
+  inline op_iterator       op_end()         { return Operands+NumOperands; }
+  inline op_const_iterator op_end()   const { return Operands+NumOperands; }
 
   // ---------------------------------------------------------------------------
   // Subclass classification... getInstType() returns a member of 
   // one of the enums that is coming soon (down below)...
   //
-  virtual string getOpcode() const = 0;
+  // getOpcode - Return the name of the instruction, as the assembly language
+  // spells it.  The names are kept in a static table indexed by the opcode.
+  //
+  inline const char *getOpcode() const { return getOpcodeName(SubclassData); }
+  static const char *getOpcodeName(unsigned Opcode);
 
-  unsigned getInstType() const { return iType; }
+  // The opcode is kept in the SubclassData field of Value.
+  unsigned getInstType() const { return SubclassData; }
   inline bool isTerminator() const {   // Instance of TerminatorInst?
-    return iType >= FirstTermOp && iType < NumTermOps; 
+    return SubclassData >= FirstTermOp && SubclassData < NumTermOps; 
   }
   inline bool isDefinition() const { return !isTerminator(); }
   inline bool isUnaryOp() const {
-    return iType >= FirstUnaryOp && iType < NumUnaryOps;
+    return SubclassData >= FirstUnaryOp && SubclassData < NumUnaryOps;
   }
   inline bool isBinaryOp() const {
-    return iType >= FirstBinaryOp && iType < NumBinaryOps;
+    return SubclassData >= FirstBinaryOp && SubclassData < NumBinaryOps;
   }
 
+  // isCommutative - Return true if the binary operator computes the same value
+  // when its operands are swapped.
+  //
+  inline bool isCommutative() const { return isCommutative(SubclassData); }
+  static bool isCommutative(unsigned Opcode);
+
   static Instruction *getBinaryOperator(unsigned Op, Value *S1, Value *S2);
   static Instruction *getUnaryOperator (unsigned Op, Value *Source);
 
@@ -148,52 +153,6 @@ public:
     NumOps,                          // Must be the last 'op' defined.
     UserOp1, UserOp2                 // May be used internally to a pass...
   };
-
-public:
-  template <class _Inst, class _Val>         // Operand Iterator Implementation
-  class OperandIterator {
-    const _Inst Inst;
-    unsigned idx;
-  public:
-    typedef OperandIterator<_Inst, _Val> _Self;
-    typedef forward_iterator_tag iterator_category;
-    typedef _Val pointer;
-    
-    inline OperandIterator(_Inst T) : Inst(T), idx(0) {}    // begin iterator
-    inline OperandIterator(_Inst T, bool) 
-      : Inst(T), idx(Inst->getNumOperands()) {}             // end iterator
-    
-    inline bool operator==(const _Self& x) const { return idx == x.idx; }
-    inline bool operator!=(const _Self& x) const { return !operator==(x); }
-
-    inline pointer operator*() const { return Inst->getOperand(idx); }
-    inline pointer *operator->() const { return &(operator*()); }
-    
-    inline _Self& operator++() { ++idx; return *this; } // Preincrement
-    inline _Self operator++(int) { // Postincrement
-      _Self tmp = *this; ++*this; return tmp; 
-    }
-
-    inline _Self& operator--() { --idx; return *this; }  // Predecrement
-    inline _Self operator--(int) { // Postdecrement
-      _Self tmp = *this; --*this; return tmp;
-    }
-  };
-
 };
 
-inline Instruction::op_iterator       Instruction::op_begin()       {
-  return op_iterator(this);
-}
-inline Instruction::op_const_iterator Instruction::op_begin() const {
-  return op_const_iterator(this);
-}
-inline Instruction::op_iterator       Instruction::op_end()         {
-  return op_iterator(this,true);
-}
-inline Instruction::op_const_iterator Instruction::op_end()   const {
-  return op_const_iterator(this,true);
-}
-
-
 #endif
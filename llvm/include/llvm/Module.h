@@ -10,12 +10,14 @@
 
 #include "llvm/SymTabValue.h"
 class Method;
+class TypeContext;
 
 class Module : public SymTabValue {
 public:
   typedef ValueHolder<Method, Module> MethodListType;
 private:
   MethodListType MethodList;     // The Methods
+  TypeContext *Context;          // The context that owns the module's types
 
 public:
   Module();
@@ -24,6 +26,12 @@ public:
   inline const MethodListType &getMethodList() const  { return MethodList; }
   inline       MethodListType &getMethodList()        { return MethodList; }
 
+  // getTypeContext - Return the TypeContext that was current when the module
+  // was created.  The types of the module live in it, so it must be current
+  // while the module is worked on.
+  //
+  inline TypeContext *getTypeContext() const { return Context; }
+
   // dropAllReferences() - This function causes all the subinstructions to "let
   // go" of all references that they are maintaining.  This allows one to
   // 'delete' a whole class at a time, even though there may be circular
@@ -5,6 +5,9 @@
 // Note that all optimizations return true if they modified the program, false
 // if not.
 //
+// Each optimization is also wrapped up as a Pass, so that it can be run by a
+// PassManager (see llvm/Pass.h).
+//
 //===----------------------------------------------------------------------===//
 
 #ifndef LLVM_OPT_ALLOPTS_H
@@ -12,6 +15,10 @@
 
 #include "llvm/Module.h"
 #include "llvm/BasicBlock.h"
+#include "llvm/Pass.h"
+#include "llvm/Analysis/Dominators.h"
+#include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/CallGraph.h"
 class Method;
 class CallInst;
 
@@ -35,6 +42,16 @@ bool DoDeadCodeElimination(Method *M);         // DCE a method
 bool DoRemoveUnusedConstants(SymTabValue *S);  // RUC a method or class
 bool DoDeadCodeElimination(Module *C);         // DCE & RUC a whole class
 
+struct DeadCodeElimination : public Pass {
+  virtual bool isParallelSafe() const { return true; }
+  virtual bool doPerMethodWork(Method *M) { return DoDeadCodeElimination(M); }
+  virtual bool doPassFinalization(Module *M) {
+    bool Changed = false;
+    while (DoRemoveUnusedConstants(M)) Changed = true;
+    return Changed;
+  }
+};
+
 //===----------------------------------------------------------------------===//
 // Constant Propogation Pass
 //
@@ -45,6 +62,139 @@ static inline bool DoConstantPropogation(Module *C) {
   return ApplyOptToAllMethods(C, DoConstantPropogation); 
 }
 
+struct ConstantPropogation : public Pass {
+  virtual bool isParallelSafe() const { return true; }
+  virtual bool doPerMethodWork(Method *M) { return DoConstantPropogation(M); }
+};
+
+//===----------------------------------------------------------------------===//
+// CFG Simplification Pass
+//
+
+// DoCFGSimplification - Remove empty forwarding blocks, fold branches and
+// switches that have only one place to go, and hoist code that both arms of a
+// branch start with.  The CFG is kept up to date.
+//
+bool DoCFGSimplification(Method *M, MethodCFG &CFG);
+
+// The predecessor lists that are edited do not keep the order that a new CFG
+// would have, which PHI nodes placed later would depend on, so the CFG is not
+// preserved...
+struct CFGSimplification : public Pass {
+  virtual bool isParallelSafe() const { return true; }
+  virtual void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired(&MethodCFG::ID);
+  }
+  virtual bool doPerMethodWork(Method *M) {
+    return DoCFGSimplification(M, getAnalysis<MethodCFG>(M));
+  }
+};
+
+//===----------------------------------------------------------------------===//
+// Promote Memory to Register Pass
+//
+
+// DoPromoteMemoryToRegister - Turn the allocas of a method that are only
+// loaded from and stored to into SSA values, inserting PHI nodes as needed.
+//
+bool DoPromoteMemoryToRegister(Method *M, DominatorTree &DT);
+
+// PHI nodes are added, but the CFG is not changed...
+struct PromoteMemoryToRegister : public Pass {
+  virtual bool isParallelSafe() const { return true; }
+  virtual void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired(&DominatorTree::ID).addPreserved(&DominatorTree::ID);
+    AU.addPreserved(&MethodCFG::ID).addPreserved(&LoopInfo::ID);
+  }
+  virtual bool doPerMethodWork(Method *M) {
+    return DoPromoteMemoryToRegister(M, getAnalysis<DominatorTree>(M));
+  }
+};
+
+//===----------------------------------------------------------------------===//
+// Instruction Combining Pass
+//
+
+// DoInstructionCombining - Apply algebraic simplifications to the operators of
+// a method.  The simplified instructions are deleted, but the instructions that
+// they used may be left dead.
+//
+bool DoInstructionCombining(Method *M);
+
+static inline bool DoInstructionCombining(Module *C) { 
+  return ApplyOptToAllMethods(C, DoInstructionCombining); 
+}
+
+// The CFG is not changed...
+struct InstructionCombining : public Pass {
+  virtual bool isParallelSafe() const { return true; }
+  virtual void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addPreserved(&MethodCFG::ID).addPreserved(&DominatorTree::ID);
+    AU.addPreserved(&LoopInfo::ID);
+  }
+  virtual bool doPerMethodWork(Method *M) { return DoInstructionCombining(M); }
+};
+
+//===----------------------------------------------------------------------===//
+// Global Value Numbering Pass
+//
+
+// DoGlobalValueNumbering - Replace each operator that computes the same value
+// as an operator in a dominating position with that operator.
+//
+bool DoGlobalValueNumbering(Method *M, DominatorTree &DT);
+
+// Only instructions are removed, so the CFG and the analyses of it are kept...
+struct GlobalValueNumbering : public Pass {
+  virtual bool isParallelSafe() const { return true; }
+  virtual void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired(&DominatorTree::ID).addPreserved(&DominatorTree::ID);
+    AU.addPreserved(&MethodCFG::ID).addPreserved(&LoopInfo::ID);
+  }
+  virtual bool doPerMethodWork(Method *M) {
+    return DoGlobalValueNumbering(M, getAnalysis<DominatorTree>(M));
+  }
+};
+
+//===----------------------------------------------------------------------===//
+// Loop Invariant Code Motion Pass
+//
+
+// DoLoopInvariantCodeMotion - Hoist the invariant arithmetic in the loops of a
+// method into preheaders.  LI is kept up to date.
+//
+bool DoLoopInvariantCodeMotion(Method *M, LoopInfo &LI);
+
+struct LoopInvariantCodeMotion : public Pass {
+  virtual bool isParallelSafe() const { return true; }
+  virtual void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired(&LoopInfo::ID).addPreserved(&LoopInfo::ID);
+  }
+  virtual bool doPerMethodWork(Method *M) {
+    return DoLoopInvariantCodeMotion(M, getAnalysis<LoopInfo>(M));
+  }
+};
+
+//===----------------------------------------------------------------------===//
+// Tail Recursion Elimination Pass
+//
+
+// DoTailRecursionElimination - Turn calls of a method to itself that are
+// followed by a return of their result into branches to a loop header.
+//
+bool DoTailRecursionElimination(Method *M);
+
+static inline bool DoTailRecursionElimination(Module *C) { 
+  return ApplyOptToAllMethods(C, DoTailRecursionElimination); 
+}
+
+struct TailRecursionElimination : public Pass {
+  virtual bool isParallelSafe() const { return true; }
+  virtual bool doPerMethodWork(Method *M) {
+    return DoTailRecursionElimination(M);
+  }
+};
+
 //===----------------------------------------------------------------------===//
 // Method Inlining Pass
 //
@@ -58,6 +208,10 @@ static inline bool DoMethodInlining(Module *C) {
   return ApplyOptToAllMethods(C, DoMethodInlining); 
 }
 
+struct MethodInlining : public Pass {
+  virtual bool doPerMethodWork(Method *M) { return DoMethodInlining(M); }
+};
+
 // InlineMethod - This function forcibly inlines the called method into the
 // basic block of the caller.  This returns true if it is not possible to inline
 // this call.  The program is still in a well defined state if this occurs 
@@ -72,6 +226,88 @@ bool InlineMethod(CallInst *C);
 bool InlineMethod(BasicBlock::InstListType::iterator CI);// *CI must be CallInst
 
 
+//===----------------------------------------------------------------------===//
+// Dead Method Elimination Pass
+//
+
+// isRootMethod - Return true if M is one of the methods named in Roots, which
+// may be called from outside of the module.
+//
+bool isRootMethod(const Method *M, const vector<string> &Roots);
+
+// DefinesRootMethod - Return true if M defines one of the methods named in
+// Roots.  If it does not, the interprocedural passes know nothing about how the
+// module is entered, and leave it alone.
+//
+bool DefinesRootMethod(Module *M, const vector<string> &Roots);
+
+// DoDeadMethodElimination - Delete the methods of the module that can not be
+// reached in the call graph from the methods named in Roots, which are the
+// ones that may be called from outside of the module.
+//
+bool DoDeadMethodElimination(Module *M, CallGraph &CG,
+                             const vector<string> &Roots);
+
+struct DeadMethodElimination : public Pass {
+  vector<string> Roots;
+  DeadMethodElimination(const vector<string> &R) : Roots(R) {}
+
+  virtual bool isModulePass() const { return true; }
+  virtual void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addRequired(&CallGraph::ID);
+  }
+  virtual bool doPassInitialization(Module *M) {
+    return DoDeadMethodElimination(M, getAnalysis<CallGraph>(), Roots);
+  }
+};
+
+//===----------------------------------------------------------------------===//
+// Dead Argument Elimination Pass
+//
+
+// DoDeadArgumentElimination - Remove the arguments that are never used from
+// the methods of the module, except for the methods named in Roots, and stop
+// passing them at every call site.
+//
+bool DoDeadArgumentElimination(Module *M, const vector<string> &Roots);
+
+// Calls are replaced, so the call graph has to be rebuilt...
+struct DeadArgumentElimination : public Pass {
+  vector<string> Roots;
+  DeadArgumentElimination(const vector<string> &R) : Roots(R) {}
+
+  virtual bool isModulePass() const { return true; }
+  virtual void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.addPreserved(&MethodCFG::ID).addPreserved(&DominatorTree::ID);
+    AU.addPreserved(&LoopInfo::ID);
+  }
+  virtual bool doPassInitialization(Module *M) {
+    return DoDeadArgumentElimination(M, Roots);
+  }
+};
+
+
+//===----------------------------------------------------------------------===//
+// Interprocedural Constant Propagation Pass
+//
+
+// DoIPConstantPropagation - Replace the arguments of the methods of the module
+// that are passed the same constant at every call with that constant, and fold
+// the methods that change.  The methods named in Roots are left alone, because
+// they may be called from outside of the module.
+//
+bool DoIPConstantPropagation(Module *M, const vector<string> &Roots);
+
+struct IPConstantPropagation : public Pass {
+  vector<string> Roots;
+  IPConstantPropagation(const vector<string> &R) : Roots(R) {}
+
+  virtual bool isModulePass() const { return true; }
+  virtual bool doPassInitialization(Module *M) {
+    return DoIPConstantPropagation(M, Roots);
+  }
+};
+
 //===----------------------------------------------------------------------===//
 // Symbol Stripping Pass
 //
@@ -92,4 +328,24 @@ static inline bool DoSymbolStripping(Module *M) {
 //
 bool DoFullSymbolStripping(Module *M);
 
+// Stripping symbols only changes names, so no analyses are invalidated...
+//
+struct SymbolStripping : public Pass {
+  virtual bool isParallelSafe() const { return true; }
+  virtual bool doPerMethodWork(Method *M) { return DoSymbolStripping(M); }
+  virtual void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.setPreservesAll();
+  }
+};
+
+struct FullSymbolStripping : public Pass {
+  virtual bool isModulePass() const { return true; }
+  virtual bool doPassInitialization(Module *M) {
+    return DoFullSymbolStripping(M);
+  }
+  virtual void getAnalysisUsage(AnalysisUsage &AU) const {
+    AU.setPreservesAll();
+  }
+};
+
 #endif
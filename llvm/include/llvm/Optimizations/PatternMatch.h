@@ -0,0 +1,161 @@
+//===-- llvm/Opt/PatternMatch.h - Tree pattern matching ----------*- C++ -*--=//
+//
+// This file provides a simple and efficient mechanism for performing general
+// tree-based pattern matches on the VM representation.  This allows code to be
+// written in the form of the pattern that it is looking for, which is much
+// easier to read than a long series of tests and casts.  For example:
+//
+//   Value *X, *Y;
+//   if (match(I, m_Add(m_Value(X), m_Zero())))  // Is I "X + 0"?
+//     ... X is bound here ...
+//   if (match(I, m_Not(m_Not(m_Value(X)))))     // Is I "not (not X)"?
+//     ... X is bound here ...
+//
+// Patterns are plain structs with a match(Value*) method, so they are built on
+// the stack and inlined away.  A pattern binds its values as it goes, so they
+// are only meaningful when the whole match succeeds.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_OPT_PATTERNMATCH_H
+#define LLVM_OPT_PATTERNMATCH_H
+
+#include "llvm/Instruction.h"
+#include "llvm/ConstPoolVals.h"
+
+template<class Pattern>
+inline bool match(Value *V, const Pattern &P) {
+  return const_cast<Pattern&>(P).match(V);
+}
+
+//===----------------------------------------------------------------------===//
+// Matchers for leaves of the tree
+//
+
+struct leaf_ty {
+  inline bool match(Value *V) { return true; }
+};
+
+// m_Value() - Match any value.
+inline leaf_ty m_Value() { return leaf_ty(); }
+
+struct bind_ty {
+  Value *&VR;
+  inline bind_ty(Value *&V) : VR(V) {}
+  inline bool match(Value *V) { VR = V; return true; }
+};
+
+// m_Value(X) - Match any value, and bind it to X.
+inline bind_ty m_Value(Value *&V) { return bind_ty(V); }
+
+struct specific_ty {
+  const Value *Val;
+  inline specific_ty(const Value *V) : Val(V) {}
+  inline bool match(Value *V) { return V == Val; }
+};
+
+// m_Specific(X) - Match only the value X.
+inline specific_ty m_Specific(const Value *V) { return specific_ty(V); }
+
+struct constant_int_ty {
+  int64_t Val;
+  inline constant_int_ty(int64_t V) : Val(V) {}
+  bool match(Value *V) {
+    if (V->getValueType() != Value::ConstantVal) return false;
+    if (V->getType()->isSigned())
+      return ((ConstPoolSInt*)V)->getValue() == Val;
+    if (V->getType()->isUnsigned())
+      return ((ConstPoolUInt*)V)->getValue() == (uint64_t)Val;
+    return false;
+  }
+};
+
+// m_Zero(), m_One() - Match an integer constant of any type with the value 0
+// or 1.  Floating point constants are not matched, because identities such as
+// x+0 == x do not hold for them.
+//
+inline constant_int_ty m_Zero() { return constant_int_ty(0); }
+inline constant_int_ty m_One()  { return constant_int_ty(1); }
+
+//===----------------------------------------------------------------------===//
+// Matchers for operators
+//
+
+template<class OpTy, unsigned Opcode>
+struct UnaryOp_match {
+  OpTy Op;
+  inline UnaryOp_match(const OpTy &O) : Op(O) {}
+  bool match(Value *V) {
+    if (V->getValueType() != Value::InstructionVal) return false;
+    Instruction *I = (Instruction*)V;
+    return I->getInstType() == Opcode && Op.match(I->getOperand(0));
+  }
+};
+
+template<class OpTy>
+inline UnaryOp_match<OpTy, Instruction::Neg> m_Neg(const OpTy &Op) {
+  return UnaryOp_match<OpTy, Instruction::Neg>(Op);
+}
+template<class OpTy>
+inline UnaryOp_match<OpTy, Instruction::Not> m_Not(const OpTy &Op) {
+  return UnaryOp_match<OpTy, Instruction::Not>(Op);
+}
+
+template<class LHS_t, class RHS_t, unsigned Opcode>
+struct BinaryOp_match {
+  LHS_t L;
+  RHS_t R;
+  inline BinaryOp_match(const LHS_t &LHS, const RHS_t &RHS)
+    : L(LHS), R(RHS) {}
+  bool match(Value *V) {
+    if (V->getValueType() != Value::InstructionVal) return false;
+    Instruction *I = (Instruction*)V;
+    return I->getInstType() == Opcode && L.match(I->getOperand(0)) &&
+           R.match(I->getOperand(1));
+  }
+};
+
+#define BINARY_MATCHER(NAME, OPCODE)                                        \
+  template<class LHS, class RHS>                                            \
+  inline BinaryOp_match<LHS, RHS, Instruction::OPCODE>                      \
+  NAME(const LHS &L, const RHS &R) {                                        \
+    return BinaryOp_match<LHS, RHS, Instruction::OPCODE>(L, R);             \
+  }
+
+BINARY_MATCHER(m_Add, Add)
+BINARY_MATCHER(m_Sub, Sub)
+BINARY_MATCHER(m_Mul, Mul)
+BINARY_MATCHER(m_Div, Div)
+BINARY_MATCHER(m_Rem, Rem)
+BINARY_MATCHER(m_And, And)
+BINARY_MATCHER(m_Or,  Or)
+BINARY_MATCHER(m_Xor, Xor)
+
+#undef BINARY_MATCHER
+
+template<class LHS_t, class RHS_t>
+struct SetCond_match {
+  unsigned &Opcode;
+  LHS_t L;
+  RHS_t R;
+  inline SetCond_match(unsigned &Op, const LHS_t &LHS, const RHS_t &RHS)
+    : Opcode(Op), L(LHS), R(RHS) {}
+  bool match(Value *V) {
+    if (V->getValueType() != Value::InstructionVal) return false;
+    Instruction *I = (Instruction*)V;
+    if (I->getInstType() < Instruction::SetEQ ||
+        I->getInstType() > Instruction::SetGT)
+      return false;
+    Opcode = I->getInstType();
+    return L.match(I->getOperand(0)) && R.match(I->getOperand(1));
+  }
+};
+
+// m_SetCond(Op, L, R) - Match any setcc instruction, binding its opcode to Op.
+template<class LHS, class RHS>
+inline SetCond_match<LHS, RHS> m_SetCond(unsigned &Op, const LHS &L,
+                                         const RHS &R) {
+  return SetCond_match<LHS, RHS>(Op, L, R);
+}
+
+#endif
@@ -0,0 +1,210 @@
+//===- llvm/Pass.h - Base class for passes and the pass manager --*- C++ -*--=//
+//
+// This file defines the Pass class, which all optimizations and analyses that
+// are run by a PassManager derive from, and the PassManager itself.
+//
+// A pass is run in three stages: doPassInitialization is called once on the
+// module, doPerMethodWork is called once for every method in the module, and
+// doPassFinalization is called once on the module at the end.  Each returns
+// true if it modified the program.
+//
+// Consecutive passes are pipelined by the PassManager: each method is run
+// through all of the passes in turn before the next method is started, so that
+// the method stays in cache while it is being worked on.  Passes that need to
+// see the whole module between their stages may opt out of this by returning
+// true from isModulePass.
+//
+// The PassManager may also run the methods through a pipeline on several
+// threads at once, if every pass in the pipeline says that this is safe by
+// returning true from isParallelSafe.
+//
+// Passes also declare the analyses that they use, and the analyses that they
+// keep up to date, through getAnalysisUsage.  The PassManager caches analysis
+// results, and throws them away when a pass modifies the program without
+// preserving them.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_PASS_H
+#define LLVM_PASS_H
+
+#include <vector>
+#include <map>
+#include <utility>
+#include "llvm/Tools/Mutex.h"
+class Module;
+class Method;
+class PassManager;
+class ThreadPool;
+
+//===----------------------------------------------------------------------===//
+// Analysis results
+//
+
+// AnalysisResult - The base class of all cached analysis results.
+//
+class AnalysisResult {
+public:
+  virtual ~AnalysisResult() {}
+};
+
+// AnalysisInfo - Every analysis has a single static AnalysisInfo object,
+// whose address identifies the analysis.  Method level analyses are computed
+// for one method at a time, and module level analyses are computed for the
+// whole module (and passed a null method).
+//
+struct AnalysisInfo {
+  const char *Name;
+  bool isMethodAnalysis;
+  AnalysisResult *(*Create)(Module *M, Method *Meth);
+};
+
+typedef const AnalysisInfo *AnalysisID;
+
+// AnalysisUsage - Filled in by Pass::getAnalysisUsage to describe the analyses
+// that a pass requires, and the ones that it leaves valid when it modifies the
+// program.
+//
+class AnalysisUsage {
+  vector<AnalysisID> Required, Preserved;
+  bool PreservesAll;
+public:
+  AnalysisUsage() : PreservesAll(false) {}
+
+  inline AnalysisUsage &addRequired(AnalysisID ID) {
+    Required.push_back(ID); return *this;
+  }
+  inline AnalysisUsage &addPreserved(AnalysisID ID) {
+    Preserved.push_back(ID); return *this;
+  }
+
+  // setPreservesAll - The pass does not change anything that any analysis
+  // depends on (for example, it only changes names).
+  //
+  inline void setPreservesAll() { PreservesAll = true; }
+
+  inline const vector<AnalysisID> &getRequired() const { return Required; }
+  bool isPreserved(AnalysisID ID) const;
+};
+
+
+//===----------------------------------------------------------------------===//
+// Pass class
+//
+
+class Pass {
+  friend class PassManager;
+  PassManager *Resolver;               // Set while the pass is being run
+public:
+  Pass() : Resolver(0) {}
+  virtual ~Pass() {}
+
+  virtual bool doPassInitialization(Module *M) { return false; }
+  virtual bool doPerMethodWork(Method *M) { return false; }
+  virtual bool doPassFinalization(Module *M) { return false; }
+
+  // getAnalysisUsage - Declare the analyses used and preserved by this pass.
+  // The default is to use none and preserve none.
+  //
+  virtual void getAnalysisUsage(AnalysisUsage &AU) const {}
+
+  // isModulePass - Return true if this pass may not be pipelined with its
+  // neighbours, because it needs the whole module to be in a consistent state
+  // before and after it runs.
+  //
+  virtual bool isModulePass() const { return false; }
+
+  // isParallelSafe - Return true if doPerMethodWork may be run on different
+  // methods at the same time.  It must only change the method that it is 
+  // given (and that method's constant pool), and it must not require any 
+  // module level analyses that it does not declare in getAnalysisUsage.
+  //
+  virtual bool isParallelSafe() const { return false; }
+
+protected:
+  // getAnalysis - Return the cached result of a required analysis, computing
+  // it first if need be.  Method level analyses are computed for the
+  // specified method.  For example:
+  //
+  //   const CallGraph &CG = getAnalysis<CallGraph>();
+  //
+  template<class AnalysisType>
+  AnalysisType &getAnalysis(Method *M = 0) const {
+    return *(AnalysisType*)getAnalysisResult(&AnalysisType::ID, M);
+  }
+
+private:
+  AnalysisResult *getAnalysisResult(AnalysisID ID, Method *M) const;
+};
+
+
+//===----------------------------------------------------------------------===//
+// PassManager class
+//
+
+class PassManager {
+  vector<Pass*> Passes;
+  vector<bool>  Changed;            // Did Passes[i] modify the program?
+
+  // The analysis cache.  Module level analyses are stored with a null method.
+  // The method comes first in the key, so that the analyses of one method are
+  // next to each other.
+  //
+  typedef map<pair<const Method*, AnalysisID>, AnalysisResult*> CacheType;
+  CacheType Cache;
+  Mutex CacheLock;                  // Protects Cache while running in parallel
+  Module *CurModule;
+
+  ThreadPool *Pool;                 // Null unless running with several threads
+  bool InParallel;                  // Are methods being run in parallel now?
+
+  PassManager(const PassManager &);             // Do not implement
+  void operator=(const PassManager &);          // Do not implement
+public:
+  PassManager() : CurModule(0), Pool(0), InParallel(false) {}
+  ~PassManager();                   // Deletes all of the passes
+
+  // setNumThreads - Set the number of threads to run pipelines of parallel 
+  // safe passes with.  The default is one.  The result of running the passes
+  // is the same whatever the number of threads.
+  //
+  void setNumThreads(unsigned NumThreads);
+
+  // add - Add a pass to the end of the pipeline.  The PassManager takes
+  // ownership of the pass.
+  //
+  void add(Pass *P) { Passes.push_back(P); Changed.push_back(false); }
+
+  // run - Run all of the passes on the module, returning true if any of them
+  // modified it.
+  //
+  bool run(Module *M);
+
+  // passChanged - Return true if the specified pass modified the program the
+  // last time that run was called.
+  //
+  bool passChanged(unsigned PassNo) const { return Changed[PassNo]; }
+
+  // getAnalysis - Return the result of the specified analysis for the method,
+  // or for the module if the method is null.
+  //
+  AnalysisResult *getAnalysis(AnalysisID ID, Method *M);
+
+private:
+  friend struct ParallelPipeline;
+  void runPipeline(unsigned First, unsigned Last, Module *M);
+  void runPipelineInParallel(unsigned First, unsigned Last, Module *M,
+                             const vector<AnalysisUsage> &Usage);
+  void runMethodThroughPipeline(unsigned First, unsigned Last, Method *Meth,
+                                const vector<AnalysisUsage> &Usage, 
+                                unsigned char *PassChanged);
+  void invalidate(const Pass *P, const Method *M, bool MethodOnly = false);
+  void dropAnalyses(const Method *M, const AnalysisUsage &AU);
+  void clearCache();
+};
+
+inline AnalysisResult *Pass::getAnalysisResult(AnalysisID ID, Method *M) const{
+  return Resolver->getAnalysis(ID, M);
+}
+
+#endif
@@ -14,7 +14,8 @@
 #include <vector>
 #include <map>
 
-class SlotCalculator : public ModuleAnalyzer {
+class SlotCalculator : public ModuleAnalyzer<SlotCalculator> {
+  friend class ModuleAnalyzer<SlotCalculator>;
   const Module *TheModule;
   bool IgnoreNamedNodes;     // Shall we not count named nodes?
 
@@ -58,39 +59,39 @@ protected:
   // visitMethod - This member is called after the constant pool has been 
   // processed.  The default implementation of this is a noop.
   //
-  virtual bool visitMethod(const Method *M);
+  bool visitMethod(const Method *M);
 
   // processConstant is called once per each constant in the constant pool.  It
   // traverses the constant pool such that it visits each constant in the
   // order of its type.  Thus, all 'int' typed constants shall be visited 
   // sequentially, etc...
   //
-  virtual bool processConstant(const ConstPoolVal *CPV);
+  bool processConstant(const ConstPoolVal *CPV);
 
   // processType - This callback occurs when an derived type is discovered
   // at the class level. This activity occurs when processing a constant pool.
   //
-  virtual bool processType(const Type *Ty);
+  bool processType(const Type *Ty);
 
   // processMethods - The default implementation of this method loops through 
   // all of the methods in the module and processModule's them.  We don't want
   // this (we want to explicitly visit them with incorporateMethod), so we 
   // disable it.
   //
-  virtual bool processMethods(const Module *M) { return false; }
+  bool processMethods(const Module *M) { return false; }
 
   // processMethodArgument - This member is called for every argument that 
   // is passed into the method.
   //
-  virtual bool processMethodArgument(const MethodArgument *MA);
+  bool processMethodArgument(const MethodArgument *MA);
 
   // processBasicBlock - This member is called for each basic block in a methd.
   //
-  virtual bool processBasicBlock(const BasicBlock *BB);
+  bool processBasicBlock(const BasicBlock *BB);
 
   // processInstruction - This member is called for each Instruction in a methd.
   //
-  virtual bool processInstruction(const Instruction *I);
+  bool processInstruction(const Instruction *I);
 };
 
 #endif
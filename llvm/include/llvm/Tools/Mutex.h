@@ -0,0 +1,47 @@
+//===-- Mutex.h - Simple wrappers around pthread mutexes ---------*- C++ -*--=//
+//
+// This file defines a Mutex class, which is a thin wrapper around a pthread
+// mutex, and a MutexLocker class, which holds a Mutex for the lifetime of a
+// scope.  Programs that use these must link with -lpthread.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_TOOLS_MUTEX_H
+#define LLVM_TOOLS_MUTEX_H
+
+#include <pthread.h>
+
+class Mutex {
+  pthread_mutex_t M;
+
+  Mutex(const Mutex &);                // Do not implement
+  void operator=(const Mutex &);       // Do not implement
+public:
+  // Mutex ctor - A recursive mutex may be acquired again by the thread that
+  // already holds it.
+  //
+  Mutex(bool Recursive = false) {
+    pthread_mutexattr_t Attr;
+    pthread_mutexattr_init(&Attr);
+    if (Recursive)
+      pthread_mutexattr_settype(&Attr, PTHREAD_MUTEX_RECURSIVE);
+    pthread_mutex_init(&M, &Attr);
+    pthread_mutexattr_destroy(&Attr);
+  }
+  ~Mutex() { pthread_mutex_destroy(&M); }
+
+  inline void acquire() { pthread_mutex_lock(&M); }
+  inline void release() { pthread_mutex_unlock(&M); }
+};
+
+// MutexLocker - Acquire the specified mutex when constructed, and release it
+// when destroyed.
+//
+class MutexLocker {
+  Mutex &M;
+public:
+  inline MutexLocker(Mutex &m) : M(m) { M.acquire(); }
+  inline ~MutexLocker() { M.release(); }
+};
+
+#endif
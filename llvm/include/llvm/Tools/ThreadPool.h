@@ -0,0 +1,71 @@
+//===-- ThreadPool.h - Run independent tasks on several threads --*- C++ -*--=//
+//
+// This file defines the ThreadPool class, which runs a numbered set of 
+// independent tasks on a fixed set of threads.  The threads are started when 
+// the pool is created and wait for work between calls to run.
+//
+// Work is shared out by stealing: each thread starts with a contiguous range of
+// the task numbers, and a thread that runs out of work takes the upper half of
+// the range of another thread.  Neighbouring tasks therefore tend to run on the
+// same thread, and no thread sits idle while work remains.
+//
+// The order that tasks run in is not defined, so tasks must not depend on each
+// other.  Programs that use this must link with -lpthread.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_TOOLS_THREADPOOL_H
+#define LLVM_TOOLS_THREADPOOL_H
+
+#include "llvm/Tools/Mutex.h"
+#include <vector>
+
+class ThreadPool {
+public:
+  typedef void (*TaskFn)(void *Arg, unsigned TaskNo);
+
+  // ThreadPool ctor - NumThreads counts the thread that calls run, so a pool 
+  // with one thread starts no threads at all.
+  //
+  ThreadPool(unsigned NumThreads);
+  ~ThreadPool();
+
+  inline unsigned getNumThreads() const { return Queues.size(); }
+
+  // run - Call Fn(Arg, i) for each i in [0, NumTasks), and return when all of
+  // the calls have finished.
+  //
+  void run(unsigned NumTasks, TaskFn Fn, void *Arg);
+
+  // getDefaultNumThreads - Return the number of processors online.
+  static unsigned getDefaultNumThreads();
+
+private:
+  // WorkQueue - The tasks [Begin, End) are waiting to be run by a thread.
+  struct WorkQueue {
+    Mutex Lock;
+    unsigned Begin, End;
+    WorkQueue() : Begin(0), End(0) {}
+  };
+  vector<WorkQueue*> Queues;          // One per thread, the caller is number 0
+  vector<pthread_t>  Threads;
+
+  // The current job, and the state used to hand it to the threads...
+  TaskFn CurFn;
+  void  *CurArg;
+  pthread_mutex_t StateLock;
+  pthread_cond_t  WorkReady, WorkDone;
+  unsigned Generation;                // Bumped each time a job is started
+  unsigned NumBusy;                   // Threads still working on the job
+  bool     ShuttingDown;
+
+  ThreadPool(const ThreadPool &);     // Do not implement
+  void operator=(const ThreadPool &); // Do not implement
+
+  static void *threadMain(void *Arg);
+  void workerLoop(unsigned ThreadNo);
+  void doWork(unsigned ThreadNo);
+  bool getTask(unsigned ThreadNo, unsigned &TaskNo);
+};
+
+#endif
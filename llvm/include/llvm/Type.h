@@ -57,9 +57,12 @@ public:
 private:
   PrimitiveID ID;    // The current base type of this type...
   unsigned    UID;   // The unique ID number for this class
+  friend class TypeContext;   // TypeContext::renumberTypes changes UIDs
 
-  // ConstRulesImpl - See Opt/ConstantHandling.h for more info
-  mutable const ConstRules *ConstRulesImpl;
+  // ConstRulesImpl - See Opt/ConstantHandling.h for more info.  This is set
+  // by the ctor, before any other thread can see the type.
+  //
+  const ConstRules *ConstRulesImpl;
 
 protected:
   // ctor is protected, so only subclasses can create Type objects...
@@ -76,6 +79,9 @@ public:
   // 
   virtual bool isUnsigned() const { return 0; }
   
+  // getUniqueID - Derived type UIDs are only unique within the TypeContext
+  // that the type was created in (see llvm/TypeContext.h).
+  //
   inline unsigned getUniqueID() const { return UID; }
   inline PrimitiveID getPrimitiveID() const { return ID; }
 
@@ -87,7 +93,6 @@ public:
   // for more info on this...
   //
   inline const ConstRules *getConstRules() const { return ConstRulesImpl; }
-  inline void setConstRules(const ConstRules *R) const { ConstRulesImpl = R; }
 
 public:   // These are the builtin types that are always available...
   static const Type *VoidTy , *BoolTy;
@@ -0,0 +1,83 @@
+//===-- llvm/TypeContext.h - Own a set of derived types ----------*- C++ -*--=//
+//
+// This file defines the TypeContext class.  A TypeContext owns the derived
+// types (method, array, struct and pointer types) created in it, and hands out
+// their UIDs.  When the context is destroyed, all of its types are deleted.
+//
+// Each thread has a current context, and the getXXXType functions of the
+// derived types find or create types in it.  The default is the global
+// context, which lives forever.  A program that processes many modules can
+// give each one a context of its own, so that memory does not grow without
+// bound:
+//
+//   {
+//     TypeContext Ctx;
+//     TypeContext::Scope S(&Ctx);     // Types are now created in Ctx
+//     Module *M = ParseBytecodeFile(...);
+//     ...
+//     delete M;                       // Delete the module before the context
+//   }                                 // All of the types of M are freed here
+//
+// Primitive types are shared by all contexts.  Each context numbers its
+// derived types from Type::FirstDerivedTyID up, so UIDs are only unique within
+// a context, and values from different contexts must not be mixed.  (The
+// getXXXType functions assert that the types that they are given are primitive
+// or come from the current context.)
+//
+// A context allocates its tables as types are added to it, so contexts that
+// hold few types are cheap.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_TYPECONTEXT_H
+#define LLVM_TYPECONTEXT_H
+
+struct TypeContextImpl;
+
+class TypeContext {
+  TypeContextImpl *Impl;
+
+  TypeContext(const TypeContext &);             // Do not implement
+  void operator=(const TypeContext &);          // Do not implement
+public:
+  TypeContext();
+  ~TypeContext();              // Deletes all of the types in the context
+
+  // getCurrent - Return the current context of this thread.
+  static TypeContext *getCurrent();
+
+  // getGlobal - Return the context that is current when no other one is.
+  static TypeContext *getGlobal();
+
+  // Scope - Make a context the current context of this thread for as long as
+  // the Scope object lives.
+  //
+  class Scope {
+    TypeContext *Old;
+  public:
+    Scope(TypeContext *Ctx);
+    ~Scope();
+  };
+
+  // getNextUID - Return the UID that the next type created in the context will
+  // get.  All of the types created after this call get this UID or a higher
+  // one.
+  //
+  unsigned getNextUID() const;
+
+  // renumberTypes - Give the types created in the context since FirstUID was
+  // returned by getNextUID new UIDs, in an order that only depends on what the
+  // types are: by name, with each type after the types that it is made of.
+  // The asm parser uses this so that the UIDs (and so the order of constant
+  // pool planes) do not depend on how many threads parsed the file, or in what
+  // order they ran.  No other thread may use the context while this runs, and
+  // the constant pools that hold constants of the renumbered types must be
+  // sorted again afterwards (ConstantPool::sortPlanes).
+  //
+  void renumberTypes(unsigned FirstUID);
+
+  // getImpl - The tables of the context, for use by Type.cpp only.
+  inline TypeContextImpl *getImpl() const { return Impl; }
+};
+
+#endif
@@ -13,9 +13,21 @@
 #define LLVM_USER_H
 
 #include "llvm/Value.h"
+#include <map>
 
 class User : public Value {
   User(const User &);             // Do not implement
+protected:
+  // The operands of the user.  Users with a fixed number of operands keep them
+  // in an array member of the subclass, so that they are allocated together
+  // with the user.  Users that may have any number of operands (PHI nodes,
+  // calls, switches and aggregate constants) keep them in a vector, and must
+  // update Operands whenever the vector is resized.  Subclasses must set these
+  // in their constructors, they start out empty.
+  //
+  Use *Operands;
+  unsigned NumOperands;
+
 public:
   User(const Type *Ty, ValueTy vty, const string &name = "");
   virtual ~User() {}
@@ -24,8 +36,13 @@ public:
   // returns false.  setOperand() may also return false if the operand is of
   // the wrong type.
   //
-  virtual Value *getOperand(unsigned i) = 0;
-  virtual const Value *getOperand(unsigned i) const = 0;
+  inline Value *getOperand(unsigned i) {
+    return i < NumOperands ? (Value*)Operands[i] : 0;
+  }
+  inline const Value *getOperand(unsigned i) const {
+    return i < NumOperands ? (const Value*)Operands[i] : 0;
+  }
+  inline unsigned getNumOperands() const { return NumOperands; }
   virtual bool setOperand(unsigned i, Value *Val) = 0;
 
   // dropAllReferences() - This virtual function should be overridden to "let
@@ -42,6 +59,21 @@ public:
   // references to the "To" definition.  (defined in Value.cpp)
   //
   void replaceUsesOfWith(Value *From, Value *To);
+
+  // replaceUsesOfWith - Replace each operand that is a key of ValueMap with the
+  // value that it maps to, in one walk over the operands.  Returns the number
+  // of operands that were found in the map.  (defined in Value.cpp)
+  //
+  unsigned replaceUsesOfWith(const map<const Value*, Value*> &ValueMap);
+
+  // replaceAllUses - Replace all uses of each key of ValueMap with the value 
+  // that it maps to.  This is like calling replaceAllUsesWith on every key,
+  // but each user of the keys is only visited once, however many of them it
+  // uses.  The values are all replaced at once, so a value that is both a key
+  // and the value of some other key is not replaced in the uses that it gets.
+  // (defined in Value.cpp)
+  //
+  static void replaceAllUses(const map<const Value*, Value*> &ValueMap);
 };
 
 #endif
@@ -34,23 +34,34 @@ public:
 
 private:
   list<User *> Uses;
-  string Name;
+  string *Name;                      // Null if the value has no name
   const Type *Ty;
-  ValueTy VTy;
+  unsigned char VTy;                 // The ValueTy of the value
+
+  static const string EmptyName;     // What getName returns with no name
 
   Value(const Value &);              // Do not implement
 protected:
+  // SubclassData - Space that is left over next to VTy, for subclasses to keep
+  // a small field in without making the object larger.  Instruction keeps its
+  // opcode here.
+  //
+  unsigned short SubclassData;
+
   inline void setType(const Type *ty) { Ty = ty; }
 public:
   Value(const Type *Ty, ValueTy vty, const string &name = "");
   virtual ~Value();
 
   inline const Type *getType() const { return Ty; }
-  inline ValueTy getValueType() const { return VTy; }
+  inline ValueTy getValueType() const { return (ValueTy)VTy; }
 
-  inline bool hasName() const { return Name != ""; }
-  inline const string &getName() const { return Name; }
-  virtual void setName(const string &name) { Name = name; }
+  // Most values are not named, so the name is kept out of line, and is only
+  // allocated when the value is given one.
+  //
+  inline bool hasName() const { return Name != 0; }
+  inline const string &getName() const { return Name ? *Name : EmptyName; }
+  virtual void setName(const string &name);
 
 
   // replaceAllUsesWith - Go through the uses list for this definition and make
@@ -65,7 +76,7 @@ public:
   typedef list<User*>::iterator       use_iterator;
   typedef list<User*>::const_iterator use_const_iterator;
 
-  inline bool               use_size()  const { return Uses.size();  }
+  inline unsigned           use_size()  const { return Uses.size();  }
   inline bool               use_empty() const { return Uses.empty(); }
   inline use_iterator       use_begin()       { return Uses.begin(); }
   inline use_const_iterator use_begin() const { return Uses.begin(); }
@@ -75,8 +86,31 @@ public:
   inline void use_push_back(User *I)   { Uses.push_back(I); }
   User *use_remove(use_iterator &I);
 
-  inline void addUse(User *I)      { Uses.push_back(I); }
+  inline void addUse(User *I) { 
+    if (LockUseLists) lockedAddUse(I); else Uses.push_back(I);
+  }
   void killUse(User *I);
+
+  // LockUseLists - Set while several threads are modifying methods at once 
+  // (see PassManager).  Module level values, such as methods and module 
+  // constants, are used by every method, so while this is set addUse and 
+  // killUse take a lock on the use list that they change.  Nothing else about 
+  // the use list is protected: a thread may only walk or replace the uses of 
+  // values local to the method that it is working on.  The PassManager puts
+  // the shared use lists back into a fixed order once the threads are done.
+  //
+  static bool LockUseLists;
+
+  // InBulkTeardown - Set while this thread is deleting a whole module (see
+  // Module::~Module).  Every value used by the dying values is dying too, so
+  // use lists and symbol tables are not kept up to date, and uses do not
+  // unlink themselves.  The checks that values are unused and unnamed when
+  // they die are skipped while it is set.  Debug builds check instead that
+  // nothing outside of the module uses its methods and module constants.
+  //
+  static __thread bool InBulkTeardown;
+private:
+  void lockedAddUse(User *I);
 };
 
 // UseTy and it's friendly typedefs (Use) are here to make keeping the "use" 
@@ -92,7 +126,17 @@ public:
     if (Val) Val->addUse(U);
   }
 
-  inline ~UseTy<ValueSubclass>() { if (Val) Val->killUse(U); }
+  // The default ctor makes an empty use that does not belong to any user yet,
+  // for use in operand arrays.  init must be called on it before it is used,
+  // and may only be called once.
+  //
+  inline UseTy<ValueSubclass>() { Val = 0; U = 0; }
+  inline void init(ValueSubclass *V, User *user) {
+    U = user;
+    operator=(V);
+  }
+
+  inline ~UseTy<ValueSubclass>() { drop(); }
 
   inline operator ValueSubclass *() const { return Val; }
 
@@ -102,7 +146,7 @@ public:
     operator=(user);
   }
   inline ValueSubclass *operator=(ValueSubclass *V) { 
-    if (Val) Val->killUse(U);
+    drop();
     Val = V;
     if (V) V->addUse(U);
     return V;
@@ -112,11 +156,20 @@ public:
   inline const ValueSubclass *operator->() const { return Val; }
 
   inline UseTy<ValueSubclass> &operator=(const UseTy<ValueSubclass> &user) {
-    if (Val) Val->killUse(U);
+    drop();
     Val = user.Val;
-    Val->addUse(U);
+    if (Val) Val->addUse(U);
     return *this;
   }
+
+private:
+  // drop - Take this use off of the use list of the value.  When the whole
+  // graph is being deleted, the value may already be gone, so it is left
+  // alone.
+  //
+  inline void drop() {
+    if (Val && !Value::InBulkTeardown) Val->killUse(U);
+  }
 };
 
 typedef UseTy<Value> Use;
@@ -65,9 +65,9 @@ public:
   inline const_iterator end()   const { return ValueList.end();   }
 
   void delete_all() {            // Delete all removes and deletes all elements
-    // TODO: REMOVE FROM END OF VECTOR!!!
-    while (begin() != end()) {
-      iterator I = begin();
+    // Remove from the end of the vector, so that nothing has to be moved down.
+    while (!empty()) {
+      iterator I = end()-1;
       delete remove(I);          // Delete all instructions...
     }
   }
@@ -81,6 +81,12 @@ public:
 
   inline void push_front(ValueSubclass *Inst); // Defined in ValueHolderImpl.h
   inline void push_back(ValueSubclass *Inst);  // Defined in ValueHolderImpl.h
+
+  // ValueHolder::insert - This inserts the specified value *before* the element
+  // that the iterator points to, and leaves the iterator pointing to the new
+  // element.
+  //
+  void insert(iterator &Pos, ValueSubclass *Inst);  // In ValueHolderImpl.h
 };
 
 #endif
@@ -16,13 +16,11 @@ class ConstPoolType;
 
 class AllocationInst : public Instruction {
 protected:
-  UseTy<ConstPoolType> TyVal;
-  Use ArraySize;
+  Use Ops[2];       // The type constant, and the array size if there is one
 public:
   AllocationInst(ConstPoolType *tyVal, Value *arrSize, unsigned iTy, 
 		 const string &Name = "") 
-    : Instruction(tyVal->getValue(), iTy, Name),
-      TyVal(tyVal, this), ArraySize(arrSize, this) {
+    : Instruction(tyVal->getValue(), iTy, Name) {
 
     // Make sure they didn't try to specify a size for an invalid type...
     assert(arrSize == 0 || 
@@ -33,6 +31,10 @@ public:
     // Make sure that if a size is specified, that it is a uint!
     assert(arrSize == 0 || arrSize->getType() == Type::UIntTy &&
 	   "Malloc SIZE is not a 'uint'!");
+
+    Ops[0].init(tyVal, this);
+    Ops[1].init(arrSize, this);
+    Operands = Ops; NumOperands = 1+(arrSize != 0);
   }
   inline ~AllocationInst() {}
 
@@ -41,14 +43,16 @@ public:
     return (const PointerType*)Instruction::getType(); 
   }
 
+  inline ConstPoolType *getTypeConstant() const {
+    return (ConstPoolType*)(Value*)Ops[0];
+  }
+  inline Value *getArraySize() const { return Ops[1]; }
+
   virtual Instruction *clone() const = 0;
 
-  inline virtual void dropAllReferences() { TyVal = 0; ArraySize = 0; }
   virtual bool setOperand(unsigned i, Value *Val) { 
     if (i == 0) {
       assert(!Val || Val->getValueType() == Value::ConstantVal);
-      TyVal = (ConstPoolType*)Val;
-      return true;
     } else if (i == 1) {
       // Make sure they didn't try to specify a size for an invalid type...
       assert(Val == 0 || 
@@ -59,17 +63,13 @@ public:
       // Make sure that if a size is specified, that it is a uint!
       assert(Val == 0 || Val->getType() == Type::UIntTy &&
 	     "Malloc SIZE is not a 'uint'!");
-      
-      ArraySize = Val;
-      return true;
+    } else {
+      return false; 
     }
-    return false; 
-  }
-
-  virtual unsigned getNumOperands() const { return 2; }
 
-  virtual const Value *getOperand(unsigned i) const { 
-    return i == 0 ? TyVal : (i == 1 ? ArraySize : 0); 
+    Ops[i] = Val;
+    NumOperands = 1+(Ops[1] != 0);
+    return true;
   }
 };
 
@@ -81,10 +81,8 @@ public:
   inline ~MallocInst() {}
 
   virtual Instruction *clone() const { 
-    return new MallocInst(TyVal, ArraySize);
+    return new MallocInst(getTypeConstant(), getArraySize());
   }
-
-  virtual string getOpcode() const { return "malloc"; }
 };
 
 class AllocaInst : public AllocationInst {
@@ -95,46 +93,83 @@ public:
   inline ~AllocaInst() {}
 
   virtual Instruction *clone() const { 
-    return new AllocaInst(TyVal, ArraySize);
+    return new AllocaInst(getTypeConstant(), getArraySize());
   }
-
-  virtual string getOpcode() const { return "alloca"; }
 };
 
 
 
 class FreeInst : public Instruction {
 protected:
-  Use Pointer;
+  Use Ops[1];
 public:
   FreeInst(Value *Ptr, const string &Name = "") 
-    : Instruction(Type::VoidTy, Instruction::Free, Name),
-      Pointer(Ptr, this) {
+    : Instruction(Type::VoidTy, Instruction::Free, Name) {
 
     assert(Ptr->getType()->isPointerType() && "Can't free nonpointer!");
+    Ops[0].init(Ptr, this);
+    Operands = Ops; NumOperands = 1;
   }
   inline ~FreeInst() {}
 
-  virtual Instruction *clone() const { return new FreeInst(Pointer); }
+  virtual Instruction *clone() const { return new FreeInst(Ops[0]); }
+
+  virtual bool setOperand(unsigned i, Value *Val) { 
+    assert(i || !Val || Val->getType()->isPointerType() &&
+           "Can't free nonpointer!");
+    return Instruction::setOperand(i, Val);
+  }
+};
+
+
 
-  inline virtual void dropAllReferences() { Pointer = 0;  }
+//===----------------------------------------------------------------------===//
+//                            Load & Store Classes
+//===----------------------------------------------------------------------===//
+
+class LoadInst : public Instruction {
+protected:
+  Use Ops[1];       // The pointer to load from
+public:
+  LoadInst(Value *Ptr, const string &Name = "") 
+    : Instruction(((const PointerType*)Ptr->getType())->getValueType(),
+                  Instruction::Load, Name) {
+    assert(Ptr->getType()->isPointerType() && "Can't load from nonpointer!");
+    Ops[0].init(Ptr, this);
+    Operands = Ops; NumOperands = 1;
+  }
+  inline ~LoadInst() {}
+
+  virtual Instruction *clone() const { return new LoadInst(Ops[0]); }
+
+  inline Value *getPointerOperand() const { return Ops[0]; }
 
   virtual bool setOperand(unsigned i, Value *Val) { 
-    if (i == 0) {
-      assert(!Val || Val->getType()->isPointerType() &&
-	     "Can't free nonpointer!");
-      Pointer = Val;
-      return true;
-    }
-    return false; 
+    assert(i || !Val || Val->getType() == getPointerOperand()->getType() &&
+           "Can't change the type of the pointer loaded from!");
+    return Instruction::setOperand(i, Val);
   }
+};
 
-  virtual unsigned getNumOperands() const { return 1; }
-  virtual const Value *getOperand(unsigned i) const { 
-    return i == 0 ? Pointer : 0;
+class StoreInst : public Instruction {
+protected:
+  Use Ops[2];       // The value to store, then the pointer to store it to
+public:
+  StoreInst(Value *Val, Value *Ptr, const string &Name = "") 
+    : Instruction(Type::VoidTy, Instruction::Store, Name) {
+    assert(Ptr->getType() == PointerType::getPointerType(Val->getType()) &&
+           "Stored value does not match the pointer type!");
+    Ops[0].init(Val, this);
+    Ops[1].init(Ptr, this);
+    Operands = Ops; NumOperands = 2;
   }
+  inline ~StoreInst() {}
+
+  virtual Instruction *clone() const { return new StoreInst(Ops[0], Ops[1]); }
+  bool hasSideEffects() const { return true; }
 
-  virtual string getOpcode() const { return "free"; }
+  inline Value *getValueOperand() const { return Ops[0]; }
+  inline Value *getPointerOperand() const { return Ops[1]; }
 };
 
 #endif // LLVM_IMEMORY_H
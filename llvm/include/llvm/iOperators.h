@@ -21,8 +21,6 @@ public:
   AddInst(Value *S1, Value *S2, const string &Name = "")
       : BinaryOperator(Instruction::Add, S1, S2, Name) {
   }
-
-  virtual string getOpcode() const { return "add"; }
 };
 
 
@@ -31,18 +29,25 @@ public:
   SubInst(Value *S1, Value *S2, const string &Name = "") 
     : BinaryOperator(Instruction::Sub, S1, S2, Name) {
   }
+};
 
-  virtual string getOpcode() const { return "sub"; }
+
+// GenericBinaryInst - The binary operators that need nothing special: mul,
+// div, rem, and, or and xor.
+//
+class GenericBinaryInst : public BinaryOperator {
+public:
+  GenericBinaryInst(BinaryOps Opcode, Value *S1, Value *S2, 
+                    const string &Name = "")
+    : BinaryOperator(Opcode, S1, S2, Name) {
+  }
 };
 
 
 class SetCondInst : public BinaryOperator {
-  BinaryOps OpType;
 public:
   SetCondInst(BinaryOps opType, Value *S1, Value *S2, 
 	      const string &Name = "");
-
-  virtual string getOpcode() const;
 };
 
 #endif
@@ -28,6 +28,13 @@
 //
 // TOFIX: Store pair<Use,BasicBlockUse> instead of just <Use>
 //
+// Until then, a PHI node has one incoming value for each edge into its block,
+// in the order of the blocks in the method, and then in the order of each
+// block's successors.  This is the order of the predecessor lists of a
+// freshly built MethodCFG.  A pass that adds or removes an edge into a block
+// with PHI nodes, or moves one of the blocks that branch to it, has to update
+// the PHI nodes to match.
+//
 class PHINode : public Instruction {
   vector<Use> IncomingValues;
   PHINode(const PHINode &PN);
@@ -40,17 +47,22 @@ public:
   // Implement all of the functionality required by User...
   //
   virtual void dropAllReferences();
-  virtual const Value *getOperand(unsigned i) const { 
-    return (i < IncomingValues.size()) ? IncomingValues[i] : 0; 
+  virtual bool setOperand(unsigned i, Value *Val);
+
+  inline unsigned getNumIncomingValues() const { return IncomingValues.size();}
+  inline       Value *getIncomingValue(unsigned i)       {
+    return IncomingValues[i];
   }
-  inline Value *getOperand(unsigned i) {
-    return (Value*)((const PHINode*)this)->getOperand(i);
+  inline const Value *getIncomingValue(unsigned i) const {
+    return IncomingValues[i];
   }
-  virtual unsigned getNumOperands() const { return IncomingValues.size(); }
-  virtual bool setOperand(unsigned i, Value *Val);
-  virtual string getOpcode() const { return "phi"; }
 
   void addIncoming(Value *D);
+
+  // removeIncoming - Remove incoming value #i, because the edge that it comes
+  // in on is going away.  The values after it move down by one.
+  //
+  void removeIncoming(unsigned i);
 };
 
 
@@ -83,34 +95,50 @@ public:
 //===----------------------------------------------------------------------===//
 
 class CallInst : public Instruction {
-  MethodUse M;
-  vector<Use> Params;
+  vector<Use> Ops;       // The method being called, then the arguments
   CallInst(const CallInst &CI);
 public:
   CallInst(Method *M, vector<Value*> &params, const string &Name = "");
   inline ~CallInst() { dropAllReferences(); }
 
-  virtual string getOpcode() const { return "call"; }
-
   virtual Instruction *clone() const { return new CallInst(*this); }
   bool hasSideEffects() const { return true; }
 
 
-  const Method *getCalledMethod() const { return M; }
-        Method *getCalledMethod()       { return M; }
+  const Method *getCalledMethod() const { 
+    return (const Method*)(const Value*)Ops[0];
+  }
+  Method *getCalledMethod() { return (Method*)(Value*)Ops[0]; }
 
   // Implement all of the functionality required by Instruction...
   //
-  virtual void dropAllReferences();
-  virtual const Value *getOperand(unsigned i) const { 
-    return i == 0 ? M : ((i <= Params.size()) ? Params[i-1] : 0);
-  }
-  inline Value *getOperand(unsigned i) {
-    return (Value*)((const CallInst*)this)->getOperand(i);
+  virtual bool setOperand(unsigned i, Value *Val);
+};
+
+
+//===----------------------------------------------------------------------===//
+//                                 ShiftInst Class
+//===----------------------------------------------------------------------===//
+
+// ShiftInst - This class represents the shl and shr instructions.  They are not
+// BinaryOperators, because the shift amount may have a different type than the
+// value that is shifted.  The result has the type of the shifted value.
+//
+class ShiftInst : public Instruction {
+  Use Ops[2];       // The value shifted, then the amount
+public:
+  ShiftInst(OtherOps Opcode, Value *S, Value *SA, const string &Name = "")
+    : Instruction(S->getType(), Opcode, Name) {
+    assert((Opcode == Shl || Opcode == Shr) && "ShiftInst Opcode invalid!");
+    Ops[0].init(S, this);
+    Ops[1].init(SA, this);
+    Operands = Ops; NumOperands = 2;
   }
-  virtual unsigned getNumOperands() const { return Params.size()+1; }
+  inline ~ShiftInst() { dropAllReferences(); }
 
-  virtual bool setOperand(unsigned i, Value *Val);
+  virtual Instruction *clone() const { 
+    return new ShiftInst((OtherOps)getInstType(), Ops[0], Ops[1]);
+  }
 };
 
 #endif
@@ -24,7 +24,7 @@
 //              not continue in this method any longer.
 //
 class ReturnInst : public TerminatorInst {
-  Use Val;   // Will be null if returning void...
+  Use Ops[1];   // Will be null if returning void...
   ReturnInst(const ReturnInst &RI);
 public:
   ReturnInst(Value *value = 0);
@@ -32,18 +32,11 @@ public:
 
   virtual Instruction *clone() const { return new ReturnInst(*this); }
 
-  virtual string getOpcode() const { return "ret"; }
 
-  inline const Value *getReturnValue() const { return Val; }
-  inline       Value *getReturnValue()       { return Val; }
+  inline const Value *getReturnValue() const { return Ops[0]; }
+  inline       Value *getReturnValue()       { return Ops[0]; }
 
-  virtual void dropAllReferences();
-  virtual const Value *getOperand(unsigned i) const {
-    return (i == 0) ? Val : 0;
-  }
-  inline Value *getOperand(unsigned i) { return (i == 0) ? Val : 0;  }
   virtual bool setOperand(unsigned i, Value *Val);
-  virtual unsigned getNumOperands() const { return Val != 0; }
 
   // Additionally, they must provide a method to get at the successors of this
   // terminator instruction.  If 'idx' is out of range, a null pointer shall be
@@ -51,6 +44,9 @@ public:
   //
   virtual const BasicBlock *getSuccessor(unsigned idx) const { return 0; }
   virtual unsigned getNumSuccessors() const { return 0; }
+  virtual void setSuccessor(unsigned idx, BasicBlock *B) {
+    assert(0 && "ReturnInst has no successors!");
+  }
 };
 
 
@@ -58,8 +54,10 @@ public:
 // BranchInst - Conditional or Unconditional Branch instruction.
 //
 class BranchInst : public TerminatorInst {
-  BasicBlockUse TrueDest, FalseDest;
-  Use Condition;
+  // Ops[0] is the true destination, Ops[1] is the false destination, and 
+  // Ops[2] is the condition.  Unconditional branches only have one operand.
+  //
+  Use Ops[3];
 
   BranchInst(const BranchInst &BI);
 public:
@@ -69,20 +67,12 @@ public:
 
   virtual Instruction *clone() const { return new BranchInst(*this); }
 
-  virtual void dropAllReferences();
-  
   inline bool isUnconditional() const {
-    return Condition == 0 || !FalseDest;
+    return Ops[2] == 0 || Ops[1] == 0;
   }
 
-  virtual string getOpcode() const { return "br"; }
 
-  inline Value *getOperand(unsigned i) {
-    return (Value*)((const BranchInst *)this)->getOperand(i);
-  }
-  virtual const Value *getOperand(unsigned i) const;
   virtual bool setOperand(unsigned i, Value *Val);
-  virtual unsigned getNumOperands() const { return isUnconditional() ? 1 : 3; }
 
   // Additionally, they must provide a method to get at the successors of this
   // terminator instruction.  If 'idx' is out of range, a null pointer shall be
@@ -90,6 +80,7 @@ public:
   //
   virtual const BasicBlock *getSuccessor(unsigned idx) const;
   virtual unsigned getNumSuccessors() const { return 1+!isUnconditional(); }
+  virtual void setSuccessor(unsigned idx, BasicBlock *B);
 };
 
 
@@ -97,18 +88,14 @@ public:
 // SwitchInst - Multiway switch
 //
 class SwitchInst : public TerminatorInst {
-public:
-  typedef pair<ConstPoolUse, BasicBlockUse> dest_value;
-private:
-  BasicBlockUse DefaultDest;
-  Use Val;
-  vector<dest_value> Destinations;
+  // Operands[0] is the value switched on, Operands[1] is the default 
+  // destination, and the rest are pairs of a constant and the destination to
+  // go to when the value is equal to it.
+  //
+  vector<Use> Ops;
 
   SwitchInst(const SwitchInst &RI);
 public:
-  typedef vector<dest_value>::iterator       dest_iterator;
-  typedef vector<dest_value>::const_iterator dest_const_iterator;
-
   SwitchInst(Value *Value, BasicBlock *Default);
   inline ~SwitchInst() { dropAllReferences(); }
 
@@ -116,21 +103,15 @@ public:
 
   void dest_push_back(ConstPoolVal *OnVal, BasicBlock *Dest);
 
-  virtual string getOpcode() const { return "switch"; }
-  inline Value *getOperand(unsigned i) {
-    return (Value*)((const SwitchInst*)this)->getOperand(i);
-  }
-  virtual const Value *getOperand(unsigned i) const;
   virtual bool setOperand(unsigned i, Value *Val);
-  virtual unsigned getNumOperands() const;
-  virtual void dropAllReferences();  
 
   // Additionally, they must provide a method to get at the successors of this
   // terminator instruction.  If 'idx' is out of range, a null pointer shall be
   // returned.
   //
   virtual const BasicBlock *getSuccessor(unsigned idx) const;
-  virtual unsigned getNumSuccessors() const { return 1+Destinations.size(); }
+  virtual unsigned getNumSuccessors() const { return NumOperands/2; }
+  virtual void setSuccessor(unsigned idx, BasicBlock *B);
 };
 
 #endif
@@ -16,4 +16,18 @@
 // All of these classes are subclasses of the UnaryOperator class...
 //
 
+// GenericUnaryInst - The unary operators that need nothing special: neg, not,
+// and the casts to the primitive types.  A cast has the type that it converts
+// to, the others have the type of their operand.
+//
+class GenericUnaryInst : public UnaryOperator {
+public:
+  GenericUnaryInst(UnaryOps Opcode, Value *S, const string &Name = "");
+
+  // getCastType - Return the type that the cast opcode Opcode converts to, or
+  // null if Opcode is not a cast to a primitive type.
+  //
+  static const Type *getCastType(unsigned Opcode);
+};
+
 #endif
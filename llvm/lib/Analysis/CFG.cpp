@@ -0,0 +1,130 @@
+//===- CFG.cpp - Cached control flow graph ----------------------*- C++ -*--=//
+//
+// This file implements the MethodCFG analysis.  It is built from the successor
+// lists of the terminators, so each block's predecessors are found in one walk
+// over the method.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Analysis/CFG.h"
+#include "llvm/Method.h"
+#include "llvm/BasicBlock.h"
+#include "llvm/iTerminators.h"
+#include <algorithm>
+
+static AnalysisResult *CreateMethodCFG(Module *, Method *M) {
+  return new MethodCFG(M);
+}
+
+const AnalysisInfo MethodCFG::ID = { "CFG", true, CreateMethodCFG };
+
+MethodCFG::MethodCFG(Method *M) {
+  Method::BasicBlocksType &BBs = M->getBasicBlocks();
+  Blocks.reserve(BBs.size());
+  for (Method::BasicBlocksType::iterator BBI = BBs.begin();
+       BBI != BBs.end(); ++BBI) {
+    BlockNumbers[*BBI] = Blocks.size();
+    Blocks.push_back(*BBI);
+  }
+
+  Preds.resize(Blocks.size());
+  Succs.resize(Blocks.size());
+  for (unsigned i = 0; i < Blocks.size(); ++i)
+    addEdges(i);
+}
+
+unsigned MethodCFG::getBlockNumber(const BasicBlock *BB) const {
+  hash_map<const BasicBlock*, unsigned, BlockPtrHash>::const_iterator I =
+    BlockNumbers.find(BB);
+  assert(I != BlockNumbers.end() && "Block is not in the CFG!");
+  return I->second;
+}
+
+// addEdges - Fill in the successors of block #No from its terminator, and add
+// it to the predecessors of each of them.
+//
+void MethodCFG::addEdges(unsigned No) {
+  BasicBlock *BB = Blocks[No];
+  TerminatorInst *T = BB->getTerminator();
+  if (T == 0) return;                  // Malformed block, no successors
+
+  unsigned NumSuccs = T->getNumSuccessors();
+  vector<BasicBlock*> &S = Succs[No];
+  S.reserve(NumSuccs);
+  for (unsigned i = 0; i < NumSuccs; ++i) {
+    BasicBlock *Succ = T->getSuccessor(i);
+    S.push_back(Succ);
+    Preds[getBlockNumber(Succ)].push_back(BB);
+  }
+}
+
+// removeEdges - Forget the successors of block #No, taking it off of the
+// predecessor list of each of them once for every edge.
+//
+void MethodCFG::removeEdges(unsigned No) {
+  BasicBlock *BB = Blocks[No];
+  vector<BasicBlock*> &S = Succs[No];
+  for (unsigned i = 0; i < S.size(); ++i) {
+    vector<BasicBlock*> &P = Preds[getBlockNumber(S[i])];
+    vector<BasicBlock*>::iterator I = find(P.begin(), P.end(), BB);
+    assert(I != P.end() && "CFG edge lists out of sync!");
+    P.erase(I);
+  }
+  S.clear();
+}
+
+void MethodCFG::setSuccessor(BasicBlock *BB, unsigned i, BasicBlock *NewSucc) {
+  unsigned No = getBlockNumber(BB);
+  BasicBlock *OldSucc = Succs[No][i];
+  if (OldSucc == NewSucc) return;
+
+  BB->getTerminator()->setSuccessor(i, NewSucc);
+  Succs[No][i] = NewSucc;
+
+  vector<BasicBlock*> &P = Preds[getBlockNumber(OldSucc)];
+  P.erase(find(P.begin(), P.end(), BB));
+  Preds[getBlockNumber(NewSucc)].push_back(BB);
+}
+
+void MethodCFG::redirectBranches(BasicBlock *From, BasicBlock *To) {
+  assert(From != To && "Redirecting branches to the same block!");
+  unsigned FromNo = getBlockNumber(From), ToNo = getBlockNumber(To);
+
+  // Every edge into From now goes into To instead.  A block is listed once
+  // for each of its edges, and replace moves all of them the first time that
+  // the block is seen, so it does nothing for the others.
+  //
+  vector<BasicBlock*> &FromPreds = Preds[FromNo];
+  for (unsigned i = 0; i < FromPreds.size(); ++i) {
+    vector<BasicBlock*> &S = Succs[getBlockNumber(FromPreds[i])];
+    replace(S.begin(), S.end(), From, To);
+    Preds[ToNo].push_back(FromPreds[i]);
+  }
+  FromPreds.clear();
+
+  From->replaceAllUsesWith(To);
+}
+
+void MethodCFG::addBlock(BasicBlock *BB) {
+  assert(BlockNumbers.find(BB) == BlockNumbers.end() && "Block added twice!");
+  unsigned No = Blocks.size();
+  BlockNumbers[BB] = No;
+  Blocks.push_back(BB);
+  Preds.push_back(vector<BasicBlock*>());
+  Succs.push_back(vector<BasicBlock*>());
+  addEdges(No);
+}
+
+void MethodCFG::removeBlock(BasicBlock *BB) {
+  unsigned No = getBlockNumber(BB);
+  assert(Preds[No].empty() && "Removing a block that is still branched to!");
+  removeEdges(No);
+  BlockNumbers.erase(BB);
+  Blocks[No] = 0;
+}
+
+void MethodCFG::terminatorChanged(BasicBlock *BB) {
+  unsigned No = getBlockNumber(BB);
+  removeEdges(No);
+  addEdges(No);
+}
@@ -0,0 +1,53 @@
+//===- CallGraph.cpp - Build a Module's call graph --------------*- C++ -*--=//
+//
+// This file implements the CallGraph analysis, by scanning every method for
+// call instructions.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Analysis/CallGraph.h"
+#include "llvm/Module.h"
+#include "llvm/Method.h"
+#include "llvm/iOther.h"
+#include <algorithm>
+
+static AnalysisResult *CreateCallGraph(Module *M, Method *) {
+  return new CallGraph(M);
+}
+
+const AnalysisInfo CallGraph::ID = { "Call Graph", false, CreateCallGraph };
+
+// AddEdge - Add Callee to the list of methods called by Caller, and vice
+// versa, unless it is already there.
+//
+static void AddEdge(vector<Method*> &List, Method *M) {
+  if (find(List.begin(), List.end(), M) == List.end())
+    List.push_back(M);
+}
+
+CallGraph::CallGraph(Module *M) {
+  Module::MethodListType &Methods = M->getMethodList();
+  for (Module::MethodListType::iterator MI = Methods.begin(); 
+       MI != Methods.end(); ++MI) {
+    Method *Meth = *MI;
+    if (Meth->isMethodExternal()) continue;  // No body, no calls
+
+    for (Method::inst_iterator I = Meth->inst_begin(); 
+         I != Meth->inst_end(); ++I)
+      if ((*I)->getInstType() == Instruction::Call) {
+        Method *Callee = ((CallInst*)*I)->getCalledMethod();
+        AddEdge(Callees[Meth], Callee);
+        AddEdge(Callers[Callee], Meth);
+      }
+  }
+}
+
+const vector<Method*> &CallGraph::getCallees(const Method *M) const {
+  MethodMapType::const_iterator I = Callees.find(M);
+  return I != Callees.end() ? I->second : NoMethods;
+}
+
+const vector<Method*> &CallGraph::getCallers(const Method *M) const {
+  MethodMapType::const_iterator I = Callers.find(M);
+  return I != Callers.end() ? I->second : NoMethods;
+}
@@ -0,0 +1,161 @@
+//===- Dominators.cpp - Dominator tree of a method --------------*- C++ -*--=//
+//
+// This file implements the DominatorTree analysis.  All of the walks over the
+// CFG and over the tree use explicit stacks, so that methods with very long
+// chains of blocks do not overflow the C stack.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Analysis/Dominators.h"
+#include "llvm/Method.h"
+#include "llvm/BasicBlock.h"
+#include <utility>
+
+static AnalysisResult *CreateDominatorTree(Module *, Method *M) {
+  return new DominatorTree(M);
+}
+
+const AnalysisInfo DominatorTree::ID = { "Dominator Tree", true,
+                                         CreateDominatorTree };
+
+DominatorTree::DominatorTree(Method *M) : CFG(M) {
+  unsigned NumBlocks = CFG.getNumBlocks();
+  IDoms.resize(NumBlocks, NoBlock);
+  Children.resize(NumBlocks);
+  Frontiers.resize(NumBlocks);
+  DFSIn.resize(NumBlocks, NoBlock);
+  DFSOut.resize(NumBlocks, NoBlock);
+  if (NumBlocks == 0) return;            // External method, no blocks
+
+  vector<unsigned> PostOrder, PONum;
+  computePostOrder(PostOrder, PONum);
+  computeIDoms(PostOrder, PONum);
+  numberTree();
+  computeFrontiers();
+}
+
+// computePostOrder - Walk the CFG depth first from the entry block (which is
+// block #0), listing the reachable blocks in postorder.  PONum is set to the
+// position of each block in the list, or NoBlock if it cannot be reached.
+//
+void DominatorTree::computePostOrder(vector<unsigned> &PostOrder,
+                                     vector<unsigned> &PONum) {
+  PONum.resize(CFG.getNumBlocks(), NoBlock);
+  vector<bool> Visited(CFG.getNumBlocks());
+
+  vector<pair<unsigned, unsigned> > Stack;   // Block #, next successor
+  Stack.push_back(make_pair(0U, 0U));
+  Visited[0] = true;
+
+  while (!Stack.empty()) {
+    unsigned BB = Stack.back().first;
+    const vector<BasicBlock*> &Succs = CFG.getSuccessors(BB);
+    if (Stack.back().second < Succs.size()) {
+      unsigned Succ = CFG.getBlockNumber(Succs[Stack.back().second++]);
+      if (!Visited[Succ]) {
+        Visited[Succ] = true;
+        Stack.push_back(make_pair(Succ, 0U));
+      }
+    } else {
+      PONum[BB] = PostOrder.size();
+      PostOrder.push_back(BB);
+      Stack.pop_back();
+    }
+  }
+}
+
+// computeIDoms - Find the immediate dominators, by visiting the blocks in
+// reverse postorder until nothing changes.  The immediate dominator of a block
+// is the nearest common dominator of its predecessors that have been processed
+// so far.  This usually settles in two passes.
+//
+void DominatorTree::computeIDoms(const vector<unsigned> &PostOrder,
+                                 const vector<unsigned> &PONum) {
+  unsigned Root = PostOrder.back();
+  IDoms[Root] = Root;                    // Stops the walks in the loop below
+
+  bool Changed = true;
+  while (Changed) {
+    Changed = false;
+    for (unsigned i = PostOrder.size()-1; i-- > 0; ) {
+      unsigned BB = PostOrder[i];
+      const vector<BasicBlock*> &Preds = CFG.getPredecessors(BB);
+
+      unsigned NewIDom = NoBlock;
+      for (unsigned p = 0; p < Preds.size(); ++p) {
+        unsigned Pred = CFG.getBlockNumber(Preds[p]);
+        if (IDoms[Pred] == NoBlock) continue;   // Not processed or unreachable
+
+        if (NewIDom == NoBlock) {
+          NewIDom = Pred;
+        } else {                                // Find the common dominator
+          unsigned A = Pred, B = NewIDom;
+          while (A != B) {
+            while (PONum[A] < PONum[B]) A = IDoms[A];
+            while (PONum[B] < PONum[A]) B = IDoms[B];
+          }
+          NewIDom = A;
+        }
+      }
+
+      if (IDoms[BB] != NewIDom) {
+        IDoms[BB] = NewIDom;
+        Changed = true;
+      }
+    }
+  }
+
+  IDoms[Root] = NoBlock;                 // The root has no dominator
+  for (unsigned i = 0; i < PostOrder.size(); ++i)
+    if (PostOrder[i] != Root)
+      Children[IDoms[PostOrder[i]]].push_back(CFG.getBlock(PostOrder[i]));
+}
+
+// numberTree - Number the nodes of the tree on the way into and out of them in
+// a depth first walk.  A dominates B exactly when the walk enters A before B
+// and leaves it after B.
+//
+void DominatorTree::numberTree() {
+  unsigned Count = 0;
+  vector<pair<unsigned, unsigned> > Stack;   // Block #, next child
+  Stack.push_back(make_pair(0U, 0U));
+  DFSIn[0] = Count++;
+
+  while (!Stack.empty()) {
+    unsigned BB = Stack.back().first;
+    if (Stack.back().second < Children[BB].size()) {
+      unsigned Child =
+        CFG.getBlockNumber(Children[BB][Stack.back().second++]);
+      DFSIn[Child] = Count++;
+      Stack.push_back(make_pair(Child, 0U));
+    } else {
+      DFSOut[BB] = Count++;
+      Stack.pop_back();
+    }
+  }
+}
+
+// computeFrontiers - A block with several predecessors is in the frontier of
+// each of its predecessors, and of their dominators, up to (but not including)
+// its own immediate dominator.  The entry block counts as having an extra
+// predecessor, the caller, so it only needs one.
+//
+void DominatorTree::computeFrontiers() {
+  for (unsigned BB = 0; BB < CFG.getNumBlocks(); ++BB) {
+    const vector<BasicBlock*> &Preds = CFG.getPredecessors(BB);
+    if (Preds.size() < 2 && BB != 0) continue;
+    if (DFSIn[BB] == NoBlock) continue;
+
+    BasicBlock *Block = CFG.getBlock(BB);
+    for (unsigned p = 0; p < Preds.size(); ++p) {
+      unsigned Runner = CFG.getBlockNumber(Preds[p]);
+      if (DFSIn[Runner] == NoBlock) continue;   // Unreachable predecessor
+
+      for (; Runner != IDoms[BB]; Runner = IDoms[Runner]) {
+        vector<BasicBlock*> &DF = Frontiers[Runner];
+        if (!DF.empty() && DF.back() == Block) break;  // Rest already done
+        DF.push_back(Block);
+      }
+    }
+  }
+}
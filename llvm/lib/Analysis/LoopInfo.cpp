@@ -0,0 +1,110 @@
+//===- LoopInfo.cpp - Natural loops of a method -----------------*- C++ -*--=//
+//
+// This file implements the LoopInfo analysis.  The headers are visited in a
+// postorder walk of the dominator tree, so that the loops nested inside of a
+// loop have been found by the time that it is.  Each loop is then found by
+// walking back from the sources of its back edges, adding the nested loops
+// that are met whole.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Analysis/Dominators.h"
+#include "llvm/Method.h"
+#include "llvm/BasicBlock.h"
+#include <utility>
+
+static AnalysisResult *CreateLoopInfo(Module *, Method *M) {
+  return new LoopInfo(M);
+}
+
+const AnalysisInfo LoopInfo::ID = { "Loop Info", true, CreateLoopInfo };
+
+Loop::~Loop() {
+  for (unsigned i = 0; i < SubLoops.size(); ++i)
+    delete SubLoops[i];
+}
+
+LoopInfo::LoopInfo(Method *M) {
+  if (M->isMethodExternal()) return;     // No body, no loops
+  DominatorTree DT(M);
+  const MethodCFG &CFG = DT.getCFG();
+
+  // Walk the dominator tree, listing the blocks in postorder...
+  vector<BasicBlock*> PostOrder;
+  vector<pair<BasicBlock*, unsigned> > Stack;   // Block, next child
+  Stack.push_back(make_pair(DT.getRoot(), 0U));
+  while (!Stack.empty()) {
+    BasicBlock *BB = Stack.back().first;
+    const vector<BasicBlock*> &Children = DT.getChildren(BB);
+    if (Stack.back().second < Children.size())
+      Stack.push_back(make_pair(Children[Stack.back().second++], 0U));
+    else {
+      PostOrder.push_back(BB);
+      Stack.pop_back();
+    }
+  }
+
+  vector<Loop*> Loops;
+  for (unsigned i = 0; i < PostOrder.size(); ++i) {
+    BasicBlock *Header = PostOrder[i];
+
+    // Find the back edges to this block...
+    vector<BasicBlock*> Worklist;
+    const vector<BasicBlock*> &Preds = CFG.getPredecessors(Header);
+    for (unsigned p = 0; p < Preds.size(); ++p)
+      if (DT.dominates(Header, Preds[p]))
+        Worklist.push_back(Preds[p]);
+    if (Worklist.empty()) continue;      // Not a loop header
+
+    Loop *L = new Loop(Header);
+    BlockLoops[Header] = L;
+    Loops.push_back(L);
+
+    // Walk back from the back edges to the header, which is already in L...
+    while (!Worklist.empty()) {
+      BasicBlock *BB = Worklist.back();
+      Worklist.pop_back();
+
+      Loop *Sub = getLoopFor(BB);
+      if (Sub == 0) {
+        if (!DT.isReachable(BB)) continue;   // Dead code is in no loop
+        BlockLoops[BB] = L;
+        L->Blocks.push_back(BB);
+        const vector<BasicBlock*> &BBPreds = CFG.getPredecessors(BB);
+        Worklist.insert(Worklist.end(), BBPreds.begin(), BBPreds.end());
+      } else {
+        // BB is in a loop already.  Its outermost loop so far is inside of L,
+        // unless it is L itself.  Add that loop to L whole, and go on from
+        // the blocks that enter it.
+        //
+        while (Sub->ParentLoop) Sub = Sub->ParentLoop;
+        if (Sub == L) continue;
+
+        Sub->ParentLoop = L;
+        L->SubLoops.push_back(Sub);
+        L->Blocks.insert(L->Blocks.end(), Sub->Blocks.begin(),
+                         Sub->Blocks.end());
+        const vector<BasicBlock*> &SubPreds =
+          CFG.getPredecessors(Sub->getHeader());
+        Worklist.insert(Worklist.end(), SubPreds.begin(), SubPreds.end());
+      }
+    }
+  }
+
+  for (unsigned i = 0; i < Loops.size(); ++i)
+    if (Loops[i]->ParentLoop == 0)
+      TopLevelLoops.push_back(Loops[i]);
+}
+
+LoopInfo::~LoopInfo() {
+  for (unsigned i = 0; i < TopLevelLoops.size(); ++i)
+    delete TopLevelLoops[i];
+}
+
+void LoopInfo::addBlockToLoop(BasicBlock *BB, Loop *L) {
+  if (L == 0) return;
+  BlockLoops[BB] = L;
+  for (; L; L = L->ParentLoop)
+    L->Blocks.push_back(BB);
+}
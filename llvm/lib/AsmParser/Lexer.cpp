@@ -1,599 +1,214 @@
-#define yy_create_buffer llvmAsm_create_buffer
-#define yy_delete_buffer llvmAsm_delete_buffer
-#define yy_scan_buffer llvmAsm_scan_buffer
-#define yy_scan_string llvmAsm_scan_string
-#define yy_scan_bytes llvmAsm_scan_bytes
-#define yy_flex_debug llvmAsm_flex_debug
-#define yy_init_buffer llvmAsm_init_buffer
-#define yy_flush_buffer llvmAsm_flush_buffer
-#define yy_load_buffer_state llvmAsm_load_buffer_state
-#define yy_switch_to_buffer llvmAsm_switch_to_buffer
-#define yyin llvmAsmin
-#define yyleng llvmAsmleng
-#define yylex llvmAsmlex
-#define yyout llvmAsmout
-#define yyrestart llvmAsmrestart
-#define yytext llvmAsmtext
-#define yylineno llvmAsmlineno
-
-#line 20 "Lexer.cpp"
-/* A lexical scanner generated by flex */
-
-/* Scanner skeleton version:
- * $Header$
- */
-
-#define FLEX_SCANNER
-#define YY_FLEX_MAJOR_VERSION 2
-#define YY_FLEX_MINOR_VERSION 5
-
-#include <stdio.h>
-
-
-/* cfront 1.2 defines "c_plusplus" instead of "__cplusplus" */
-#ifdef c_plusplus
-#ifndef __cplusplus
-#define __cplusplus
-#endif
-#endif
-
-
-#ifdef __cplusplus
-
-#include <stdlib.h>
-#include <unistd.h>
-
-/* Use prototypes in function declarations. */
-#define YY_USE_PROTOS
-
-/* The "const" storage-class-modifier is valid. */
-#define YY_USE_CONST
-
-#else	/* ! __cplusplus */
-
-#if __STDC__
-
-#define YY_USE_PROTOS
-#define YY_USE_CONST
-
-#endif	/* __STDC__ */
-#endif	/* ! __cplusplus */
-
-#ifdef __TURBOC__
- #pragma warn -rch
- #pragma warn -use
-#include <io.h>
-#include <stdlib.h>
-#define YY_USE_CONST
-#define YY_USE_PROTOS
-#endif
-
-#ifdef YY_USE_CONST
-#define yyconst const
-#else
-#define yyconst
-#endif
-
-
-#ifdef YY_USE_PROTOS
-#define YY_PROTO(proto) proto
-#else
-#define YY_PROTO(proto) ()
-#endif
-
-/* Returned upon end-of-file. */
-#define YY_NULL 0
-
-/* Promotes a possibly negative, possibly signed char to an unsigned
- * integer for use as an array index.  If the signed char is negative,
- * we want to instead treat it as an 8-bit unsigned char, hence the
- * double cast.
- */
-#define YY_SC_TO_UI(c) ((unsigned int) (unsigned char) c)
-
-/* Enter a start condition.  This macro really ought to take a parameter,
- * but we do it the disgusting crufty way forced on us by the ()-less
- * definition of BEGIN.
- */
-#define BEGIN yy_start = 1 + 2 *
-
-/* Translate the current start state into a value that can be later handed
- * to BEGIN to return to the state.  The YYSTATE alias is for lex
- * compatibility.
- */
-#define YY_START ((yy_start - 1) / 2)
-#define YYSTATE YY_START
-
-/* Action number for EOF rule of a given start state. */
-#define YY_STATE_EOF(state) (YY_END_OF_BUFFER + state + 1)
-
-/* Special action meaning "start processing a new file". */
-#define YY_NEW_FILE yyrestart( yyin )
-
-#define YY_END_OF_BUFFER_CHAR 0
-
-/* Size of default input buffer. */
-#define YY_BUF_SIZE 16384
-
-typedef struct yy_buffer_state *YY_BUFFER_STATE;
-
-extern int yyleng;
-extern FILE *yyin, *yyout;
-
-#define EOB_ACT_CONTINUE_SCAN 0
-#define EOB_ACT_END_OF_FILE 1
-#define EOB_ACT_LAST_MATCH 2
-
-/* The funky do-while in the following #define is used to turn the definition
- * int a single C statement (which needs a semi-colon terminator).  This
- * avoids problems with code like:
- *
- * 	if ( condition_holds )
- *		yyless( 5 );
- *	else
- *		do_something_else();
- *
- * Prior to using the do-while the compiler would get upset at the
- * "else" because it interpreted the "if" statement as being all
- * done when it reached the ';' after the yyless() call.
- */
-
-/* Return all but the first 'n' matched characters back to the input stream. */
-
-#define yyless(n) \
-	do \
-		{ \
-		/* Undo effects of setting up yytext. */ \
-		*yy_cp = yy_hold_char; \
-		YY_RESTORE_YY_MORE_OFFSET \
-		yy_c_buf_p = yy_cp = yy_bp + n - YY_MORE_ADJ; \
-		YY_DO_BEFORE_ACTION; /* set up yytext again */ \
-		} \
-	while ( 0 )
-
-#define unput(c) yyunput( c, yytext_ptr )
-
-/* The following is because we cannot portably get our hands on size_t
- * (without autoconf's help, which isn't available because we want
- * flex-generated scanners to compile on their own).
- */
-typedef unsigned int yy_size_t;
-
-
-struct yy_buffer_state
-	{
-	FILE *yy_input_file;
-
-	char *yy_ch_buf;		/* input buffer */
-	char *yy_buf_pos;		/* current position in input buffer */
-
-	/* Size of input buffer in bytes, not including room for EOB
-	 * characters.
-	 */
-	yy_size_t yy_buf_size;
-
-	/* Number of characters read into yy_ch_buf, not including EOB
-	 * characters.
-	 */
-	int yy_n_chars;
-
-	/* Whether we "own" the buffer - i.e., we know we created it,
-	 * and can realloc() it to grow it, and should free() it to
-	 * delete it.
-	 */
-	int yy_is_our_buffer;
-
-	/* Whether this is an "interactive" input source; if so, and
-	 * if we're using stdio for input, then we want to use getc()
-	 * instead of fread(), to make sure we stop fetching input after
-	 * each newline.
-	 */
-	int yy_is_interactive;
-
-	/* Whether we're considered to be at the beginning of a line.
-	 * If so, '^' rules will be active on the next match, otherwise
-	 * not.
-	 */
-	int yy_at_bol;
-
-	/* Whether to try to fill the input buffer when we reach the
-	 * end of it.
-	 */
-	int yy_fill_buffer;
-
-	int yy_buffer_status;
-#define YY_BUFFER_NEW 0
-#define YY_BUFFER_NORMAL 1
-	/* When an EOF's been seen but there's still some text to process
-	 * then we mark the buffer as YY_EOF_PENDING, to indicate that we
-	 * shouldn't try reading from the input source any more.  We might
-	 * still have a bunch of tokens to match, though, because of
-	 * possible backing-up.
-	 *
-	 * When we actually see the EOF, we change the status to "new"
-	 * (via yyrestart()), so that the user can continue scanning by
-	 * just pointing yyin at a new input file.
-	 */
-#define YY_BUFFER_EOF_PENDING 2
-	};
-
-static YY_BUFFER_STATE yy_current_buffer = 0;
-
-/* We provide macros for accessing buffer states in case in the
- * future we want to put the buffer states in a more general
- * "scanner state".
- */
-#define YY_CURRENT_BUFFER yy_current_buffer
-
-
-/* yy_hold_char holds the character lost when yytext is formed. */
-static char yy_hold_char;
-
-static int yy_n_chars;		/* number of characters read into yy_ch_buf */
-
-
-int yyleng;
-
-/* Points to current character in buffer. */
-static char *yy_c_buf_p = (char *) 0;
-static int yy_init = 1;		/* whether we need to initialize */
-static int yy_start = 0;	/* start state number */
-
-/* Flag which is used to allow yywrap()'s to do buffer switches
- * instead of setting up a fresh yyin.  A bit of a hack ...
- */
-static int yy_did_buffer_switch_on_eof;
-
-void yyrestart YY_PROTO(( FILE *input_file ));
-
-void yy_switch_to_buffer YY_PROTO(( YY_BUFFER_STATE new_buffer ));
-void yy_load_buffer_state YY_PROTO(( void ));
-YY_BUFFER_STATE yy_create_buffer YY_PROTO(( FILE *file, int size ));
-void yy_delete_buffer YY_PROTO(( YY_BUFFER_STATE b ));
-void yy_init_buffer YY_PROTO(( YY_BUFFER_STATE b, FILE *file ));
-void yy_flush_buffer YY_PROTO(( YY_BUFFER_STATE b ));
-#define YY_FLUSH_BUFFER yy_flush_buffer( yy_current_buffer )
-
-YY_BUFFER_STATE yy_scan_buffer YY_PROTO(( char *base, yy_size_t size ));
-YY_BUFFER_STATE yy_scan_string YY_PROTO(( yyconst char *yy_str ));
-YY_BUFFER_STATE yy_scan_bytes YY_PROTO(( yyconst char *bytes, int len ));
-
-static void *yy_flex_alloc YY_PROTO(( yy_size_t ));
-static inline void *yy_flex_realloc YY_PROTO(( void *, yy_size_t ));
-static void yy_flex_free YY_PROTO(( void * ));
-
-#define yy_new_buffer yy_create_buffer
-
-#define yy_set_interactive(is_interactive) \
-	{ \
-	if ( ! yy_current_buffer ) \
-		yy_current_buffer = yy_create_buffer( yyin, YY_BUF_SIZE ); \
-	yy_current_buffer->yy_is_interactive = is_interactive; \
-	}
-
-#define yy_set_bol(at_bol) \
-	{ \
-	if ( ! yy_current_buffer ) \
-		yy_current_buffer = yy_create_buffer( yyin, YY_BUF_SIZE ); \
-	yy_current_buffer->yy_at_bol = at_bol; \
-	}
-
-#define YY_AT_BOL() (yy_current_buffer->yy_at_bol)
-
-
-#define YY_USES_REJECT
-
-#define yywrap() 1
-#define YY_SKIP_YYWRAP
-typedef unsigned char YY_CHAR;
-FILE *yyin = (FILE *) 0, *yyout = (FILE *) 0;
-typedef int yy_state_type;
-extern int yylineno;
-int yylineno = 1;
-extern char *yytext;
-#define yytext_ptr yytext
-
-static yy_state_type yy_get_previous_state YY_PROTO(( void ));
-static yy_state_type yy_try_NUL_trans YY_PROTO(( yy_state_type current_state ));
-static int yy_get_next_buffer YY_PROTO(( void ));
-static void yy_fatal_error YY_PROTO(( yyconst char msg[] ));
-
-/* Done after the current pattern has been matched and before the
- * corresponding action - sets up yytext.
- */
-#define YY_DO_BEFORE_ACTION \
-	yytext_ptr = yy_bp; \
-	yyleng = (int) (yy_cp - yy_bp); \
-	yy_hold_char = *yy_cp; \
-	*yy_cp = '\0'; \
-	yy_c_buf_p = yy_cp;
-
-#define YY_NUM_RULES 58
-#define YY_END_OF_BUFFER 59
-static yyconst short int yy_acclist[113] =
-    {   0,
-       59,   57,   58,   56,   57,   58,   56,   58,   57,   58,
-       57,   58,   57,   58,    8,   57,   58,   52,   57,   58,
-        1,   57,   58,   57,   58,   57,   58,   57,   58,   57,
-       58,   57,   58,   57,   58,   57,   58,   57,   58,   57,
-       58,   57,   58,   57,   58,   57,   58,   57,   58,   57,
-       58,   57,   58,   57,   58,   57,   58,   50,   49,   54,
-       53,   52,    1,    9,   40,   51,   49,   55,   28,   31,
-        3,   16,   30,   24,   25,   26,   32,   39,   29,   11,
-       27,   44,   45,   18,    4,   22,   17,   10,    2,    5,
-       20,   23,   12,   34,   38,   36,   37,   35,   33,   14,
-
-       46,   13,   19,   43,   21,   42,   41,   15,    6,   47,
-       48,    7
-    } ;
-
-static yyconst short int yy_accept[199] =
-    {   0,
-        1,    1,    1,    2,    4,    7,    9,   11,   13,   15,
-       18,   21,   24,   26,   28,   30,   32,   34,   36,   38,
-       40,   42,   44,   46,   48,   50,   52,   54,   56,   58,
-       58,   58,   59,   60,   60,   61,   62,   63,   64,   64,
-       64,   65,   65,   65,   66,   66,   66,   66,   66,   66,
-       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
-       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
-       66,   66,   66,   66,   66,   66,   66,   66,   67,   68,
-       69,   70,   70,   70,   70,   70,   70,   71,   71,   72,
-       72,   72,   72,   72,   72,   73,   73,   73,   73,   73,
-
-       74,   75,   76,   77,   77,   78,   79,   79,   79,   79,
-       79,   80,   80,   80,   80,   80,   80,   80,   80,   80,
-       80,   80,   81,   82,   82,   82,   82,   82,   83,   83,
-       83,   83,   84,   85,   85,   85,   85,   85,   85,   85,
-       85,   85,   85,   85,   86,   87,   87,   88,   88,   88,
-       89,   89,   90,   90,   90,   91,   92,   92,   92,   93,
-       93,   93,   94,   95,   96,   97,   98,   99,  100,  101,
-      102,  102,  103,  104,  104,  105,  105,  106,  106,  106,
-      107,  107,  108,  109,  110,  110,  110,  110,  111,  111,
-      112,  112,  112,  112,  112,  112,  113,  113
-
-    } ;
-
-static yyconst int yy_ec[256] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    2,    1,    4,    1,    5,    6,    1,    1,    1,
-        1,    1,    1,    1,    7,    5,    1,    8,    8,    8,
-        8,    8,    8,    8,    8,    8,    8,    9,   10,    1,
-        1,    1,    1,    1,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
-        1,    1,    1,    1,    5,    1,   11,   12,   13,   14,
-
-       15,   16,   17,   18,   19,    5,    5,   20,   21,   22,
-       23,   24,   25,   26,   27,   28,   29,   30,   31,    5,
-       32,    5,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
-    } ;
-
-static yyconst int yy_meta[33] =
-    {   0,
-        1,    1,    2,    3,    4,    1,    5,    4,    6,    1,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
-        4,    4
-    } ;
-
-static yyconst short int yy_base[203] =
-    {   0,
-        0,    0,  389,  390,  390,  390,    0,  379,   26,  379,
-       27,    0,   28,   40,   29,   35,   34,   42,   30,   38,
-       56,   60,   55,   63,   65,   84,   68,  107,   52,  382,
-      376,  390,    0,  376,  375,  374,   74,    0,   32,   64,
-      372,   78,   67,  371,   77,   92,   76,   79,   89,   98,
-      100,   95,  102,  105,  108,  112,  111,  119,  122,  123,
-      116,  126,  128,  129,  132,  134,  137,  138,  139,  140,
-      143,  144,  145,  149,  146,  156,  154,  390,    0,  371,
-      369,  157,  166,  158,  161,  167,  368,  170,  367,  174,
-      175,  179,  180,  182,  366,  183,  181,  188,  184,  365,
-
-      364,  363,  362,  190,  361,  360,  191,  211,  198,  199,
-      359,  194,  200,  201,  202,  204,  205,  212,  203,  225,
-      214,  358,  357,  228,  209,  231,  232,  356,  233,  234,
-      235,  355,  354,  236,  238,  239,  241,  247,  249,  252,
-      242,  254,  259,  353,  352,  256,  351,  264,  265,  350,
-      267,  349,  270,  271,  348,  347,  273,  274,  346,  276,
-      275,  345,  344,  343,  342,  341,  340,  335,  330,  325,
-      283,  320,  319,  278,  317,  284,  316,  285,  288,  315,
-      289,  313,  311,  310,  293,  291,  301,  308,  295,  244,
-      303,  299,  302,  307,  309,   82,  390,  331,  334,  337,
-
-      342,   53
-    } ;
-
-static yyconst short int yy_def[203] =
-    {   0,
-      197,    1,  197,  197,  197,  197,  198,  199,  200,  197,
-      199,  201,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  198,
-      199,  197,  202,  197,  197,  197,  199,  201,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  197,  202,  197,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,  199,  199,  199,  199,
-      199,  199,  199,  199,  199,  199,    0,  197,  197,  197,
-
-      197,  197
-    } ;
+//===-- Lexer.cpp - Scanner for llvm assembly files --------------*- C++ -*--=//
+//
+//  This file implements the scanner for LLVM assembly languages files.  It
+//  runs directly over the (usually mmap'd) input buffer, and hands tokens back
+//  to the parser as slices of that buffer, so nothing is copied or allocated
+//  while lexing.
+//
+//  The token set is the same as the old flex scanner's:
+//
+//    Comment        ;.*                       ; ignored
+//    VarID          %[a-zA-Z$._][a-zA-Z$._0-9]*
+//    Label          [a-zA-Z$._0-9]+:
+//    StringConstant \"[^\"]+\"
+//    EPInteger      %[0-9]+                   ; unnamed value slot
+//    ENInteger      %-[0-9]+
+//    PInteger       [0-9]+
+//    NInteger       -[0-9]+
+//
+//  plus the keywords in the KeywordTable below.  Anything else is returned as
+//  a single character token.
+//
+//  The lexer is reentrant: all of its state is kept per thread, so that method
+//  bodies may be lexed and parsed in parallel (see RunVMAsmParser).
+//
+//===------------------------------------------------------------------------===
 
-static yyconst short int yy_nxt[423] =
-    {   0,
-        4,    5,    6,    7,    8,    9,   10,   11,    4,   12,
-       13,   14,   15,   16,   17,   18,   19,    8,   20,   21,
-       22,   23,    8,   24,    8,   25,   26,   27,   28,   29,
-        8,    8,   34,   35,   37,   32,   32,   32,   32,   45,
-       32,   39,   32,   32,   53,   81,   32,   40,   32,   46,
-       32,   41,   50,   47,   42,   49,   79,   48,   54,   55,
-       32,   51,   43,   32,   32,   44,   56,   52,   32,   60,
-       58,   32,   32,   32,   77,   32,   32,   61,   57,   64,
-       62,   37,   32,   82,   32,   32,   32,   32,   59,   84,
-       32,   63,   32,   71,   83,   65,   85,   32,   66,   72,
+#include "ParserInternals.h"
+#include "llvm/BasicBlock.h"
+#include "llvm/Method.h"
+#include "llvm/Module.h"
+#include <list>
+#include <string.h>           // for memchr
+#include "llvmAsmParser.h"
 
-       32,   67,   89,   32,   86,   87,   32,   88,   32,   92,
-       32,   68,   69,   32,   70,   32,   32,   90,   73,   32,
-       32,   97,   91,   96,   32,   74,   75,   32,   94,   93,
-       32,   32,   98,   76,   32,   95,   32,   32,   99,  101,
-       32,  100,   32,  102,  103,   32,   32,   32,   32,  105,
-      111,   32,   32,   32,   32,  104,  106,   32,  112,  109,
-      110,  108,   32,  107,   32,   32,   32,  114,  117,   32,
-      116,  113,  119,  118,   32,   32,  115,  122,   32,  120,
-      123,  125,   32,   32,  121,  127,  124,   32,   32,   32,
-       32,   32,   32,  128,  132,  129,   32,  131,   32,   32,
+__thread int llvmAsmlineno = 1;  // Current line number, for error messages
 
-      126,  130,   32,  134,  133,  135,   32,   32,   32,   32,
-       32,   32,   32,   32,  144,  145,  150,   32,  136,   32,
-       32,  143,   32,  141,  142,  137,  148,  138,  154,  146,
-      139,  147,  140,   32,  149,  152,   32,  151,  153,   32,
-       32,   32,   32,   32,   32,  155,   32,   32,  158,   32,
-       32,  157,   32,  162,  159,   32,  161,   32,  160,  156,
-       32,  164,   32,  166,   32,  163,  168,   32,  170,  169,
-      172,  171,   32,   32,  165,   32,  167,  175,   32,   32,
-      173,   32,   32,   32,   32,  177,   32,  178,  180,  181,
-      174,   32,   32,   32,  179,  176,   32,   32,  184,   32,
+static __thread const char *CurPtr = 0;    // Current position in the buffer
+static __thread const char *BufferEnd = 0; // One past the end of the buffer
+static __thread int PendingToken = 0;      // Token to return before the input
+static __thread bool NoWarnings = false;   // Set by llvmAsmFindMethods, until
+                                           // the input is set again
 
-      182,   32,  186,   32,  185,  183,  188,   32,  187,   32,
-       32,   32,  189,  192,  190,   32,   32,   32,   32,   32,
-      194,   32,  191,   32,   32,   32,  193,   32,   32,  195,
-      196,   30,   30,   32,   30,   30,   30,   31,   32,   31,
-       33,   33,   38,   32,   38,   38,   38,   38,   32,   32,
-       32,   32,   32,   32,   32,   32,   32,   32,   32,   32,
-       32,   32,   32,   32,   32,   32,   32,   32,   32,   32,
-       32,   32,   32,   32,   32,   32,   32,   32,   80,   32,
-       32,   36,   35,   80,   32,   78,   36,   32,  197,    3,
-      197,  197,  197,  197,  197,  197,  197,  197,  197,  197,
+//===----------------------------------------------------------------------===//
+//                        Character classification
+//===----------------------------------------------------------------------===//
 
-      197,  197,  197,  197,  197,  197,  197,  197,  197,  197,
-      197,  197,  197,  197,  197,  197,  197,  197,  197,  197,
-      197,  197
-    } ;
+// Bits stored in the CharClass table.  One table lookup tells the scanning
+// loops everything they need to know about a character.
+//
+enum {
+  CC_Space   = 1,      // [ \t\n]
+  CC_IdStart = 2,      // [a-zA-Z$._]
+  CC_IdChar  = 4,      // [a-zA-Z$._0-9]
+  CC_Digit   = 8,      // [0-9]
+};
+
+static unsigned char CharClass[256];
+
+static void InitCharClass() {
+  CharClass[(unsigned char)' ']  = CC_Space;
+  CharClass[(unsigned char)'\t'] = CC_Space;
+  CharClass[(unsigned char)'\n'] = CC_Space;
+
+  for (unsigned c = 'a'; c <= 'z'; ++c) CharClass[c] = CC_IdStart | CC_IdChar;
+  for (unsigned c = 'A'; c <= 'Z'; ++c) CharClass[c] = CC_IdStart | CC_IdChar;
+  for (unsigned c = '0'; c <= '9'; ++c) CharClass[c] = CC_IdChar | CC_Digit;
+  CharClass[(unsigned char)'$'] = CC_IdStart | CC_IdChar;
+  CharClass[(unsigned char)'.'] = CC_IdStart | CC_IdChar;
+  CharClass[(unsigned char)'_'] = CC_IdStart | CC_IdChar;
+}
 
-static yyconst short int yy_chk[423] =
-    {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    9,    9,   11,   11,   13,   15,   19,   15,
-       39,   13,   17,   16,   19,   39,   20,   13,   14,   16,
-       18,   14,   18,   16,   14,   17,  202,   16,   20,   20,
-       29,   18,   14,   23,   21,   14,   21,   18,   22,   23,
-       22,   24,   40,   25,   29,   43,   27,   23,   21,   25,
-       24,   37,   37,   40,   47,   45,   42,   48,   22,   43,
-      196,   24,   26,   27,   42,   26,   45,   49,   26,   27,
+static inline bool isClass(char C, unsigned Class) {
+  return CharClass[(unsigned char)C] & Class;
+}
 
-       46,   26,   49,   52,   46,   47,   50,   48,   51,   52,
-       53,   26,   26,   54,   26,   28,   55,   50,   28,   57,
-       56,   57,   51,   56,   61,   28,   28,   58,   54,   53,
-       59,   60,   57,   28,   62,   55,   63,   64,   58,   60,
-       65,   59,   66,   61,   62,   67,   68,   69,   70,   64,
-       69,   71,   72,   73,   75,   63,   64,   74,   70,   67,
-       68,   66,   77,   65,   76,   82,   84,   72,   75,   85,
-       74,   71,   77,   76,   83,   86,   73,   84,   88,   82,
-       85,   88,   90,   91,   83,   91,   86,   92,   93,   97,
-       94,   96,   99,   92,   97,   93,   98,   96,  104,  107,
+// SkipWhile - Advance Ptr over the run of characters in the specified class.
+//
+static inline const char *SkipWhile(const char *Ptr, unsigned Class) {
+  while (Ptr != BufferEnd && isClass(*Ptr, Class)) ++Ptr;
+  return Ptr;
+}
 
-       90,   94,  112,   99,   98,  104,  109,  110,  113,  114,
-      115,  119,  116,  117,  113,  114,  119,  125,  107,  108,
-      118,  112,  121,  109,  110,  108,  117,  108,  125,  115,
-      108,  116,  108,  120,  118,  121,  124,  120,  124,  126,
-      127,  129,  130,  131,  134,  126,  135,  136,  130,  137,
-      141,  129,  190,  136,  131,  138,  135,  139,  134,  127,
-      140,  138,  142,  139,  146,  137,  140,  143,  142,  141,
-      146,  143,  148,  149,  138,  151,  139,  151,  153,  154,
-      148,  157,  158,  161,  160,  154,  174,  157,  160,  161,
-      149,  171,  176,  178,  158,  153,  179,  181,  176,  186,
+//===----------------------------------------------------------------------===//
+//                              Keyword table
+//===----------------------------------------------------------------------===//
 
-      171,  185,  179,  189,  178,  174,  185,  192,  181,  187,
-      193,  191,  186,  191,  187,  194,  188,  195,  184,  183,
-      193,  182,  189,  180,  177,  175,  192,  173,  172,  194,
-      195,  198,  198,  170,  198,  198,  198,  199,  169,  199,
-      200,  200,  201,  168,  201,  201,  201,  201,  167,  166,
-      165,  164,  163,  162,  159,  156,  155,  152,  150,  147,
-      145,  144,  133,  132,  128,  123,  122,  111,  106,  105,
-      103,  102,  101,  100,   95,   89,   87,   81,   80,   44,
-       41,   36,   35,   34,   31,   30,   10,    8,    3,  197,
-      197,  197,  197,  197,  197,  197,  197,  197,  197,  197,
+// KeywordInfo - Describes how to return a keyword to the parser: which token
+// it is, and which member of the token value (if any) must be filled in.
+//
+struct KeywordInfo {
+  const char *Name;
+  int Token;
+  enum { NoVal, TypeVal, UnaryOp, BinaryOp, TermOp, MemOp } ValKind;
+  const Type **Ty;     // For TypeVal keywords
+  int Opcode;          // For *Op keywords
+};
+
+#define KW(NAME, TOK)          { NAME, TOK, KeywordInfo::NoVal, 0, 0 }
+#define KW_TYPE(NAME, TOK, TY) { NAME, TOK, KeywordInfo::TypeVal, &Type::TY, 0 }
+#define KW_OP(NAME, TOK, KIND, OP) \
+  { NAME, TOK, KeywordInfo::KIND, 0, Instruction::OP }
+
+static const KeywordInfo KeywordTable[] = {
+  KW("begin", BEGINTOK),   KW("end", END),
+  KW("true", TRUE),        KW("false", FALSE),
+  KW("declare", DECLARE),  KW("implementation", IMPLEMENTATION),
+
+  KW_TYPE("void",   VOID,   VoidTy),   KW_TYPE("bool",   BOOL,   BoolTy),
+  KW_TYPE("sbyte",  SBYTE,  SByteTy),  KW_TYPE("ubyte",  UBYTE,  UByteTy),
+  KW_TYPE("short",  SHORT,  ShortTy),  KW_TYPE("ushort", USHORT, UShortTy),
+  KW_TYPE("int",    INT,    IntTy),    KW_TYPE("uint",   UINT,   UIntTy),
+  KW_TYPE("long",   LONG,   LongTy),   KW_TYPE("ulong",  ULONG,  ULongTy),
+  KW_TYPE("float",  FLOAT,  FloatTy),  KW_TYPE("double", DOUBLE, DoubleTy),
+  KW_TYPE("type",   TYPE,   TypeTy),   KW_TYPE("label",  LABEL,  LabelTy),
+  KW_TYPE("bb",     LABEL,  LabelTy),  // Deprecated, warned about below
+
+  KW_OP("neg", NEG, UnaryOp, Neg),     KW_OP("not", NOT, UnaryOp, Not),
+
+  KW("phi", PHI),                      KW("call", CALL),
+  KW_OP("add",   ADD,   BinaryOp, Add),   KW_OP("sub",   SUB,   BinaryOp, Sub),
+  KW_OP("mul",   MUL,   BinaryOp, Mul),   KW_OP("div",   DIV,   BinaryOp, Div),
+  KW_OP("rem",   REM,   BinaryOp, Rem),
+  KW_OP("and",   AND,   BinaryOp, And),   KW_OP("or",    OR,    BinaryOp, Or),
+  KW_OP("xor",   XOR,   BinaryOp, Xor),
+  KW_OP("setne", SETNE, BinaryOp, SetNE), KW_OP("seteq", SETEQ, BinaryOp, SetEQ),
+  KW_OP("setlt", SETLT, BinaryOp, SetLT), KW_OP("setgt", SETGT, BinaryOp, SetGT),
+  KW_OP("setle", SETLE, BinaryOp, SetLE), KW_OP("setge", SETGE, BinaryOp, SetGE),
+
+  KW_OP("ret", RET, TermOp, Ret),   KW_OP("br", BR, TermOp, Br),
+  KW_OP("switch", SWITCH, TermOp, Switch),
+
+  KW_OP("malloc",   MALLOC,   MemOp, Malloc),
+  KW_OP("alloca",   ALLOCA,   MemOp, Alloca),
+  KW_OP("free",     FREE,     MemOp, Free),
+  KW_OP("load",     LOAD,     MemOp, Load),
+  KW_OP("store",    STORE,    MemOp, Store),
+  KW_OP("getfield", GETFIELD, MemOp, GetField),
+  KW_OP("putfield", PUTFIELD, MemOp, PutField),
+};
+
+#undef KW
+#undef KW_TYPE
+#undef KW_OP
+
+// The keywords are hashed into a small open addressed table, indexed by a hash
+// of the first character, last character and length of the identifier.  This
+// table is built the first time the lexer is initialized.
+//
+static const unsigned KeywordHashSize = 256;   // Must be a power of two
+static const KeywordInfo *KeywordHash[KeywordHashSize];
 
-      197,  197,  197,  197,  197,  197,  197,  197,  197,  197,
-      197,  197,  197,  197,  197,  197,  197,  197,  197,  197,
-      197,  197
-    } ;
+static inline unsigned HashKeyword(const char *Ptr, unsigned Len) {
+  return ((unsigned char)Ptr[0]*31 + (unsigned char)Ptr[Len-1]*7 + Len) &
+         (KeywordHashSize-1);
+}
 
-static yy_state_type yy_state_buf[YY_BUF_SIZE + 2], *yy_state_ptr;
-static char *yy_full_match;
-static int yy_lp;
-#define REJECT \
-{ \
-*yy_cp = yy_hold_char; /* undo effects of setting up yytext */ \
-yy_cp = yy_full_match; /* restore poss. backed-over text */ \
-++yy_lp; \
-goto find_rule; \
+static void InitKeywordHash() {
+  unsigned NumKeywords = sizeof(KeywordTable)/sizeof(KeywordTable[0]);
+  for (unsigned i = 0; i < NumKeywords; ++i) {
+    const KeywordInfo *KI = &KeywordTable[i];
+    unsigned H = HashKeyword(KI->Name, strlen(KI->Name));
+    while (KeywordHash[H]) H = (H+1) & (KeywordHashSize-1);
+    KeywordHash[H] = KI;
+  }
 }
-#define yymore() yymore_used_but_not_detected
-#define YY_MORE_ADJ 0
-#define YY_RESTORE_YY_MORE_OFFSET
-char *yytext;
-#line 1 "Lexer.l"
-#define INITIAL 0
-/*===-- Lexer.l - Scanner for llvm assembly files ----------------*- C++ -*--=//
-//
-//  This file implements the flex scanner for LLVM assembly languages files.
-//
-//===------------------------------------------------------------------------=*/
-#define YY_NEVER_INTERACTIVE 1
-#line 21 "Lexer.l"
-#include "ParserInternals.h"
-#include "llvm/BasicBlock.h"
-#include "llvm/Method.h"
-#include "llvm/Module.h"
-#include <list>
-#include "llvmAsmParser.h"
 
-#define RET_TOK(type, Enum, sym) \
-  llvmAsmlval.type = Instruction::Enum; return sym
+// LookupKeyword - Return the keyword spelled by [Ptr, Ptr+Len), or null.
+//
+static const KeywordInfo *LookupKeyword(const char *Ptr, unsigned Len) {
+  for (unsigned H = HashKeyword(Ptr, Len); KeywordHash[H];
+       H = (H+1) & (KeywordHashSize-1)) {
+    const char *Name = KeywordHash[H]->Name;
+    if (!strncmp(Name, Ptr, Len) && Name[Len] == 0)
+      return KeywordHash[H];
+  }
+  return 0;
+}
 
+// ReturnKeyword - Fill in the token value for the keyword, and return its
+// token number.
+//
+static int ReturnKeyword(const KeywordInfo *KI, YYSTYPE *LVal) {
+  switch (KI->ValKind) {
+  case KeywordInfo::NoVal:    break;
+  case KeywordInfo::TypeVal:  LVal->TypeVal = *KI->Ty; break;
+  case KeywordInfo::UnaryOp:
+    LVal->UnaryOpVal = (Instruction::UnaryOps)KI->Opcode; break;
+  case KeywordInfo::BinaryOp:
+    LVal->BinaryOpVal = (Instruction::BinaryOps)KI->Opcode; break;
+  case KeywordInfo::TermOp:
+    LVal->TermOpVal = (Instruction::TermOps)KI->Opcode; break;
+  case KeywordInfo::MemOp:
+    LVal->MemOpVal = (Instruction::MemoryOps)KI->Opcode; break;
+  }
 
-// TODO: All of the static identifiers are figured out by the lexer, 
-// these should be hashed.
+  if (KI->Name[0] == 'b' && KI->Name[1] == 'b' && !NoWarnings)
+    cerr << "deprecated type 'bb' used!\n";
+  return KI->Token;
+}
 
+//===----------------------------------------------------------------------===//
+//                              Token helpers
+//===----------------------------------------------------------------------===//
 
-// atoull - Convert an ascii string of decimal digits into the unsigned long
-// long representation... this does not have to do input error checking, 
-// because we know that the input will be matched by a suitable regex...
+// atoull - Convert a range of ascii decimal digits into the unsigned long
+// long representation... this does not have to do input error checking,
+// because we know that the lexer only calls this on runs of digits...
 //
-uint64_t atoull(const char *Buffer) {
+static uint64_t atoull(const char *Buffer, const char *End) {
   uint64_t Result = 0;
-  for (; *Buffer; Buffer++) {
+  for (; Buffer != End; Buffer++) {
     uint64_t OldRes = Result;
     Result *= 10;
     Result += *Buffer-'0';
@@ -604,1455 +219,219 @@ uint64_t atoull(const char *Buffer) {
   return Result;
 }
 
+// CountLines - Bump the line number for every newline in [Ptr, End).
+//
+static inline void CountLines(const char *Ptr, const char *End) {
+  while ((Ptr = (const char*)memchr(Ptr, '\n', End-Ptr))) {
+    ++llvmAsmlineno;
+    if (++Ptr == End) break;
+  }
+}
 
-#define YY_NEVER_INTERACTIVE 1
-/* Comments start with a ; and go till end of line */
-/* Variable(Def) identifiers start with a % sign */
-/* Label identifiers end with a colon */
-/* Quoted names can contain any character except " and \ */
-/* [PN]Integer: match positive and negative literal integer values that
- * are preceeded by a '%' character.  These represent unnamed variable slots.
- */
-/* E[PN]Integer: match positive and negative literal integer values */
-#line 618 "Lexer.cpp"
-
-/* Macros after this point can all be overridden by user definitions in
- * section 1.
- */
-
-#ifndef YY_SKIP_YYWRAP
-#ifdef __cplusplus
-extern "C" int yywrap YY_PROTO(( void ));
-#else
-extern int yywrap YY_PROTO(( void ));
-#endif
-#endif
-
-#ifndef YY_NO_UNPUT
-static inline void yyunput YY_PROTO(( int c, char *buf_ptr ));
-#endif
-
-#ifndef yytext_ptr
-static void yy_flex_strncpy YY_PROTO(( char *, yyconst char *, int ));
-#endif
-
-#ifdef YY_NEED_STRLEN
-static int yy_flex_strlen YY_PROTO(( yyconst char * ));
-#endif
-
-#ifndef YY_NO_INPUT
-#ifdef __cplusplus
-static int yyinput YY_PROTO(( void ));
-#else
-static int input YY_PROTO(( void ));
-#endif
-#endif
-
-#if YY_STACK_USED
-static int yy_start_stack_ptr = 0;
-static int yy_start_stack_depth = 0;
-static int *yy_start_stack = 0;
-#ifndef YY_NO_PUSH_STATE
-static void yy_push_state YY_PROTO(( int new_state ));
-#endif
-#ifndef YY_NO_POP_STATE
-static void yy_pop_state YY_PROTO(( void ));
-#endif
-#ifndef YY_NO_TOP_STATE
-static int yy_top_state YY_PROTO(( void ));
-#endif
-
-#else
-#define YY_NO_PUSH_STATE 1
-#define YY_NO_POP_STATE 1
-#define YY_NO_TOP_STATE 1
-#endif
-
-#ifdef YY_MALLOC_DECL
-YY_MALLOC_DECL
-#else
-#if __STDC__
-#ifndef __cplusplus
-#include <stdlib.h>
-#endif
-#else
-/* Just try to get by without declaring the routines.  This will fail
- * miserably on non-ANSI systems for which sizeof(size_t) != sizeof(int)
- * or sizeof(void*) != sizeof(int).
- */
-#endif
-#endif
-
-/* Amount of stuff to slurp up with each read. */
-#ifndef YY_READ_BUF_SIZE
-#define YY_READ_BUF_SIZE 8192
-#endif
-
-/* Copy whatever the last rule matched to the standard output. */
-
-#ifndef ECHO
-/* This used to be an fputs(), but since the string might contain NUL's,
- * we now use fwrite().
- */
-#define ECHO (void) fwrite( yytext, yyleng, 1, yyout )
-#endif
-
-/* Gets input and stuffs it into "buf".  number of characters read, or YY_NULL,
- * is returned in "result".
- */
-#ifndef YY_INPUT
-#define YY_INPUT(buf,result,max_size) \
-	if ( yy_current_buffer->yy_is_interactive ) \
-		{ \
-		int c = '*', n; \
-		for ( n = 0; n < max_size && \
-			     (c = getc( yyin )) != EOF && c != '\n'; ++n ) \
-			buf[n] = (char) c; \
-		if ( c == '\n' ) \
-			buf[n++] = (char) c; \
-		if ( c == EOF && ferror( yyin ) ) \
-			YY_FATAL_ERROR( "input in flex scanner failed" ); \
-		result = n; \
-		} \
-	else if ( ((result = fread( buf, 1, max_size, yyin )) == 0) \
-		  && ferror( yyin ) ) \
-		YY_FATAL_ERROR( "input in flex scanner failed" );
-#endif
-
-/* No semi-colon after return; correct usage is to write "yyterminate();" -
- * we don't want an extra ';' after the "return" because that will cause
- * some compilers to complain about unreachable statements.
- */
-#ifndef yyterminate
-#define yyterminate() return YY_NULL
-#endif
-
-/* Number of entries by which start-condition stack grows. */
-#ifndef YY_START_STACK_INCR
-#define YY_START_STACK_INCR 25
-#endif
-
-/* Report a fatal error. */
-#ifndef YY_FATAL_ERROR
-#define YY_FATAL_ERROR(msg) yy_fatal_error( msg )
-#endif
-
-/* Default declaration of generated scanner - a define so the user can
- * easily add parameters.
- */
-#ifndef YY_DECL
-#define YY_DECL int yylex YY_PROTO(( void ))
-#endif
-
-/* Code executed at the beginning of each rule, after yytext and yyleng
- * have been set up.
- */
-#ifndef YY_USER_ACTION
-#define YY_USER_ACTION
-#endif
-
-/* Code executed at the end of each rule. */
-#ifndef YY_BREAK
-#define YY_BREAK break;
-#endif
-
-#define YY_RULE_SETUP \
-	YY_USER_ACTION
-
-YY_DECL
-	{
-	register yy_state_type yy_current_state;
-	register char *yy_cp, *yy_bp;
-	register int yy_act;
-
-#line 83 "Lexer.l"
-
-
-#line 772 "Lexer.cpp"
-
-	if ( yy_init )
-		{
-		yy_init = 0;
-
-#ifdef YY_USER_INIT
-		YY_USER_INIT;
-#endif
-
-		if ( ! yy_start )
-			yy_start = 1;	/* first start state */
-
-		if ( ! yyin )
-			yyin = stdin;
-
-		if ( ! yyout )
-			yyout = stdout;
-
-		if ( ! yy_current_buffer )
-			yy_current_buffer =
-				yy_create_buffer( yyin, YY_BUF_SIZE );
-
-		yy_load_buffer_state();
-		}
-
-	while ( 1 )		/* loops until end-of-file is reached */
-		{
-		yy_cp = yy_c_buf_p;
-
-		/* Support of yytext. */
-		*yy_cp = yy_hold_char;
-
-		/* yy_bp points to the position in yy_ch_buf of the start of
-		 * the current run.
-		 */
-		yy_bp = yy_cp;
-
-		yy_current_state = yy_start;
-		yy_state_ptr = yy_state_buf;
-		*yy_state_ptr++ = yy_current_state;
-yy_match:
-		do
-			{
-			register YY_CHAR yy_c = yy_ec[YY_SC_TO_UI(*yy_cp)];
-			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-				{
-				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 198 )
-					yy_c = yy_meta[(unsigned int) yy_c];
-				}
-			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-			*yy_state_ptr++ = yy_current_state;
-			++yy_cp;
-			}
-		while ( yy_current_state != 197 );
-
-yy_find_action:
-		yy_current_state = *--yy_state_ptr;
-		yy_lp = yy_accept[yy_current_state];
-		for ( ; ; ) /* until we find what rule we matched */
-			{
-			if ( yy_lp && yy_lp < yy_accept[yy_current_state + 1] )
-				{
-				yy_act = yy_acclist[yy_lp];
-					{
-					yy_full_match = yy_cp;
-					break;
-					}
-				}
-			--yy_cp;
-			yy_current_state = *--yy_state_ptr;
-			yy_lp = yy_accept[yy_current_state];
-			}
-
-		YY_DO_BEFORE_ACTION;
-
-		if ( yy_act != YY_END_OF_BUFFER )
-			{
-			int yyl;
-			for ( yyl = 0; yyl < yyleng; ++yyl )
-				if ( yytext[yyl] == '\n' )
-					++yylineno;
-			}
-
-do_action:	/* This label is used only to access EOF actions. */
-
-
-		switch ( yy_act )
-	{ /* beginning of action switch */
-case 1:
-YY_RULE_SETUP
-#line 85 "Lexer.l"
-{ /* Ignore comments for now */ }
-	YY_BREAK
-case 2:
-YY_RULE_SETUP
-#line 87 "Lexer.l"
-{ return BEGINTOK; }
-	YY_BREAK
-case 3:
-YY_RULE_SETUP
-#line 88 "Lexer.l"
-{ return END; }
-	YY_BREAK
-case 4:
-YY_RULE_SETUP
-#line 89 "Lexer.l"
-{ return TRUE;  }
-	YY_BREAK
-case 5:
-YY_RULE_SETUP
-#line 90 "Lexer.l"
-{ return FALSE; }
-	YY_BREAK
-case 6:
-YY_RULE_SETUP
-#line 91 "Lexer.l"
-{ return DECLARE; }
-	YY_BREAK
-case 7:
-YY_RULE_SETUP
-#line 92 "Lexer.l"
-{ return IMPLEMENTATION; }
-	YY_BREAK
-case 8:
-YY_RULE_SETUP
-#line 94 "Lexer.l"
-{ cerr << "deprecated argument '-' used!\n"; return '-'; }
-	YY_BREAK
-case 9:
-YY_RULE_SETUP
-#line 95 "Lexer.l"
-{ cerr << "deprecated type 'bb' used!\n"; llvmAsmlval.TypeVal = Type::LabelTy; return LABEL;}
-	YY_BREAK
-case 10:
-YY_RULE_SETUP
-#line 97 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::VoidTy  ; return VOID;   }
-	YY_BREAK
-case 11:
-YY_RULE_SETUP
-#line 98 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::BoolTy  ; return BOOL;   }
-	YY_BREAK
-case 12:
-YY_RULE_SETUP
-#line 99 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::SByteTy ; return SBYTE;  }
-	YY_BREAK
-case 13:
-YY_RULE_SETUP
-#line 100 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::UByteTy ; return UBYTE;  }
-	YY_BREAK
-case 14:
-YY_RULE_SETUP
-#line 101 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::ShortTy ; return SHORT;  }
-	YY_BREAK
-case 15:
-YY_RULE_SETUP
-#line 102 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::UShortTy; return USHORT; }
-	YY_BREAK
-case 16:
-YY_RULE_SETUP
-#line 103 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::IntTy   ; return INT;    }
-	YY_BREAK
-case 17:
-YY_RULE_SETUP
-#line 104 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::UIntTy  ; return UINT;   }
-	YY_BREAK
-case 18:
-YY_RULE_SETUP
-#line 105 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::LongTy  ; return LONG;   }
-	YY_BREAK
-case 19:
-YY_RULE_SETUP
-#line 106 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::ULongTy ; return ULONG;  }
-	YY_BREAK
-case 20:
-YY_RULE_SETUP
-#line 107 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::FloatTy ; return FLOAT;  }
-	YY_BREAK
-case 21:
-YY_RULE_SETUP
-#line 108 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::DoubleTy; return DOUBLE; }
-	YY_BREAK
-case 22:
-YY_RULE_SETUP
-#line 110 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::TypeTy  ; return TYPE;   }
-	YY_BREAK
-case 23:
-YY_RULE_SETUP
-#line 112 "Lexer.l"
-{ llvmAsmlval.TypeVal = Type::LabelTy ; return LABEL;  }
-	YY_BREAK
-case 24:
-YY_RULE_SETUP
-#line 114 "Lexer.l"
-{ RET_TOK(UnaryOpVal, Neg, NEG); }
-	YY_BREAK
-case 25:
-YY_RULE_SETUP
-#line 115 "Lexer.l"
-{ RET_TOK(UnaryOpVal, Not, NOT); }
-	YY_BREAK
-case 26:
-YY_RULE_SETUP
-#line 117 "Lexer.l"
-{ return PHI; }
-	YY_BREAK
-case 27:
-YY_RULE_SETUP
-#line 118 "Lexer.l"
-{ return CALL; }
-	YY_BREAK
-case 28:
-YY_RULE_SETUP
-#line 119 "Lexer.l"
-{ RET_TOK(BinaryOpVal, Add, ADD); }
-	YY_BREAK
-case 29:
-YY_RULE_SETUP
-#line 120 "Lexer.l"
-{ RET_TOK(BinaryOpVal, Sub, SUB); }
-	YY_BREAK
-case 30:
-YY_RULE_SETUP
-#line 121 "Lexer.l"
-{ RET_TOK(BinaryOpVal, Mul, MUL); }
-	YY_BREAK
-case 31:
-YY_RULE_SETUP
-#line 122 "Lexer.l"
-{ RET_TOK(BinaryOpVal, Div, DIV); }
-	YY_BREAK
-case 32:
-YY_RULE_SETUP
-#line 123 "Lexer.l"
-{ RET_TOK(BinaryOpVal, Rem, REM); }
-	YY_BREAK
-case 33:
-YY_RULE_SETUP
-#line 124 "Lexer.l"
-{ RET_TOK(BinaryOpVal, SetNE, SETNE); }
-	YY_BREAK
-case 34:
-YY_RULE_SETUP
-#line 125 "Lexer.l"
-{ RET_TOK(BinaryOpVal, SetEQ, SETEQ); }
-	YY_BREAK
-case 35:
-YY_RULE_SETUP
-#line 126 "Lexer.l"
-{ RET_TOK(BinaryOpVal, SetLT, SETLT); }
-	YY_BREAK
-case 36:
-YY_RULE_SETUP
-#line 127 "Lexer.l"
-{ RET_TOK(BinaryOpVal, SetGT, SETGT); }
-	YY_BREAK
-case 37:
-YY_RULE_SETUP
-#line 128 "Lexer.l"
-{ RET_TOK(BinaryOpVal, SetLE, SETLE); }
-	YY_BREAK
-case 38:
-YY_RULE_SETUP
-#line 129 "Lexer.l"
-{ RET_TOK(BinaryOpVal, SetGE, SETGE); }
-	YY_BREAK
-case 39:
-YY_RULE_SETUP
-#line 131 "Lexer.l"
-{ RET_TOK(TermOpVal, Ret, RET); }
-	YY_BREAK
-case 40:
-YY_RULE_SETUP
-#line 132 "Lexer.l"
-{ RET_TOK(TermOpVal, Br, BR); }
-	YY_BREAK
-case 41:
-YY_RULE_SETUP
-#line 133 "Lexer.l"
-{ RET_TOK(TermOpVal, Switch, SWITCH); }
-	YY_BREAK
-case 42:
-YY_RULE_SETUP
-#line 136 "Lexer.l"
-{ RET_TOK(MemOpVal, Malloc, MALLOC); }
-	YY_BREAK
-case 43:
-YY_RULE_SETUP
-#line 137 "Lexer.l"
-{ RET_TOK(MemOpVal, Alloca, ALLOCA); }
-	YY_BREAK
-case 44:
-YY_RULE_SETUP
-#line 138 "Lexer.l"
-{ RET_TOK(MemOpVal, Free, FREE); }
-	YY_BREAK
-case 45:
-YY_RULE_SETUP
-#line 139 "Lexer.l"
-{ RET_TOK(MemOpVal, Load, LOAD); }
-	YY_BREAK
-case 46:
-YY_RULE_SETUP
-#line 140 "Lexer.l"
-{ RET_TOK(MemOpVal, Store, STORE); }
-	YY_BREAK
-case 47:
-YY_RULE_SETUP
-#line 141 "Lexer.l"
-{ RET_TOK(MemOpVal, GetField, GETFIELD); }
-	YY_BREAK
-case 48:
-YY_RULE_SETUP
-#line 142 "Lexer.l"
-{ RET_TOK(MemOpVal, PutField, PUTFIELD); }
-	YY_BREAK
-case 49:
-YY_RULE_SETUP
-#line 145 "Lexer.l"
-{ llvmAsmlval.StrVal = strdup(yytext+1); return VAR_ID; }
-	YY_BREAK
-case 50:
-YY_RULE_SETUP
-#line 146 "Lexer.l"
-{ 
-                  yytext[strlen(yytext)-1] = 0;  // nuke colon
-		  llvmAsmlval.StrVal = strdup(yytext); 
-		  return LABELSTR; 
-                }
-	YY_BREAK
-case 51:
-YY_RULE_SETUP
-#line 152 "Lexer.l"
-{ 
-                  yytext[strlen(yytext)-1] = 0;           // nuke end quote
-		  llvmAsmlval.StrVal = strdup(yytext+1);  // Nuke start quote 
-		  return STRINGCONSTANT;
-                }
-	YY_BREAK
-case 52:
-YY_RULE_SETUP
-#line 159 "Lexer.l"
-{ llvmAsmlval.UInt64Val = atoull(yytext); return EUINT64VAL; }
-	YY_BREAK
-case 53:
-YY_RULE_SETUP
-#line 160 "Lexer.l"
-{ 
-                  uint64_t Val = atoull(yytext+1);
-		  // +1:  we have bigger negative range
-		  if (Val > (uint64_t)INT64_MAX+1)
-		    ThrowException("Constant too large for signed 64 bits!");
-                  llvmAsmlval.SInt64Val = -Val; 
-		  return ESINT64VAL; 
-                }
-	YY_BREAK
-case 54:
-YY_RULE_SETUP
-#line 170 "Lexer.l"
-{ llvmAsmlval.UIntVal = atoull(yytext+1); return UINTVAL; }
-	YY_BREAK
-case 55:
-YY_RULE_SETUP
-#line 171 "Lexer.l"
-{
-                  uint64_t Val = atoull(yytext+2);
-		  // +1:  we have bigger negative range
-		  if (Val > (uint64_t)INT32_MAX+1)
-		    ThrowException("Constant too large for signed 32 bits!");
-                  llvmAsmlval.SIntVal = -Val;
-		  return SINTVAL;
-                }
-	YY_BREAK
-case 56:
-YY_RULE_SETUP
-#line 181 "Lexer.l"
-{ /* Ignore whitespace */ }
-	YY_BREAK
-case 57:
-YY_RULE_SETUP
-#line 182 "Lexer.l"
-{ /*printf("'%s'", yytext);*/ return yytext[0]; }
-	YY_BREAK
-case 58:
-YY_RULE_SETUP
-#line 184 "Lexer.l"
-YY_FATAL_ERROR( "flex scanner jammed" );
-	YY_BREAK
-#line 1175 "Lexer.cpp"
-			case YY_STATE_EOF(INITIAL):
-				yyterminate();
-
-	case YY_END_OF_BUFFER:
-		{
-		/* Amount of text matched not including the EOB char. */
-		int yy_amount_of_matched_text = (int) (yy_cp - yytext_ptr) - 1;
-
-		/* Undo the effects of YY_DO_BEFORE_ACTION. */
-		*yy_cp = yy_hold_char;
-		YY_RESTORE_YY_MORE_OFFSET
-
-		if ( yy_current_buffer->yy_buffer_status == YY_BUFFER_NEW )
-			{
-			/* We're scanning a new file or input source.  It's
-			 * possible that this happened because the user
-			 * just pointed yyin at a new source and called
-			 * yylex().  If so, then we have to assure
-			 * consistency between yy_current_buffer and our
-			 * globals.  Here is the right place to do so, because
-			 * this is the first action (other than possibly a
-			 * back-up) that will match for the new input source.
-			 */
-			yy_n_chars = yy_current_buffer->yy_n_chars;
-			yy_current_buffer->yy_input_file = yyin;
-			yy_current_buffer->yy_buffer_status = YY_BUFFER_NORMAL;
-			}
-
-		/* Note that here we test for yy_c_buf_p "<=" to the position
-		 * of the first EOB in the buffer, since yy_c_buf_p will
-		 * already have been incremented past the NUL character
-		 * (since all states make transitions on EOB to the
-		 * end-of-buffer state).  Contrast this with the test
-		 * in input().
-		 */
-		if ( yy_c_buf_p <= &yy_current_buffer->yy_ch_buf[yy_n_chars] )
-			{ /* This was really a NUL. */
-			yy_state_type yy_next_state;
-
-			yy_c_buf_p = yytext_ptr + yy_amount_of_matched_text;
-
-			yy_current_state = yy_get_previous_state();
-
-			/* Okay, we're now positioned to make the NUL
-			 * transition.  We couldn't have
-			 * yy_get_previous_state() go ahead and do it
-			 * for us because it doesn't know how to deal
-			 * with the possibility of jamming (and we don't
-			 * want to build jamming into it because then it
-			 * will run more slowly).
-			 */
-
-			yy_next_state = yy_try_NUL_trans( yy_current_state );
-
-			yy_bp = yytext_ptr + YY_MORE_ADJ;
-
-			if ( yy_next_state )
-				{
-				/* Consume the NUL. */
-				yy_cp = ++yy_c_buf_p;
-				yy_current_state = yy_next_state;
-				goto yy_match;
-				}
-
-			else
-				{
-				yy_cp = yy_c_buf_p;
-				goto yy_find_action;
-				}
-			}
-
-		else switch ( yy_get_next_buffer() )
-			{
-			case EOB_ACT_END_OF_FILE:
-				{
-				yy_did_buffer_switch_on_eof = 0;
-
-				if ( yywrap() )
-					{
-					/* Note: because we've taken care in
-					 * yy_get_next_buffer() to have set up
-					 * yytext, we can now set up
-					 * yy_c_buf_p so that if some total
-					 * hoser (like flex itself) wants to
-					 * call the scanner after we return the
-					 * YY_NULL, it'll still work - another
-					 * YY_NULL will get returned.
-					 */
-					yy_c_buf_p = yytext_ptr + YY_MORE_ADJ;
-
-					yy_act = YY_STATE_EOF(YY_START);
-					goto do_action;
-					}
-
-				else
-					{
-					if ( ! yy_did_buffer_switch_on_eof )
-						YY_NEW_FILE;
-					}
-				break;
-				}
-
-			case EOB_ACT_CONTINUE_SCAN:
-				yy_c_buf_p =
-					yytext_ptr + yy_amount_of_matched_text;
-
-				yy_current_state = yy_get_previous_state();
-
-				yy_cp = yy_c_buf_p;
-				yy_bp = yytext_ptr + YY_MORE_ADJ;
-				goto yy_match;
-
-			case EOB_ACT_LAST_MATCH:
-				yy_c_buf_p =
-				&yy_current_buffer->yy_ch_buf[yy_n_chars];
-
-				yy_current_state = yy_get_previous_state();
-
-				yy_cp = yy_c_buf_p;
-				yy_bp = yytext_ptr + YY_MORE_ADJ;
-				goto yy_find_action;
-			}
-		break;
-		}
-
-	default:
-		YY_FATAL_ERROR(
-			"fatal flex scanner internal error--no action found" );
-	} /* end of action switch */
-		} /* end of scanning one token */
-	} /* end of yylex */
-
-
-/* yy_get_next_buffer - try to read in a new buffer
- *
- * Returns a code representing an action:
- *	EOB_ACT_LAST_MATCH -
- *	EOB_ACT_CONTINUE_SCAN - continue scanning from current position
- *	EOB_ACT_END_OF_FILE - end of file
- */
-
-static int yy_get_next_buffer()
-	{
-	register char *dest = yy_current_buffer->yy_ch_buf;
-	register char *source = yytext_ptr;
-	register int number_to_move, i;
-	int ret_val;
-
-	if ( yy_c_buf_p > &yy_current_buffer->yy_ch_buf[yy_n_chars + 1] )
-		YY_FATAL_ERROR(
-		"fatal flex scanner internal error--end of buffer missed" );
-
-	if ( yy_current_buffer->yy_fill_buffer == 0 )
-		{ /* Don't try to fill the buffer, so this is an EOF. */
-		if ( yy_c_buf_p - yytext_ptr - YY_MORE_ADJ == 1 )
-			{
-			/* We matched a single character, the EOB, so
-			 * treat this as a final EOF.
-			 */
-			return EOB_ACT_END_OF_FILE;
-			}
-
-		else
-			{
-			/* We matched some text prior to the EOB, first
-			 * process it.
-			 */
-			return EOB_ACT_LAST_MATCH;
-			}
-		}
-
-	/* Try to read more data. */
-
-	/* First move last chars to start of buffer. */
-	number_to_move = (int) (yy_c_buf_p - yytext_ptr) - 1;
-
-	for ( i = 0; i < number_to_move; ++i )
-		*(dest++) = *(source++);
-
-	if ( yy_current_buffer->yy_buffer_status == YY_BUFFER_EOF_PENDING )
-		/* don't do the read, it's not guaranteed to return an EOF,
-		 * just force an EOF
-		 */
-		yy_current_buffer->yy_n_chars = yy_n_chars = 0;
-
-	else
-		{
-		int num_to_read =
-			yy_current_buffer->yy_buf_size - number_to_move - 1;
-
-		while ( num_to_read <= 0 )
-			{ /* Not enough room in the buffer - grow it. */
-#ifdef YY_USES_REJECT
-			YY_FATAL_ERROR(
-"input buffer overflow, can't enlarge buffer because scanner uses REJECT" );
-#else
-
-			/* just a shorter name for the current buffer */
-			YY_BUFFER_STATE b = yy_current_buffer;
-
-			int yy_c_buf_p_offset =
-				(int) (yy_c_buf_p - b->yy_ch_buf);
-
-			if ( b->yy_is_our_buffer )
-				{
-				int new_size = b->yy_buf_size * 2;
-
-				if ( new_size <= 0 )
-					b->yy_buf_size += b->yy_buf_size / 8;
-				else
-					b->yy_buf_size *= 2;
-
-				b->yy_ch_buf = (char *)
-					/* Include room in for 2 EOB chars. */
-					yy_flex_realloc( (void *) b->yy_ch_buf,
-							 b->yy_buf_size + 2 );
-				}
-			else
-				/* Can't grow it, we don't own it. */
-				b->yy_ch_buf = 0;
-
-			if ( ! b->yy_ch_buf )
-				YY_FATAL_ERROR(
-				"fatal error - scanner input buffer overflow" );
-
-			yy_c_buf_p = &b->yy_ch_buf[yy_c_buf_p_offset];
-
-			num_to_read = yy_current_buffer->yy_buf_size -
-						number_to_move - 1;
-#endif
-			}
-
-		if ( num_to_read > YY_READ_BUF_SIZE )
-			num_to_read = YY_READ_BUF_SIZE;
-
-		/* Read in more data. */
-		YY_INPUT( (&yy_current_buffer->yy_ch_buf[number_to_move]),
-			yy_n_chars, num_to_read );
-
-		yy_current_buffer->yy_n_chars = yy_n_chars;
-		}
-
-	if ( yy_n_chars == 0 )
-		{
-		if ( number_to_move == YY_MORE_ADJ )
-			{
-			ret_val = EOB_ACT_END_OF_FILE;
-			yyrestart( yyin );
-			}
-
-		else
-			{
-			ret_val = EOB_ACT_LAST_MATCH;
-			yy_current_buffer->yy_buffer_status =
-				YY_BUFFER_EOF_PENDING;
-			}
-		}
-
-	else
-		ret_val = EOB_ACT_CONTINUE_SCAN;
-
-	yy_n_chars += number_to_move;
-	yy_current_buffer->yy_ch_buf[yy_n_chars] = YY_END_OF_BUFFER_CHAR;
-	yy_current_buffer->yy_ch_buf[yy_n_chars + 1] = YY_END_OF_BUFFER_CHAR;
-
-	yytext_ptr = &yy_current_buffer->yy_ch_buf[0];
-
-	return ret_val;
-	}
-
-
-/* yy_get_previous_state - get the state just before the EOB char was reached */
-
-static yy_state_type yy_get_previous_state()
-	{
-	register yy_state_type yy_current_state;
-	register char *yy_cp;
-
-	yy_current_state = yy_start;
-	yy_state_ptr = yy_state_buf;
-	*yy_state_ptr++ = yy_current_state;
-
-	for ( yy_cp = yytext_ptr + YY_MORE_ADJ; yy_cp < yy_c_buf_p; ++yy_cp )
-		{
-		register YY_CHAR yy_c = (*yy_cp ? yy_ec[YY_SC_TO_UI(*yy_cp)] : 1);
-		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-			{
-			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 198 )
-				yy_c = yy_meta[(unsigned int) yy_c];
-			}
-		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-		*yy_state_ptr++ = yy_current_state;
-		}
-
-	return yy_current_state;
-	}
-
-
-/* yy_try_NUL_trans - try to make a transition on the NUL character
- *
- * synopsis
- *	next_state = yy_try_NUL_trans( current_state );
- */
-
-#ifdef YY_USE_PROTOS
-static yy_state_type yy_try_NUL_trans( yy_state_type yy_current_state )
-#else
-static yy_state_type yy_try_NUL_trans( yy_current_state )
-yy_state_type yy_current_state;
-#endif
-	{
-	register int yy_is_jam;
-
-	register YY_CHAR yy_c = 1;
-	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
-		{
-		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 198 )
-			yy_c = yy_meta[(unsigned int) yy_c];
-		}
-	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 197);
-	if ( ! yy_is_jam )
-		*yy_state_ptr++ = yy_current_state;
-
-	return yy_is_jam ? 0 : yy_current_state;
-	}
-
-
-#ifndef YY_NO_UNPUT
-#ifdef YY_USE_PROTOS
-static inline void yyunput( int c, register char *yy_bp )
-#else
-static inline void yyunput( c, yy_bp )
-int c;
-register char *yy_bp;
-#endif
-	{
-	register char *yy_cp = yy_c_buf_p;
-
-	/* undo effects of setting up yytext */
-	*yy_cp = yy_hold_char;
-
-	if ( yy_cp < yy_current_buffer->yy_ch_buf + 2 )
-		{ /* need to shift things up to make room */
-		/* +2 for EOB chars. */
-		register int number_to_move = yy_n_chars + 2;
-		register char *dest = &yy_current_buffer->yy_ch_buf[
-					yy_current_buffer->yy_buf_size + 2];
-		register char *source =
-				&yy_current_buffer->yy_ch_buf[number_to_move];
-
-		while ( source > yy_current_buffer->yy_ch_buf )
-			*--dest = *--source;
-
-		yy_cp += (int) (dest - source);
-		yy_bp += (int) (dest - source);
-		yy_current_buffer->yy_n_chars =
-			yy_n_chars = yy_current_buffer->yy_buf_size;
-
-		if ( yy_cp < yy_current_buffer->yy_ch_buf + 2 )
-			YY_FATAL_ERROR( "flex scanner push-back overflow" );
-		}
-
-	*--yy_cp = (char) c;
-
-	if ( c == '\n' )
-		--yylineno;
-
-	yytext_ptr = yy_bp;
-	yy_hold_char = *yy_cp;
-	yy_c_buf_p = yy_cp;
-	}
-#endif	/* ifndef YY_NO_UNPUT */
-
-
-#ifdef __cplusplus
-static int yyinput()
-#else
-static int input()
-#endif
-	{
-	int c;
-
-	*yy_c_buf_p = yy_hold_char;
-
-	if ( *yy_c_buf_p == YY_END_OF_BUFFER_CHAR )
-		{
-		/* yy_c_buf_p now points to the character we want to return.
-		 * If this occurs *before* the EOB characters, then it's a
-		 * valid NUL; if not, then we've hit the end of the buffer.
-		 */
-		if ( yy_c_buf_p < &yy_current_buffer->yy_ch_buf[yy_n_chars] )
-			/* This was really a NUL. */
-			*yy_c_buf_p = '\0';
-
-		else
-			{ /* need more input */
-			int offset = yy_c_buf_p - yytext_ptr;
-			++yy_c_buf_p;
-
-			switch ( yy_get_next_buffer() )
-				{
-				case EOB_ACT_LAST_MATCH:
-					/* This happens because yy_g_n_b()
-					 * sees that we've accumulated a
-					 * token and flags that we need to
-					 * try matching the token before
-					 * proceeding.  But for input(),
-					 * there's no matching to consider.
-					 * So convert the EOB_ACT_LAST_MATCH
-					 * to EOB_ACT_END_OF_FILE.
-					 */
-
-					/* Reset buffer status. */
-					yyrestart( yyin );
-
-					/* fall through */
-
-				case EOB_ACT_END_OF_FILE:
-					{
-					if ( yywrap() )
-						return EOF;
-
-					if ( ! yy_did_buffer_switch_on_eof )
-						YY_NEW_FILE;
-#ifdef __cplusplus
-					return yyinput();
-#else
-					return input();
-#endif
-					}
-
-				case EOB_ACT_CONTINUE_SCAN:
-					yy_c_buf_p = yytext_ptr + offset;
-					break;
-				}
-			}
-		}
-
-	c = *(unsigned char *) yy_c_buf_p;	/* cast for 8-bit char's */
-	*yy_c_buf_p = '\0';	/* preserve yytext */
-	yy_hold_char = *++yy_c_buf_p;
-
-	if ( c == '\n' )
-		++yylineno;
-
-	return c;
-	}
-
-
-#ifdef YY_USE_PROTOS
-void yyrestart( FILE *input_file )
-#else
-void yyrestart( input_file )
-FILE *input_file;
-#endif
-	{
-	if ( ! yy_current_buffer )
-		yy_current_buffer = yy_create_buffer( yyin, YY_BUF_SIZE );
-
-	yy_init_buffer( yy_current_buffer, input_file );
-	yy_load_buffer_state();
-	}
-
-
-#ifdef YY_USE_PROTOS
-void yy_switch_to_buffer( YY_BUFFER_STATE new_buffer )
-#else
-void yy_switch_to_buffer( new_buffer )
-YY_BUFFER_STATE new_buffer;
-#endif
-	{
-	if ( yy_current_buffer == new_buffer )
-		return;
-
-	if ( yy_current_buffer )
-		{
-		/* Flush out information for old buffer. */
-		*yy_c_buf_p = yy_hold_char;
-		yy_current_buffer->yy_buf_pos = yy_c_buf_p;
-		yy_current_buffer->yy_n_chars = yy_n_chars;
-		}
-
-	yy_current_buffer = new_buffer;
-	yy_load_buffer_state();
-
-	/* We don't actually know whether we did this switch during
-	 * EOF (yywrap()) processing, but the only time this flag
-	 * is looked at is after yywrap() is called, so it's safe
-	 * to go ahead and always set it.
-	 */
-	yy_did_buffer_switch_on_eof = 1;
-	}
-
-
-#ifdef YY_USE_PROTOS
-void yy_load_buffer_state( void )
-#else
-void yy_load_buffer_state()
-#endif
-	{
-	yy_n_chars = yy_current_buffer->yy_n_chars;
-	yytext_ptr = yy_c_buf_p = yy_current_buffer->yy_buf_pos;
-	yyin = yy_current_buffer->yy_input_file;
-	yy_hold_char = *yy_c_buf_p;
-	}
-
-
-#ifdef YY_USE_PROTOS
-YY_BUFFER_STATE yy_create_buffer( FILE *file, int size )
-#else
-YY_BUFFER_STATE yy_create_buffer( file, size )
-FILE *file;
-int size;
-#endif
-	{
-	YY_BUFFER_STATE b;
-
-	b = (YY_BUFFER_STATE) yy_flex_alloc( sizeof( struct yy_buffer_state ) );
-	if ( ! b )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
-
-	b->yy_buf_size = size;
-
-	/* yy_ch_buf has to be 2 characters longer than the size given because
-	 * we need to put in 2 end-of-buffer characters.
-	 */
-	b->yy_ch_buf = (char *) yy_flex_alloc( b->yy_buf_size + 2 );
-	if ( ! b->yy_ch_buf )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_create_buffer()" );
-
-	b->yy_is_our_buffer = 1;
-
-	yy_init_buffer( b, file );
-
-	return b;
-	}
-
-
-#ifdef YY_USE_PROTOS
-void yy_delete_buffer( YY_BUFFER_STATE b )
-#else
-void yy_delete_buffer( b )
-YY_BUFFER_STATE b;
-#endif
-	{
-	if ( ! b )
-		return;
-
-	if ( b == yy_current_buffer )
-		yy_current_buffer = (YY_BUFFER_STATE) 0;
-
-	if ( b->yy_is_our_buffer )
-		yy_flex_free( (void *) b->yy_ch_buf );
-
-	yy_flex_free( (void *) b );
-	}
-
-
-#ifndef YY_ALWAYS_INTERACTIVE
-#ifndef YY_NEVER_INTERACTIVE
-extern int isatty YY_PROTO(( int ));
-#endif
-#endif
-
-#ifdef YY_USE_PROTOS
-void yy_init_buffer( YY_BUFFER_STATE b, FILE *file )
-#else
-void yy_init_buffer( b, file )
-YY_BUFFER_STATE b;
-FILE *file;
-#endif
-
-
-	{
-	yy_flush_buffer( b );
-
-	b->yy_input_file = file;
-	b->yy_fill_buffer = 1;
-
-#if YY_ALWAYS_INTERACTIVE
-	b->yy_is_interactive = 1;
-#else
-#if YY_NEVER_INTERACTIVE
-	b->yy_is_interactive = 0;
-#else
-	b->yy_is_interactive = file ? (isatty( fileno(file) ) > 0) : 0;
-#endif
-#endif
-	}
-
-
-#ifdef YY_USE_PROTOS
-void yy_flush_buffer( YY_BUFFER_STATE b )
-#else
-void yy_flush_buffer( b )
-YY_BUFFER_STATE b;
-#endif
-
-	{
-	if ( ! b )
-		return;
-
-	b->yy_n_chars = 0;
-
-	/* We always need two end-of-buffer characters.  The first causes
-	 * a transition to the end-of-buffer state.  The second causes
-	 * a jam in that state.
-	 */
-	b->yy_ch_buf[0] = YY_END_OF_BUFFER_CHAR;
-	b->yy_ch_buf[1] = YY_END_OF_BUFFER_CHAR;
-
-	b->yy_buf_pos = &b->yy_ch_buf[0];
-
-	b->yy_at_bol = 1;
-	b->yy_buffer_status = YY_BUFFER_NEW;
-
-	if ( b == yy_current_buffer )
-		yy_load_buffer_state();
-	}
-
-
-#ifndef YY_NO_SCAN_BUFFER
-#ifdef YY_USE_PROTOS
-YY_BUFFER_STATE yy_scan_buffer( char *base, yy_size_t size )
-#else
-YY_BUFFER_STATE yy_scan_buffer( base, size )
-char *base;
-yy_size_t size;
-#endif
-	{
-	YY_BUFFER_STATE b;
-
-	if ( size < 2 ||
-	     base[size-2] != YY_END_OF_BUFFER_CHAR ||
-	     base[size-1] != YY_END_OF_BUFFER_CHAR )
-		/* They forgot to leave room for the EOB's. */
-		return 0;
-
-	b = (YY_BUFFER_STATE) yy_flex_alloc( sizeof( struct yy_buffer_state ) );
-	if ( ! b )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_buffer()" );
-
-	b->yy_buf_size = size - 2;	/* "- 2" to take care of EOB's */
-	b->yy_buf_pos = b->yy_ch_buf = base;
-	b->yy_is_our_buffer = 0;
-	b->yy_input_file = 0;
-	b->yy_n_chars = b->yy_buf_size;
-	b->yy_is_interactive = 0;
-	b->yy_at_bol = 1;
-	b->yy_fill_buffer = 0;
-	b->yy_buffer_status = YY_BUFFER_NEW;
-
-	yy_switch_to_buffer( b );
-
-	return b;
-	}
-#endif
-
-
-#ifndef YY_NO_SCAN_STRING
-#ifdef YY_USE_PROTOS
-YY_BUFFER_STATE yy_scan_string( yyconst char *yy_str )
-#else
-YY_BUFFER_STATE yy_scan_string( yy_str )
-yyconst char *yy_str;
-#endif
-	{
-	int len;
-	for ( len = 0; yy_str[len]; ++len )
-		;
-
-	return yy_scan_bytes( yy_str, len );
-	}
-#endif
-
-
-#ifndef YY_NO_SCAN_BYTES
-#ifdef YY_USE_PROTOS
-YY_BUFFER_STATE yy_scan_bytes( yyconst char *bytes, int len )
-#else
-YY_BUFFER_STATE yy_scan_bytes( bytes, len )
-yyconst char *bytes;
-int len;
-#endif
-	{
-	YY_BUFFER_STATE b;
-	char *buf;
-	yy_size_t n;
-	int i;
-
-	/* Get memory for full buffer, including space for trailing EOB's. */
-	n = len + 2;
-	buf = (char *) yy_flex_alloc( n );
-	if ( ! buf )
-		YY_FATAL_ERROR( "out of dynamic memory in yy_scan_bytes()" );
-
-	for ( i = 0; i < len; ++i )
-		buf[i] = bytes[i];
-
-	buf[len] = buf[len+1] = YY_END_OF_BUFFER_CHAR;
-
-	b = yy_scan_buffer( buf, n );
-	if ( ! b )
-		YY_FATAL_ERROR( "bad buffer in yy_scan_bytes()" );
-
-	/* It's okay to grow etc. this buffer, and we should throw it
-	 * away when we're done.
-	 */
-	b->yy_is_our_buffer = 1;
-
-	return b;
-	}
-#endif
-
-
-#ifndef YY_NO_PUSH_STATE
-#ifdef YY_USE_PROTOS
-static void yy_push_state( int new_state )
-#else
-static void yy_push_state( new_state )
-int new_state;
-#endif
-	{
-	if ( yy_start_stack_ptr >= yy_start_stack_depth )
-		{
-		yy_size_t new_size;
-
-		yy_start_stack_depth += YY_START_STACK_INCR;
-		new_size = yy_start_stack_depth * sizeof( int );
-
-		if ( ! yy_start_stack )
-			yy_start_stack = (int *) yy_flex_alloc( new_size );
-
-		else
-			yy_start_stack = (int *) yy_flex_realloc(
-					(void *) yy_start_stack, new_size );
-
-		if ( ! yy_start_stack )
-			YY_FATAL_ERROR(
-			"out of memory expanding start-condition stack" );
-		}
-
-	yy_start_stack[yy_start_stack_ptr++] = YY_START;
+// LexIdentifier - Lex a token starting with [a-zA-Z$._0-9]: a label, a keyword
+// or a positive integer.
+//
+static int LexIdentifier(const char *TokStart, YYSTYPE *LVal) {
+  const char *End = SkipWhile(TokStart, CC_IdChar);
 
-	BEGIN(new_state);
-	}
-#endif
+  if (End != BufferEnd && *End == ':') {             // Label?
+    LVal->StrVal = StrSlice::create(TokStart, End-TokStart);
+    CurPtr = End+1;
+    return LABELSTR;
+  }
 
+  if (isClass(*TokStart, CC_Digit)) {                // PInteger?
+    CurPtr = SkipWhile(TokStart, CC_Digit);
+    LVal->UInt64Val = atoull(TokStart, CurPtr);
+    return EUINT64VAL;
+  }
 
-#ifndef YY_NO_POP_STATE
-static void yy_pop_state()
-	{
-	if ( --yy_start_stack_ptr < 0 )
-		YY_FATAL_ERROR( "start-condition stack underflow" );
+  if (const KeywordInfo *KI = LookupKeyword(TokStart, End-TokStart)) {
+    CurPtr = End;
+    return ReturnKeyword(KI, LVal);
+  }
 
-	BEGIN(yy_start_stack[yy_start_stack_ptr]);
-	}
-#endif
+  // Not a keyword.  Match the longest keyword that is a prefix of the run of
+  // characters (ie "intfoo" lexes as "int" "f" "o" "o"), or failing that,
+  // return the first character by itself.
+  //
+  for (unsigned Len = End-TokStart-1; Len > 0; --Len)
+    if (const KeywordInfo *KI = LookupKeyword(TokStart, Len)) {
+      CurPtr = TokStart+Len;
+      return ReturnKeyword(KI, LVal);
+    }
 
+  CurPtr = TokStart+1;
+  return *TokStart;
+}
 
-#ifndef YY_NO_TOP_STATE
-static int yy_top_state()
-	{
-	return yy_start_stack[yy_start_stack_ptr - 1];
-	}
-#endif
+// LexPercent - Lex a token starting with a '%': a named value (VarID) or a
+// numbered slot (EPInteger/ENInteger).
+//
+static int LexPercent(const char *TokStart, YYSTYPE *LVal) {
+  const char *Ptr = TokStart+1;
 
-#ifndef YY_EXIT_FAILURE
-#define YY_EXIT_FAILURE 2
-#endif
+  if (Ptr != BufferEnd && isClass(*Ptr, CC_IdStart)) {          // VarID
+    CurPtr = SkipWhile(Ptr, CC_IdChar);
+    LVal->StrVal = StrSlice::create(Ptr, CurPtr-Ptr);
+    return VAR_ID;
+  }
 
-#ifdef YY_USE_PROTOS
-static void yy_fatal_error( yyconst char msg[] )
-#else
-static void yy_fatal_error( msg )
-char msg[];
-#endif
-	{
-	(void) fprintf( stderr, "%s\n", msg );
-	exit( YY_EXIT_FAILURE );
-	}
+  if (Ptr != BufferEnd && isClass(*Ptr, CC_Digit)) {            // EPInteger
+    CurPtr = SkipWhile(Ptr, CC_Digit);
+    LVal->UIntVal = atoull(Ptr, CurPtr);
+    return UINTVAL;
+  }
 
+  if (Ptr != BufferEnd && *Ptr == '-' &&
+      Ptr+1 != BufferEnd && isClass(Ptr[1], CC_Digit)) {         // ENInteger
+    CurPtr = SkipWhile(Ptr+1, CC_Digit);
+    uint64_t Val = atoull(Ptr+1, CurPtr);
+    // +1:  we have bigger negative range
+    if (Val > (uint64_t)INT32_MAX+1)
+      ThrowException("Constant too large for signed 32 bits!");
+    LVal->SIntVal = -Val;
+    return SINTVAL;
+  }
 
+  CurPtr = Ptr;
+  return '%';
+}
 
-/* Redefine yyless() so it works in section 3 code. */
+//===----------------------------------------------------------------------===//
+//                           Lexer entry points
+//===----------------------------------------------------------------------===//
 
-#undef yyless
-#define yyless(n) \
-	do \
-		{ \
-		/* Undo effects of setting up yytext. */ \
-		yytext[yyleng] = yy_hold_char; \
-		yy_c_buf_p = yytext + n; \
-		yy_hold_char = *yy_c_buf_p; \
-		*yy_c_buf_p = '\0'; \
-		yyleng = n; \
-		} \
-	while ( 0 )
+// The tables are built before main() runs, so that threads never race to 
+// build them.
+//
+static struct LexerTableInit {
+  LexerTableInit() {
+    InitCharClass();
+    InitKeywordHash();
+  }
+} TheLexerTableInit;
 
+// llvmAsmSetInput - Point the lexer for this thread at a new input buffer, 
+// starting at the specified line number.  If FirstToken is nonzero, it is 
+// returned before any of the tokens in the buffer.  The buffer must outlive the
+// parse, because tokens refer into it.
+//
+void llvmAsmSetInput(const char *BufStart, const char *BufEnd, 
+                     int LineNo, int FirstToken) {
+  CurPtr = BufStart;
+  BufferEnd = BufEnd;
+  llvmAsmlineno = LineNo;
+  PendingToken = FirstToken;
+  NoWarnings = false;
+}
 
-/* Internal utility routines. */
+// llvmAsmlex - Return the next token from the input buffer, or 0 at the end of
+// the buffer.
+//
+int llvmAsmlex(YYSTYPE *LVal) {
+  if (PendingToken) {
+    int Tok = PendingToken;
+    PendingToken = 0;
+    return Tok;
+  }
 
-#ifndef yytext_ptr
-#ifdef YY_USE_PROTOS
-static void yy_flex_strncpy( char *s1, yyconst char *s2, int n )
-#else
-static void yy_flex_strncpy( s1, s2, n )
-char *s1;
-yyconst char *s2;
-int n;
-#endif
-	{
-	register int i;
-	for ( i = 0; i < n; ++i )
-		s1[i] = s2[i];
-	}
-#endif
+  while (1) {
+    // Skip whitespace, counting lines as we go...
+    while (CurPtr != BufferEnd && isClass(*CurPtr, CC_Space))
+      if (*CurPtr++ == '\n') ++llvmAsmlineno;
 
-#ifdef YY_NEED_STRLEN
-#ifdef YY_USE_PROTOS
-static int yy_flex_strlen( yyconst char *s )
-#else
-static int yy_flex_strlen( s )
-yyconst char *s;
-#endif
-	{
-	register int n;
-	for ( n = 0; s[n]; ++n )
-		;
+    if (CurPtr == BufferEnd) return 0;          // End of input
 
-	return n;
-	}
-#endif
+    const char *TokStart = CurPtr;
+    switch (*TokStart) {
+    case ';': {                   // Comments start with a ; and go till eol
+      const char *EOL = (const char*)memchr(TokStart, '\n', BufferEnd-TokStart);
+      CurPtr = EOL ? EOL : BufferEnd;
+      continue;
+    }
 
+    case '%':
+      return LexPercent(TokStart, LVal);
+
+    case '"': {                   // Quoted names can contain any char but "
+      const char *Ptr = TokStart+1;
+      const char *Quote =
+        (const char*)memchr(Ptr, '"', BufferEnd-Ptr);
+      if (Quote == 0 || Quote == Ptr) {   // Unterminated or empty string
+        CurPtr = Ptr;
+        return '"';
+      }
+      CountLines(Ptr, Quote);
+      LVal->StrVal = StrSlice::create(Ptr, Quote-Ptr);
+      CurPtr = Quote+1;
+      return STRINGCONSTANT;
+    }
 
-#ifdef YY_USE_PROTOS
-static void *yy_flex_alloc( yy_size_t size )
-#else
-static void *yy_flex_alloc( size )
-yy_size_t size;
-#endif
-	{
-	return (void *) malloc( size );
-	}
+    case '-': {
+      const char *Ptr = TokStart+1;
+      if (Ptr == BufferEnd || !isClass(*Ptr, CC_Digit)) {
+        if (!NoWarnings) cerr << "deprecated argument '-' used!\n";
+        CurPtr = Ptr;
+        return '-';
+      }
+
+      CurPtr = SkipWhile(Ptr, CC_Digit);             // NInteger
+      uint64_t Val = atoull(Ptr, CurPtr);
+      // +1:  we have bigger negative range
+      if (Val > (uint64_t)INT64_MAX+1)
+        ThrowException("Constant too large for signed 64 bits!");
+      LVal->SInt64Val = -Val;
+      return ESINT64VAL;
+    }
 
-#ifdef YY_USE_PROTOS
-static inline void *yy_flex_realloc( void *ptr, yy_size_t size )
-#else
-static inline void *yy_flex_realloc( ptr, size )
-void *ptr;
-yy_size_t size;
-#endif
-	{
-	/* The cast to (char *) in the following accommodates both
-	 * implementations that use char* generic pointers, and those
-	 * that use void* generic pointers.  It works with the latter
-	 * because both ANSI C and C++ allow castless assignment from
-	 * any pointer type to void*, and deal with argument conversions
-	 * as though doing an assignment.
-	 */
-	return (void *) realloc( (char *) ptr, size );
-	}
+    default:
+      if (isClass(*TokStart, CC_IdChar))
+        return LexIdentifier(TokStart, LVal);
 
-#ifdef YY_USE_PROTOS
-static void yy_flex_free( void *ptr )
-#else
-static void yy_flex_free( ptr )
-void *ptr;
-#endif
-	{
-	free( ptr );
-	}
+      CurPtr = TokStart+1;
+      return (unsigned char)*TokStart;
+    }
+  }
+}
 
-#if YY_MAIN
-int main()
-	{
-	yylex();
-	return 0;
-	}
-#endif
-#line 184 "Lexer.l"
+// llvmAsmFindMethods - Scan the input for the end of the module header and the
+// extent of each method, without parsing anything.  The header ends with the
+// 'implementation' keyword, and each method ends with an 'end' keyword.  
+// Anything after the last method is returned as a method of its own, so that 
+// parsing it reports the error.  Returns false if there is no implementation
+// section.  Warnings are not printed, because the input is lexed again when
+// it is parsed.
+//
+bool llvmAsmFindMethods(const char *BufStart, const char *BufEnd, 
+                        const char *&HeaderEnd, vector<MethodChunk> &Methods) {
+  YYSTYPE Dummy;
+  llvmAsmSetInput(BufStart, BufEnd);
+  NoWarnings = true;
+
+  int Tok;
+  while ((Tok = llvmAsmlex(&Dummy)) != IMPLEMENTATION)
+    if (Tok == 0) return false;
+  HeaderEnd = CurPtr;
+
+  MethodChunk M;
+  M.Start = CurPtr;
+  M.LineNo = llvmAsmlineno;
+  bool InMethod = false;
+  while ((Tok = llvmAsmlex(&Dummy))) {
+    InMethod = true;
+    if (Tok == END) {
+      M.End = CurPtr;
+      Methods.push_back(M);
+      M.Start = CurPtr;
+      M.LineNo = llvmAsmlineno;
+      InMethod = false;
+    }
+  }
 
+  if (InMethod) {           // Junk after the last method?
+    M.End = BufEnd;
+    Methods.push_back(M);
+  }
+  return true;
+}
@@ -8,26 +8,21 @@
 #include "llvm/Module.h"
 #include "ParserInternals.h"
 #include <stdio.h>  // for sprintf
-
-// The useful interface defined by this file... Parse an ascii file, and return
-// the internal representation in a nice slice'n'dice'able representation.
+#include <stdlib.h> // for realloc, free
+#include <string.h> // for memcpy
+#include <string>
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// ParseBuffer - Run the parser over the specified buffer, and verify the 
+// result.
 //
-Module *ParseAssemblyFile(const ToolCommandLine &Opts) throw (ParseException) {
-  FILE *F = stdin;
-
-  if (Opts.getInputFilename() != "-") 
-    F = fopen(Opts.getInputFilename().c_str(), "r");
-
-  if (F == 0) {
-    throw ParseException(Opts, string("Could not open file '") + 
-			 Opts.getInputFilename() + "'");
-  }
-
-  // TODO: If this throws an exception, F is not closed.
-  Module *Result = RunVMAsmParser(Opts, F);
-
-  if (F != stdin)
-    fclose(F);
+static Module *ParseBuffer(const ToolCommandLine &Opts, 
+                           const char *Buf, const char *BufEnd) {
+  Module *Result = RunVMAsmParser(Opts, Buf, BufEnd);
 
   if (Result) {  // Check to see that it is valid...
     vector<string> Errors;
@@ -44,6 +39,70 @@ Module *ParseAssemblyFile(const ToolCommandLine &Opts) throw (ParseException) {
   return Result;
 }
 
+// The useful interface defined by this file... Parse an ascii file, and return
+// the internal representation in a nice slice'n'dice'able representation.
+//
+// The file is mmap'd and the lexer works directly on the mapped pages.  Input
+// from stdin is read into a memory buffer first.
+//
+Module *ParseAssemblyFile(const ToolCommandLine &Opts) throw (ParseException) {
+  Module *Result = 0;
+
+  if (Opts.getInputFilename() != "-") {      // Read from a file...
+    int FD = open(Opts.getInputFilename().c_str(), O_RDONLY);
+    struct stat StatBuf;
+    if (FD == -1 || fstat(FD, &StatBuf) == -1) {
+      if (FD != -1) close(FD);
+      throw ParseException(Opts, string("Could not open file '") + 
+                           Opts.getInputFilename() + "'");
+    }
+
+    size_t Length = StatBuf.st_size;
+    if (Length == 0) {                       // Can't mmap an empty file
+      close(FD);
+      return ParseBuffer(Opts, "", "");
+    }
+
+    char *Buffer = (char*)mmap(0, Length, PROT_READ, MAP_PRIVATE, FD, 0);
+    close(FD);
+    if (Buffer == (char*)-1)
+      throw ParseException(Opts, string("Could not map file '") + 
+                           Opts.getInputFilename() + "'");
+
+    try {
+      Result = ParseBuffer(Opts, Buffer, Buffer+Length);
+    } catch (...) {
+      munmap(Buffer, Length);
+      throw;
+    }
+    munmap(Buffer, Length);
+  } else {                                   // Read from stdin
+    size_t FileSize = 0;
+    int BlockSize;
+    char Block[4096], *FileData = 0;
+    while ((BlockSize = read(0, Block, sizeof(Block)))) {
+      if (BlockSize == -1) {
+        free(FileData);
+        throw ParseException(Opts, "Could not read from stdin");
+      }
+
+      FileData = (char*)realloc(FileData, FileSize+BlockSize);
+      memcpy(FileData+FileSize, Block, BlockSize);
+      FileSize += BlockSize;
+    }
+
+    try {
+      Result = ParseBuffer(Opts, FileData, FileData+FileSize);
+    } catch (...) {
+      free(FileData);
+      throw;
+    }
+    free(FileData);
+  }
+
+  return Result;
+}
+
 
 //===------------------------------------------------------------------------===
 //                              ParseException Class
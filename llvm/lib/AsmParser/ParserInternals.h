@@ -23,13 +23,30 @@
 
 class Module;
 
-// Global variables exported from the lexer...
-extern FILE *llvmAsmin;
-extern int llvmAsmlineno;
+// Global variables exported from the lexer.  The lexer and parser may run in
+// several threads at once, so each thread has its own copy of these...
+extern __thread int llvmAsmlineno;
+void llvmAsmSetInput(const char *BufStart, const char *BufEnd, 
+                     int LineNo = 1, int FirstToken = 0);
+
+// MethodChunk - The range of the input buffer holding one method, along with 
+// the line number it starts on.
+//
+struct MethodChunk {
+  const char *Start, *End;
+  int LineNo;
+};
+
+// llvmAsmFindMethods - Scan the input for the end of the module header and the
+// extent of each method, without parsing anything.
+//
+bool llvmAsmFindMethods(const char *BufStart, const char *BufEnd, 
+                        const char *&HeaderEnd, vector<MethodChunk> &Methods);
 
 // Globals exported by the parser...
-extern const ToolCommandLine *CurOptions;
-Module *RunVMAsmParser(const ToolCommandLine &Opts, FILE *F);
+extern __thread const ToolCommandLine *CurOptions;
+Module *RunVMAsmParser(const ToolCommandLine &Opts, 
+                       const char *BufStart, const char *BufEnd);
 
 
 // ThrowException - Wrapper around the ParseException class that automatically
@@ -43,6 +60,23 @@ static inline void ThrowException(const string &message) {
   throw ParseException(*CurOptions, message, llvmAsmlineno);
 }
 
+// StrSlice - A run of characters in the input buffer.  The lexer hands these
+// out instead of strdup'ing its tokens, so they are only valid while the input
+// buffer is alive (which is for the whole of RunVMAsmParser).  This is a plain
+// struct for the same reason as ValID below: it lives in the parser's union.
+//
+struct StrSlice {
+  const char *Ptr;
+  unsigned    Len;
+
+  static StrSlice create(const char *Ptr, unsigned Len) {
+    StrSlice S; S.Ptr = Ptr; S.Len = Len; return S;
+  }
+
+  inline bool empty() const { return Len == 0; }
+  inline string str() const { return string(Ptr, Len); }
+};
+
 // ValID - Represents a reference of a definition of some sort.  This may either
 // be a numeric reference or a symbolic (%var) reference.  This is just a 
 // discriminated union.
@@ -56,7 +90,7 @@ struct ValID {
                           // 3 = unsigned const pool, 4 = const string
   union {
     int      Num;         // If it's a numeric reference
-    char    *Name;        // If it's a named reference.  Memory must be free'd.
+    StrSlice Name;        // If it's a named reference.  Points into the input.
     int64_t  ConstPool64; // Constant pool reference.  This is the value
     uint64_t UConstPool64;// Unsigned constant pool reference.
   };
@@ -65,7 +99,7 @@ struct ValID {
     ValID D; D.Type = 0; D.Num = Num; return D;
   }
 
-  static ValID create(char *Name) {
+  static ValID create(StrSlice Name) {
     ValID D; D.Type = 1; D.Name = Name; return D;
   }
 
@@ -77,26 +111,19 @@ struct ValID {
     ValID D; D.Type = 3; D.UConstPool64 = Val; return D;
   }
 
-  static ValID create_conststr(char *Name) {
+  static ValID create_conststr(StrSlice Name) {
     ValID D; D.Type = 4; D.Name = Name; return D;
   }
 
-  inline void destroy() {
-    if (Type == 1 || Type == 4) free(Name);  // Free this strdup'd memory...
-  }
-
-  inline ValID copy() const {
-    if (Type != 1 && Type != 4) return *this;
-    ValID Result = *this;
-    Result.Name = strdup(Name);
-    return Result;
-  }
+  // Names refer to the input buffer, so there is nothing to free or duplicate.
+  inline void destroy() {}
+  inline ValID copy() const { return *this; }
 
   inline string getName() const {
     switch (Type) {
     case 0:  return string("#") + itostr(Num);
-    case 1:  return Name;
-    case 4:  return string("\"") + Name + string("\"");
+    case 1:  return Name.str();
+    case 4:  return string("\"") + Name.str() + string("\"");
     default: return string("%") + itostr(ConstPool64);
     }
   }
@@ -120,13 +147,6 @@ struct InstPlaceHolderHelper : public Instruction {
   virtual Instruction *clone() const { abort(); }
 
   inline virtual void dropAllReferences() {}
-  virtual string getOpcode() const { return "placeholder"; }
-
-  // No "operands"...
-  virtual Value *getOperand(unsigned i) { return 0; }
-  virtual const Value *getOperand(unsigned i) const { return 0; }
-  virtual bool setOperand(unsigned i, Value *Val) { return false; }
-  virtual unsigned getNumOperands() const { return 0; }
 };
 
 struct BBPlaceHolderHelper : public BasicBlock {
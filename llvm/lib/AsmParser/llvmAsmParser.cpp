@@ -1,73 +1,78 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/*  A Bison parser, made from llvmAsmParser.y
-    by GNU Bison version 1.28  */
-
-#define YYBISON 1  /* Identify Bison output.  */
-
-#define yyparse llvmAsmparse
-#define yylex llvmAsmlex
-#define yyerror llvmAsmerror
-#define yylval llvmAsmlval
-#define yychar llvmAsmchar
-#define yydebug llvmAsmdebug
-#define yynerrs llvmAsmnerrs
-#define	ESINT64VAL	257
-#define	EUINT64VAL	258
-#define	SINTVAL	259
-#define	UINTVAL	260
-#define	VOID	261
-#define	BOOL	262
-#define	SBYTE	263
-#define	UBYTE	264
-#define	SHORT	265
-#define	USHORT	266
-#define	INT	267
-#define	UINT	268
-#define	LONG	269
-#define	ULONG	270
-#define	FLOAT	271
-#define	DOUBLE	272
-#define	STRING	273
-#define	TYPE	274
-#define	LABEL	275
-#define	VAR_ID	276
-#define	LABELSTR	277
-#define	STRINGCONSTANT	278
-#define	IMPLEMENTATION	279
-#define	TRUE	280
-#define	FALSE	281
-#define	BEGINTOK	282
-#define	END	283
-#define	DECLARE	284
-#define	PHI	285
-#define	CALL	286
-#define	RET	287
-#define	BR	288
-#define	SWITCH	289
-#define	NEG	290
-#define	NOT	291
-#define	TOINT	292
-#define	TOUINT	293
-#define	ADD	294
-#define	SUB	295
-#define	MUL	296
-#define	DIV	297
-#define	REM	298
-#define	SETLE	299
-#define	SETGE	300
-#define	SETLT	301
-#define	SETGT	302
-#define	SETEQ	303
-#define	SETNE	304
-#define	MALLOC	305
-#define	ALLOCA	306
-#define	FREE	307
-#define	LOAD	308
-#define	STORE	309
-#define	GETFIELD	310
-#define	PUTFIELD	311
-
-#line 13 "llvmAsmParser.y"
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 1
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+/* Substitute the variable and function names.  */
+#define yyparse         llvmAsmparse
+#define yylex           llvmAsmlex
+#define yyerror         llvmAsmerror
+#define yydebug         llvmAsmdebug
+#define yynerrs         llvmAsmnerrs
+
+/* First part of user prologue.  */
+#line 15 "llvmAsmParser.y"
 
 #include "ParserInternals.h"
 #include "llvm/BasicBlock.h"
@@ -76,48 +81,170 @@
 #include "llvm/Module.h"
 #include "llvm/Type.h"
 #include "llvm/DerivedTypes.h"
+#include "llvm/TypeContext.h"
 #include "llvm/Assembly/Parser.h"
 #include "llvm/ConstantPool.h"
 #include "llvm/iTerminators.h"
 #include "llvm/iMemory.h"
 #include <list>
 #include <utility>            // Get definition of pair class
-#include <stdio.h>            // This embarasment is due to our flex lexer...
+#include <hash_map>
+#include <pthread.h>
+#include <unistd.h>           // for sysconf
+#include <stdlib.h>           // for getenv
+#include "llvm/Tools/Mutex.h"
 
 int yyerror(char *ErrorMsg);  // Forward declarations to prevent "implicit 
-int yylex();                  // declaration" of xxx warnings.
-int yyparse();
+int yyparse();                // declaration" of xxx warnings.
 
-static Module *ParserResult;
-const ToolCommandLine *CurOptions = 0;
+// Each thread running the parser has its own copy of these...
+static __thread Module *ParserResult;
+__thread const ToolCommandLine *CurOptions = 0;
 
-// This contains info used when building the body of a method.  It is destroyed
-// when the method is completed.
+// ValueKey - Identifies a value in one of the parser's tables by its type and
+// its ValID, which must be either a number (Type 0) or a name (Type 1).  Names
+// are slices of the input buffer, so building a key never allocates.
 //
+typedef pair<const Type*, ValID> ValueKey;
+
+struct ValueKeyHash {
+  size_t operator()(const ValueKey &K) const {
+    size_t H = (size_t)K.first;
+    if (K.second.Type == 0)
+      return H ^ (K.second.Num * 2654435761U);
+
+    const char *P = K.second.Name.Ptr, *E = P+K.second.Name.Len;
+    for (; P != E; ++P)
+      H = 5*H + *P;
+    return H;
+  }
+};
+
+struct ValueKeyEq {
+  bool operator()(const ValueKey &A, const ValueKey &B) const {
+    if (A.first != B.first || A.second.Type != B.second.Type) return false;
+    if (A.second.Type == 0) return A.second.Num == B.second.Num;
+    return A.second.Name.Len == B.second.Name.Len &&
+           !memcmp(A.second.Name.Ptr, B.second.Name.Ptr, A.second.Name.Len);
+  }
+};
+
+struct ValuePtrHash {
+  size_t operator()(const Value *V) const { return (size_t)V >> 3; }
+};
+
 typedef vector<Value *> ValueList;           // Numbered defs
-static void ResolveDefinitions(vector<ValueList> &LateResolvers);
+typedef hash_map<ValueKey, Value*, ValueKeyHash, ValueKeyEq> NameTable;
+
+// ForwardRefTable - When a value is referenced before it is defined (a forward
+// branch, or the PHI node for a loop body), getVal hands out a placeholder for
+// it.  All references to the same value share one placeholder, and every
+// operand slot that refers to a placeholder is recorded (RecordForwardRefs) so
+// that it can be patched in place as soon as the real definition is parsed.
+//
+struct ForwardRefTable {
+  typedef vector<pair<User*, unsigned> > FixupList;
+
+  hash_map<ValueKey, Value*, ValueKeyHash, ValueKeyEq> Placeholders;
+  hash_map<Value*, FixupList, ValuePtrHash> Fixups;
+
+  inline bool empty() const { return Placeholders.empty(); }
+
+  Value *lookup(const Type *Ty, const ValID &D) const {
+    hash_map<ValueKey, Value*, ValueKeyHash, ValueKeyEq>::const_iterator I =
+      Placeholders.find(make_pair(Ty, D));
+    return I != Placeholders.end() ? I->second : 0;
+  }
+
+  void add(const Type *Ty, const ValID &D, Value *PlaceHolder) {
+    Placeholders[make_pair(Ty, D)] = PlaceHolder;
+    Fixups[PlaceHolder];
+  }
+
+  // recordUse - If operand #i of U is one of our placeholders, remember the 
+  // slot so that it can be patched when the placeholder is resolved.
+  //
+  bool recordUse(User *U, unsigned i) {
+    hash_map<Value*, FixupList, ValuePtrHash>::iterator I = 
+      Fixups.find(U->getOperand(i));
+    if (I == Fixups.end()) return false;
+    I->second.push_back(make_pair(U, i));
+    return true;
+  }
+
+  // resolve - The value identified by Ty/D has been defined to be V.  If there
+  // is a placeholder for it, patch all of the recorded operand slots to refer
+  // to V, and delete the placeholder.
+  //
+  void resolve(const Type *Ty, const ValID &D, Value *V) {
+    hash_map<ValueKey, Value*, ValueKeyHash, ValueKeyEq>::iterator I =
+      Placeholders.find(make_pair(Ty, D));
+    if (I == Placeholders.end()) return;
+    Value *PlaceHolder = I->second;
+    Placeholders.erase(I);
+
+    hash_map<Value*, FixupList, ValuePtrHash>::iterator FI = 
+      Fixups.find(PlaceHolder);
+    FixupList &FL = FI->second;
+    for (unsigned i = 0; i < FL.size(); ++i)
+      FL[i].first->setOperand(FL[i].second, V);
+    Fixups.erase(FI);
+
+    // Catch any uses that were not recorded as fixups...
+    if (!PlaceHolder->use_empty())
+      PlaceHolder->replaceAllUsesWith(V);
+    assert(PlaceHolder->use_empty());
+    delete PlaceHolder;
+  }
+};
+
+// ValueTables - The per scope (module or method) tables used to find values by
+// number or by name while parsing.
+//
+struct ValueTables {
+  vector<ValueList> Values;      // Numbered definitions
+  NameTable         Names;       // Named definitions
+  ForwardRefTable   ForwardRefs; // Values referenced before being defined
+};
 
-static struct PerModuleInfo {
+static void ResolveDefinitions(ValueTables &Tab);
+
+struct PerModuleInfo : public ValueTables {
   Module *CurrentModule;
-  vector<ValueList> Values;     // Module level numbered definitions
-  vector<ValueList> LateResolveValues;
+
+  // When methods are parsed in parallel (see RunVMAsmParser), each method body
+  // is parsed into a module scope of its own, and Header points to the tables
+  // of the module header.  Partial is set for all of these parses, because 
+  // the module is not complete when they are done.
+  //
+  const ValueTables *Header;
+  bool Partial;
+
+  PerModuleInfo() : CurrentModule(0), Header(0), Partial(false) {}
+
+  // getModuleTables - Return the tables that hold the module level values.
+  inline const ValueTables &getModuleTables() const {
+    return Header ? *Header : *this;
+  }
 
   void ModuleDone() {
-    // If we could not resolve some blocks at parsing time (forward branches)
-    // resolve the branches now...
-    ResolveDefinitions(LateResolveValues);
+    if (Partial) return;    // The module is finished off by RunVMAsmParser
 
-    Values.clear();         // Clear out method local definitions
+    // Any forward references that have not been defined by now are errors...
+    ResolveDefinitions(*this);
+
+    Values.clear();         // Clear out module level definitions
+    Names.clear();
     CurrentModule = 0;
   }
-} CurModule;
+};
 
-static struct PerMethodInfo {
+// This contains info used when building the body of a method.  It is destroyed
+// when the method is completed.
+//
+struct PerMethodInfo : public ValueTables {
   Method *CurrentMethod;         // Pointer to current method being created
 
-  vector<ValueList> Values;          // Keep track of numbered definitions
-  vector<ValueList> LateResolveValues;
-
   inline PerMethodInfo() {
     CurrentMethod = 0;
   }
@@ -129,28 +256,88 @@ static struct PerMethodInfo {
   }
 
   void MethodDone() {
-    // If we could not resolve some blocks at parsing time (forward branches)
-    // resolve the branches now...
-    ResolveDefinitions(LateResolveValues);
+    // Any forward references that have not been defined by now are errors...
+    ResolveDefinitions(*this);
 
     Values.clear();         // Clear out method local definitions
+    Names.clear();
     CurrentMethod = 0;
   }
-} CurMeth;  // Info for the current method...
+};
+
+// The parser always works on the state of the current thread...
+static __thread PerModuleInfo *CurModule;   // Info for the current module...
+static __thread PerMethodInfo *CurMeth;     // Info for the current method...
 
 
 //===----------------------------------------------------------------------===//
 //               Code to handle definitions of all the types
 //===----------------------------------------------------------------------===//
 
-static void InsertValue(Value *D, vector<ValueList> &ValueTab = CurMeth.Values) {
+// InsertValue - Add an unnamed definition to the numbered value table of the
+// specified scope, and patch any forward references to its slot number.
+//
+static void InsertValue(Value *D, ValueTables &Tab = *CurMeth) {
   if (!D->hasName()) {             // Is this a numbered definition?
     unsigned type = D->getType()->getUniqueID();
-    if (ValueTab.size() <= type)
-      ValueTab.resize(type+1, ValueList());
-    //printf("Values[%d][%d] = %d\n", type, ValueTab[type].size(), D);
-    ValueTab[type].push_back(D);
+    if (Tab.Values.size() <= type)
+      Tab.Values.resize(type+1, ValueList());
+    //printf("Values[%d][%d] = %d\n", type, Tab.Values[type].size(), D);
+
+    // Module constants occupy the lowest numbered slots of a method...
+    unsigned Num = Tab.Values[type].size();
+    const ValueTables &ModTab = CurModule->getModuleTables();
+    if (&Tab == CurMeth && type < ModTab.Values.size())
+      Num += ModTab.Values[type].size();
+
+    Tab.Values[type].push_back(D);
+    if (!Tab.ForwardRefs.empty())
+      Tab.ForwardRefs.resolve(D->getType(), ValID::create((int)Num), D);
+  }
+}
+
+// InsertName - Add a definition named Name to the name table of the specified
+// scope, and patch any forward references to that name.
+//
+static void InsertName(Value *D, StrSlice Name, ValueTables &Tab = *CurMeth) {
+  ValID ID = ValID::create(Name);
+  Tab.Names[make_pair(D->getType(), ID)] = D;
+  if (!Tab.ForwardRefs.empty())
+    Tab.ForwardRefs.resolve(D->getType(), ID, D);
+}
+
+// getPlaceHolder - Return the placeholder for the value identified by Type/D in
+// the specified scope, making one if this is the first reference to it.
+//
+static Value *getPlaceHolder(const Type *Type, const ValID &D, 
+                             ValueTables &Tab) {
+  // If this value has already been forward referenced, share the placeholder.
+  if (Value *PH = Tab.ForwardRefs.lookup(Type, D))
+    return PH;
+
+  Value *d = 0;
+  switch (Type->getPrimitiveID()) {
+  case Type::LabelTyID:  d = new    BBPlaceHolder(Type, D); break;
+  case Type::MethodTyID: d = new  MethPlaceHolder(Type, D); break;
+//case Type::ClassTyID:  d = new ClassPlaceHolder(Type, D); break;
+  default:               d = new   DefPlaceHolder(Type, D); break;
   }
+
+  assert(d != 0 && "How did we not make something?");
+  Tab.ForwardRefs.add(Type, D, d);
+  return d;
+}
+
+// getModuleVal - V is the module level value that D refers to.  When methods
+// are being parsed in parallel, module level values may not be used directly, 
+// because that would update their use lists from several threads at once.  
+// Instead they are referred to through placeholders that are resolved when 
+// the method is linked into the module.
+//
+static Value *getModuleVal(Value *V, const Type *Type, const ValID &D,
+                           bool DoNotImprovise) {
+  if (CurModule->Header == 0 || DoNotImprovise) return V;
+  return getPlaceHolder(Type, D, *CurModule);
 }
 
 static Value *getVal(const Type *Type, ValID &D, 
@@ -159,41 +346,40 @@ static Value *getVal(const Type *Type, ValID &D,
   case 0: {                 // Is it a numbered definition?
     unsigned type = Type->getUniqueID();
     unsigned Num = (unsigned)D.Num;
+    const ValueTables &ModTab = CurModule->getModuleTables();
 
     // Module constants occupy the lowest numbered slots...
-    if (type < CurModule.Values.size()) {
-      if (Num < CurModule.Values[type].size()) 
-        return CurModule.Values[type][Num];
+    if (type < ModTab.Values.size()) {
+      if (Num < ModTab.Values[type].size()) 
+        return getModuleVal(ModTab.Values[type][Num], Type, D, DoNotImprovise);
 
-      Num -= CurModule.Values[type].size();
+      Num -= ModTab.Values[type].size();
     }
 
     // Make sure that our type is within bounds
-    if (CurMeth.Values.size() <= type)
+    if (CurMeth->Values.size() <= type)
       break;
 
     // Check that the number is within bounds...
-    if (CurMeth.Values[type].size() <= Num)
+    if (CurMeth->Values[type].size() <= Num)
       break;
   
-    return CurMeth.Values[type][Num];
+    return CurMeth->Values[type][Num];
   }
   case 1: {                // Is it a named definition?
-    string Name(D.Name);
-    SymbolTable *SymTab = 0;
-    if (CurMeth.CurrentMethod) 
-      SymTab = CurMeth.CurrentMethod->getSymbolTable();
-    Value *N = SymTab ? SymTab->lookup(Type, Name) : 0;
-
-    if (N == 0) {
-      SymTab = CurModule.CurrentModule->getSymbolTable();
-      if (SymTab)
-        N = SymTab->lookup(Type, Name);
-      if (N == 0) break;
-    }
+    ValueKey Key(Type, D);
+    NameTable::const_iterator I = CurMeth->Names.find(Key);
+    if (I != CurMeth->Names.end()) return I->second;
+
+    I = CurModule->Names.find(Key);
+    if (I != CurModule->Names.end()) return I->second;
 
-    D.destroy();  // Free old strdup'd memory...
-    return N;
+    if (const ValueTables *Header = CurModule->Header) {
+      I = Header->Names.find(Key);
+      if (I != Header->Names.end())
+        return getModuleVal(I->second, Type, D, DoNotImprovise);
+    }
+    break;
   }
 
   case 2:                 // Is it a constant pool reference??
@@ -227,8 +413,7 @@ static Value *getVal(const Type *Type, ValID &D,
     case 4:
       cerr << "FIXME: TODO: String constants [sbyte] not implemented yet!\n";
       abort();
-      //CPV = new ConstPoolString(D.Name);
-      D.destroy();   // Free the string memory
+      //CPV = new ConstPoolString(D.Name.str());
       break;
     }
     assert(CPV && "How did we escape creating a constant??");
@@ -236,9 +421,9 @@ static Value *getVal(const Type *Type, ValID &D,
     // Scan through the constant table and see if we already have loaded this
     // constant.
     //
-    ConstantPool &CP = CurMeth.CurrentMethod ? 
-                         CurMeth.CurrentMethod->getConstantPool() :
-                           CurModule.CurrentModule->getConstantPool();
+    ConstantPool &CP = CurMeth->CurrentMethod ? 
+                         CurMeth->CurrentMethod->getConstantPool() :
+                           CurModule->CurrentModule->getConstantPool();
     ConstPoolVal *C = CP.find(CPV);      // Already have this constant?
     if (C) {
       delete CPV;  // Didn't need this after all, oh well.
@@ -258,21 +443,11 @@ static Value *getVal(const Type *Type, ValID &D,
   //
   if (DoNotImprovise) return 0;  // Do we just want a null to be returned?
 
-  // TODO: Attempt to coallecse nodes that are the same with previous ones.
-  Value *d = 0;
-  switch (Type->getPrimitiveID()) {
-  case Type::LabelTyID: d = new    BBPlaceHolder(Type, D); break;
-  case Type::MethodTyID:
-    d = new MethPlaceHolder(Type, D); 
-    InsertValue(d, CurModule.LateResolveValues);
-    return d;
-//case Type::ClassTyID:      d = new ClassPlaceHolder(Type, D); break;
-  default:                   d = new   DefPlaceHolder(Type, D); break;
-  }
-
-  assert(d != 0 && "How did we not make something?");
-  InsertValue(d, CurMeth.LateResolveValues);
-  return d;
+  // Method references are resolved at the module level, everything else is
+  // local to the current method.
+  if (Type->isMethodType())
+    return getPlaceHolder(Type, D, *CurModule);
+  return getPlaceHolder(Type, D, *CurMeth);
 }
 
 
@@ -284,38 +459,38 @@ static Value *getVal(const Type *Type, ValID &D,
 // values not defined yet... for example, a forward branch, or the PHI node for
 // a loop body.
 //
-// This keeps a table (CurMeth.LateResolveValues) of all such forward references
-// and back patchs after we are done.
+// Each scope keeps a table (ForwardRefs) of all such forward references, along
+// with the operand slots that use them.  The slots are back patched as soon as
+// the definition is seen (by InsertValue and InsertName).
 //
 
-// ResolveDefinitions - If we could not resolve some defs at parsing 
-// time (forward branches, phi functions for loops, etc...) resolve the 
-// defs now...
+// RecordForwardRefs - Called for each instruction once it is completely built.
+// Record which of its operands refer to placeholders.
 //
-static void ResolveDefinitions(vector<ValueList> &LateResolvers) {
-  // Loop over LateResolveDefs fixing up stuff that couldn't be resolved
-  for (unsigned ty = 0; ty < LateResolvers.size(); ty++) {
-    while (!LateResolvers[ty].empty()) {
-      Value *V = LateResolvers[ty].back();
-      LateResolvers[ty].pop_back();
-      ValID &DID = getValIDFromPlaceHolder(V);
-
-      Value *TheRealValue = getVal(Type::getUniqueIDType(ty), DID, true);
-
-      if (TheRealValue == 0 && DID.Type == 1)
-        ThrowException("Reference to an invalid definition: '" +DID.getName() +
-                       "' of type '" + V->getType()->getName() + "'");
-      else if (TheRealValue == 0)
-        ThrowException("Reference to an invalid definition: #" +itostr(DID.Num)+
-                       " of type '" + V->getType()->getName() + "'");
-
-      V->replaceAllUsesWith(TheRealValue);
-      assert(V->use_empty());
-      delete V;
-    }
-  }
+static void RecordForwardRefs(Instruction *I) {
+  if (CurMeth->ForwardRefs.empty() && CurModule->ForwardRefs.empty())
+    return;
+
+  for (unsigned i = 0, e = I->getNumOperands(); i != e; ++i)
+    if (!CurMeth->ForwardRefs.recordUse(I, i))
+      CurModule->ForwardRefs.recordUse(I, i);
+}
 
-  LateResolvers.clear();
+// ResolveDefinitions - Called at the end of a scope.  Any forward references 
+// that are still outstanding refer to values that were never defined, so 
+// report them.
+//
+static void ResolveDefinitions(ValueTables &Tab) {
+  if (Tab.ForwardRefs.empty()) return;
+
+  const ValueKey &Key = Tab.ForwardRefs.Placeholders.begin()->first;
+  const ValID &DID = Key.second;
+  if (DID.Type == 1)
+    ThrowException("Reference to an invalid definition: '" +DID.getName() +
+                   "' of type '" + Key.first->getName() + "'");
+  else
+    ThrowException("Reference to an invalid definition: #" +itostr(DID.Num)+
+                   " of type '" + Key.first->getName() + "'");
 }
 
 // addConstValToConstantPool - This code is used to insert a constant into the
@@ -324,11 +499,11 @@ static void ResolveDefinitions(vector<ValueList> &LateResolvers) {
 // multiple references to %4, for example will all get merged.
 //
 static ConstPoolVal *addConstValToConstantPool(ConstPoolVal *C) {
-  vector<ValueList> &ValTab = CurMeth.CurrentMethod ? 
-                                  CurMeth.Values : CurModule.Values;
-  ConstantPool &CP = CurMeth.CurrentMethod ? 
-                          CurMeth.CurrentMethod->getConstantPool() : 
-                          CurModule.CurrentModule->getConstantPool();
+  ValueTables &ValTab = CurMeth->CurrentMethod ? 
+                            (ValueTables&)*CurMeth : *CurModule;
+  ConstantPool &CP = CurMeth->CurrentMethod ? 
+                          CurMeth->CurrentMethod->getConstantPool() : 
+                          CurModule->CurrentModule->getConstantPool();
 
   if (ConstPoolVal *CPV = CP.find(C)) {
     // Constant already in constant pool. Try to merge the two constants
@@ -375,1527 +550,2252 @@ static ConstPoolVal *addConstValToConstantPool(ConstPoolVal *C) {
 //            RunVMAsmParser - Define an interface to this parser
 //===----------------------------------------------------------------------===//
 //
-Module *RunVMAsmParser(const ToolCommandLine &Opts, FILE *F) {
-  llvmAsmin = F;
-  CurOptions = &Opts;
-  llvmAsmlineno = 1;      // Reset the current line number...
-
-  CurModule.CurrentModule = new Module();  // Allocate a new module to read
-  yyparse();       // Parse the file.
-  Module *Result = ParserResult;
-  CurOptions = 0;
-  llvmAsmin = stdin;    // F is about to go away, don't use it anymore...
-  ParserResult = 0;
+// A file with more than one method in it is parsed in several steps.  First 
+// the input is scanned for the end of the module header and of each method 
+// (llvmAsmFindMethods).  Then the header is parsed, and the method bodies are 
+// parsed by a number of threads, each one into its own scratch module with its
+// own ParserState.  Finally the methods are moved into the real module in 
+// source order, and the references between them are resolved.
+//
 
-  return Result;
-}
+// ParserState - All of the state used by one run of the parser.
+//
+struct ParserState {
+  PerModuleInfo ModInfo;
+  PerMethodInfo MethInfo;
+  Module       *Result;
 
+  ParserState() : Result(0) {}
+};
 
-#line 337 "llvmAsmParser.y"
-typedef union {
-  Module                  *ModuleVal;
-  Method                  *MethodVal;
-  MethodArgument          *MethArgVal;
-  BasicBlock              *BasicBlockVal;
-  TerminatorInst          *TermInstVal;
-  Instruction             *InstVal;
-  ConstPoolVal            *ConstVal;
-  const Type              *TypeVal;
-
-  list<MethodArgument*>   *MethodArgList;
-  list<Value*>            *ValueList;
-  list<const Type*>       *TypeList;
-  list<pair<ConstPoolVal*, BasicBlock*> > *JumpTable;
-  vector<ConstPoolVal*>   *ConstVector;
-
-  int64_t                  SInt64Val;
-  uint64_t                 UInt64Val;
-  int                      SIntVal;
-  unsigned                 UIntVal;
-
-  char                    *StrVal;   // This memory is allocated by strdup!
-  ValID                    ValIDVal; // May contain memory allocated by strdup
-
-  Instruction::UnaryOps    UnaryOpVal;
-  Instruction::BinaryOps   BinaryOpVal;
-  Instruction::TermOps     TermOpVal;
-  Instruction::MemoryOps   MemOpVal;
-} YYSTYPE;
-#include <stdio.h>
-
-#ifndef __cplusplus
-#ifndef __STDC__
-#define const
-#endif
-#endif
+// RunParser - Parse the specified range of the input buffer into PS.  If 
+// FirstToken is nonzero, the lexer returns it before the first real token.
+//
+static void RunParser(ParserState &PS, const char *Start, const char *End,
+                      int LineNo = 1, int FirstToken = 0) {
+  CurModule = &PS.ModInfo;
+  CurMeth   = &PS.MethInfo;
+  llvmAsmSetInput(Start, End, LineNo, FirstToken);
 
+  yyparse();       // Parse the input.
+  PS.Result = ParserResult;
 
+  llvmAsmSetInput(0, 0);  // The buffer is about to go away, don't use it...
+  ParserResult = 0;
+}
 
-#define	YYFINAL		220
-#define	YYFLAG		-32768
-#define	YYNTBASE	68
-
-#define YYTRANSLATE(x) ((unsigned)(x) <= 311 ? yytranslate[x] : 103)
-
-static const char yytranslate[] = {     0,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,    65,
-    66,    67,     2,    64,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-    58,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-    59,     2,    60,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,    61,
-     2,     2,    62,     2,    63,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-     2,     2,     2,     2,     2,     1,     3,     4,     5,     6,
-     7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
-    17,    18,    19,    20,    21,    22,    23,    24,    25,    26,
-    27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-    37,    38,    39,    40,    41,    42,    43,    44,    45,    46,
-    47,    48,    49,    50,    51,    52,    53,    54,    55,    56,
-    57
+// ParallelParseInfo - Shared by all of the threads parsing method bodies.
+// Threads grab methods to parse in order, until there are none left.
+//
+struct ParallelParseInfo {
+  const vector<MethodChunk> &Methods;
+  const PerModuleInfo       &Header;
+  const ToolCommandLine     &Options;
+  TypeContext              *Context;  // The caller's type context
+
+  vector<ParserState*>    States;   // Indexed by method number
+  vector<ParseException*> Errors;   // Indexed by method number
+
+  Mutex    Lock;                    // Protects NextMethod
+  unsigned NextMethod;
+
+  ParallelParseInfo(const vector<MethodChunk> &M, const PerModuleInfo &H,
+                    const ToolCommandLine &O)
+    : Methods(M), Header(H), Options(O), Context(TypeContext::getCurrent()),
+      States(M.size()), Errors(M.size()), NextMethod(0) {}
 };
 
-#if YYDEBUG != 0
-static const short yyprhs[] = {     0,
-     0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
-    20,    22,    24,    26,    28,    30,    32,    34,    36,    38,
-    40,    42,    44,    46,    48,    50,    52,    54,    56,    58,
-    60,    62,    64,    66,    68,    70,    72,    74,    76,    78,
-    80,    82,    84,    86,    88,    90,    93,    94,    97,   100,
-   103,   106,   109,   112,   119,   125,   134,   142,   149,   154,
-   158,   160,   164,   165,   167,   170,   173,   175,   176,   179,
-   183,   185,   187,   188,   194,   198,   201,   203,   205,   207,
-   209,   211,   213,   215,   217,   219,   224,   228,   232,   238,
-   242,   245,   248,   250,   254,   257,   260,   263,   267,   270,
-   271,   275,   278,   282,   292,   302,   309,   315,   318,   321,
-   325,   327,   328,   334,   338,   341,   348,   350,   353,   359,
-   362,   368
-};
+static void *MethodParserThread(void *Arg) {
+  ParallelParseInfo &PI = *(ParallelParseInfo*)Arg;
+  TypeContext::Scope S(PI.Context);
+  CurOptions = &PI.Options;
 
-static const short yyrhs[] = {     5,
-     0,     6,     0,     3,     0,     4,     0,     8,     0,     9,
-     0,    10,     0,    11,     0,    12,     0,    13,     0,    14,
-     0,    15,     0,    16,     0,    17,     0,    18,     0,    19,
-     0,    20,     0,    21,     0,    70,     0,     7,     0,    36,
-     0,    37,     0,    38,     0,    39,     0,    40,     0,    41,
-     0,    42,     0,    43,     0,    44,     0,    45,     0,    46,
-     0,    47,     0,    48,     0,    49,     0,    50,     0,    15,
-     0,    13,     0,    11,     0,     9,     0,    16,     0,    14,
-     0,    12,     0,    10,     0,    74,     0,    75,     0,    22,
-    58,     0,     0,    74,    69,     0,    75,     4,     0,     8,
-    26,     0,     8,    27,     0,    19,    24,     0,    20,    70,
-     0,    59,    70,    60,    59,    79,    60,     0,    59,    70,
-    60,    59,    60,     0,    59,     4,    61,    70,    60,    59,
-    79,    60,     0,    59,     4,    61,    70,    60,    59,    60,
-     0,    62,    92,    63,    62,    79,    63,     0,    62,    63,
-    62,    63,     0,    79,    64,    78,     0,    78,     0,    80,
-    77,    78,     0,     0,    82,     0,    82,    89,     0,    80,
-    25,     0,    22,     0,     0,    70,    83,     0,    84,    64,
-    85,     0,    84,     0,    85,     0,     0,    71,    24,    65,
-    86,    66,     0,    87,    80,    28,     0,    93,    29,     0,
-     3,     0,     4,     0,    26,     0,    27,     0,    24,     0,
-    68,     0,    22,     0,    90,     0,    91,     0,    71,    65,
-    92,    66,     0,    71,    65,    66,     0,    59,    70,    60,
-     0,    59,     4,    61,    70,    60,     0,    62,    92,    63,
-     0,    62,    63,     0,    70,    67,     0,    70,     0,    92,
-    64,    70,     0,    93,    94,     0,    88,    94,     0,    95,
-    96,     0,    23,    95,    96,     0,    95,    98,     0,     0,
-    33,    70,    91,     0,    33,     7,     0,    34,    21,    91,
-     0,    34,     8,    91,    64,    21,    91,    64,    21,    91,
-     0,    35,    76,    91,    64,    21,    91,    59,    97,    60,
-     0,    97,    76,    90,    64,    21,    91,     0,    76,    90,
-    64,    21,    91,     0,    77,   101,     0,    70,    91,     0,
-    99,    64,    91,     0,    99,     0,     0,    73,    70,    91,
-    64,    91,     0,    72,    70,    91,     0,    31,    99,     0,
-    32,    70,    91,    65,   100,    66,     0,   102,     0,    51,
-    70,     0,    51,    70,    64,    14,    91,     0,    52,    70,
-     0,    52,    70,    64,    14,    91,     0,    53,    70,    91,
-     0
-};
+  while (1) {
+    unsigned i;
+    {
+      MutexLocker L(PI.Lock);
+      i = PI.NextMethod++;
+    }
+    if (i >= PI.Methods.size()) break;
+
+    ParserState *PS = PI.States[i] = new ParserState();
+    PS->ModInfo.Header = &PI.Header;
+    PS->ModInfo.Partial = true;
+    PS->ModInfo.CurrentModule = new Module();  // Scratch module for the method
+
+    // The method is parsed as if it were the only one in a module with an
+    // empty header.
+    try {
+      RunParser(*PS, PI.Methods[i].Start, PI.Methods[i].End, 
+                PI.Methods[i].LineNo, IMPLEMENTATION);
+    } catch (const ParseException &E) {
+      PI.Errors[i] = new ParseException(E);
+    }
+  }
 
-#endif
+  CurOptions = 0;
+  return 0;
+}
 
-#if YYDEBUG != 0
-static const short yyrline[] = { 0,
-   433,   434,   441,   442,   453,   453,   453,   453,   453,   453,
-   453,   454,   454,   454,   454,   454,   454,   454,   457,   457,
-   462,   462,   462,   462,   463,   463,   463,   463,   463,   464,
-   464,   464,   464,   464,   464,   468,   468,   468,   468,   469,
-   469,   469,   469,   470,   470,   472,   475,   479,   484,   489,
-   492,   495,   501,   504,   517,   521,   539,   546,   554,   568,
-   571,   577,   585,   596,   601,   606,   615,   615,   617,   625,
-   629,   634,   637,   641,   668,   672,   681,   684,   687,   690,
-   693,   698,   701,   704,   711,   719,   724,   728,   731,   734,
-   739,   742,   747,   751,   756,   760,   769,   774,   783,   787,
-   791,   794,   797,   800,   805,   816,   824,   834,   842,   846,
-   852,   852,   854,   859,   864,   873,   910,   914,   919,   929,
-   934,   944
-};
-#endif
+// ParseMethodsInParallel - Parse all of the method bodies with NumThreads 
+// threads, then link them into the module read from the header (which is the
+// current state of this thread).
+//
+static void ParseMethodsInParallel(const vector<MethodChunk> &Methods,
+                                   unsigned NumThreads) {
+  ParallelParseInfo PI(Methods, *CurModule, *CurOptions);
+  PerModuleInfo *MainModule = CurModule;
+  PerMethodInfo *MainMeth   = CurMeth;
+
+  vector<pthread_t> Threads(NumThreads-1);
+  unsigned NumStarted = 0;
+  for (; NumStarted < Threads.size(); ++NumStarted)
+    if (pthread_create(&Threads[NumStarted], 0, MethodParserThread, &PI))
+      break;                     // Make do with the threads we have...
+  MethodParserThread(&PI);       // This thread works too
+  for (unsigned i = 0; i < NumStarted; ++i)
+    pthread_join(Threads[i], 0);
+
+  CurModule = MainModule;
+  CurMeth   = MainMeth;
+  CurOptions = &PI.Options;
+
+  // Report the error from the first method that failed, so that the error is
+  // the same whatever order the methods were parsed in.
+  //
+  for (unsigned i = 0; i < Methods.size(); ++i)
+    if (PI.Errors[i]) {
+      ParseException E(*PI.Errors[i]);
+      for (unsigned j = 0; j < Methods.size(); ++j) {
+        delete PI.Errors[j];
+        if (PI.States[j]) delete PI.States[j]->ModInfo.CurrentModule;
+        delete PI.States[j];
+      }
+      throw E;
+    }
 
+  // Move the methods into the real module, in source order.  A name that is
+  // defined again refers to the later definition, as it does when the file is
+  // parsed serially (see InsertName).
+  //
+  Module *M = CurModule->CurrentModule;
+  for (unsigned i = 0; i < Methods.size(); ++i) {
+    ParserState *PS = PI.States[i];
+    Module::MethodListType &ML = PS->ModInfo.CurrentModule->getMethodList();
+    while (!ML.empty()) {
+      Module::MethodListType::iterator I = ML.begin();
+      M->getMethodList().push_back(ML.remove(I));
+    }
+    NameTable &Names = PS->ModInfo.Names;
+    for (NameTable::iterator I = Names.begin(); I != Names.end(); ++I)
+      CurModule->Names[I->first] = I->second;
+  }
 
-#if YYDEBUG != 0 || defined (YYERROR_VERBOSE)
-
-static const char * const yytname[] = {   "$","error","$undefined.","ESINT64VAL",
-"EUINT64VAL","SINTVAL","UINTVAL","VOID","BOOL","SBYTE","UBYTE","SHORT","USHORT",
-"INT","UINT","LONG","ULONG","FLOAT","DOUBLE","STRING","TYPE","LABEL","VAR_ID",
-"LABELSTR","STRINGCONSTANT","IMPLEMENTATION","TRUE","FALSE","BEGINTOK","END",
-"DECLARE","PHI","CALL","RET","BR","SWITCH","NEG","NOT","TOINT","TOUINT","ADD",
-"SUB","MUL","DIV","REM","SETLE","SETGE","SETLT","SETGT","SETEQ","SETNE","MALLOC",
-"ALLOCA","FREE","LOAD","STORE","GETFIELD","PUTFIELD","'='","'['","']'","'x'",
-"'{'","'}'","','","'('","')'","'*'","INTVAL","EINT64VAL","Types","TypesV","UnaryOps",
-"BinaryOps","SIntType","UIntType","IntType","OptAssign","ConstVal","ConstVector",
-"ConstPool","Module","MethodList","OptVAR_ID","ArgVal","ArgListH","ArgList",
-"MethodHeaderH","MethodHeader","Method","ConstValueRef","ValueRef","TypeList",
-"BasicBlockList","BasicBlock","InstructionList","BBTerminatorInst","JumpTable",
-"Inst","ValueRefList","ValueRefListE","InstVal","MemoryInst", NULL
-};
-#endif
+  // Now that all of the methods are defined, resolve the references each 
+  // method body made to module level values...
+  //
+  for (unsigned i = 0; i < Methods.size(); ++i) {
+    ParserState *PS = PI.States[i];
+    ForwardRefTable &FR = PS->ModInfo.ForwardRefs;
+    llvmAsmlineno = Methods[i].LineNo;
+    while (!FR.empty()) {
+      ValueKey Key = FR.Placeholders.begin()->first;
+      Value *V = getVal(Key.first, Key.second, true);
+      if (V == 0) ResolveDefinitions(PS->ModInfo);  // Throws an exception
+      FR.resolve(Key.first, Key.second, V);
+    }
 
-static const short yyr1[] = {     0,
-    68,    68,    69,    69,    70,    70,    70,    70,    70,    70,
-    70,    70,    70,    70,    70,    70,    70,    70,    71,    71,
-    72,    72,    72,    72,    73,    73,    73,    73,    73,    73,
-    73,    73,    73,    73,    73,    74,    74,    74,    74,    75,
-    75,    75,    75,    76,    76,    77,    77,    78,    78,    78,
-    78,    78,    78,    78,    78,    78,    78,    78,    78,    79,
-    79,    80,    80,    81,    82,    82,    83,    83,    84,    85,
-    85,    86,    86,    87,    88,    89,    90,    90,    90,    90,
-    90,    91,    91,    91,    70,    70,    70,    70,    70,    70,
-    70,    70,    92,    92,    93,    93,    94,    94,    95,    95,
-    96,    96,    96,    96,    96,    97,    97,    98,    99,    99,
-   100,   100,   101,   101,   101,   101,   101,   102,   102,   102,
-   102,   102
-};
+    delete PS->ModInfo.CurrentModule;  // Delete the (now empty) scratch module
+    delete PS;
+  }
+}
 
-static const short yyr2[] = {     0,
-     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-     1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-     1,     1,     1,     1,     1,     2,     0,     2,     2,     2,
-     2,     2,     2,     6,     5,     8,     7,     6,     4,     3,
-     1,     3,     0,     1,     2,     2,     1,     0,     2,     3,
-     1,     1,     0,     5,     3,     2,     1,     1,     1,     1,
-     1,     1,     1,     1,     1,     4,     3,     3,     5,     3,
-     2,     2,     1,     3,     2,     2,     2,     3,     2,     0,
-     3,     2,     3,     9,     9,     6,     5,     2,     2,     3,
-     1,     0,     5,     3,     2,     6,     1,     2,     5,     2,
-     5,     3
-};
+// NumberTypesCanonically - Give the types created while M was parsed (the ones
+// with UIDs from FirstUID up) UIDs that only depend on what the types are, and
+// sort the constant pools of M, which are ordered by type UID, again.  When 
+// methods are parsed in parallel, the types are created in whatever order the
+// threads happen to run in, and a serial parse creates them in yet another 
+// order.  This is done after both, so that the output does not depend on how
+// many threads were used.
+//
+static void NumberTypesCanonically(Module *M, unsigned FirstUID) {
+  TypeContext::getCurrent()->renumberTypes(FirstUID);
+  M->getConstantPool().sortPlanes();
+  for (Module::MethodListType::iterator MI = M->getMethodList().begin();
+       MI != M->getMethodList().end(); ++MI)
+    (*MI)->getConstantPool().sortPlanes();
+}
 
-static const short yydefact[] = {    63,
-    47,    64,     0,    66,     0,    77,    78,     1,     2,    20,
-     5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-    15,    16,    17,    18,    83,    81,    79,    80,     0,     0,
-    82,    19,     0,    63,   100,    65,    84,    85,   100,    46,
-     0,    39,    43,    38,    42,    37,    41,    36,    40,     0,
-     0,     0,     0,     0,     0,    62,    78,    19,     0,    91,
-    93,     0,    92,     0,     0,    47,   100,    96,    47,    76,
-    95,    50,    51,    52,    53,    78,    19,     0,     0,     3,
-     4,    48,    49,     0,    88,    90,     0,    73,    87,     0,
-    75,    47,     0,     0,     0,     0,    97,    99,     0,     0,
-     0,     0,    19,    94,    68,    71,    72,     0,    86,    98,
-   102,    19,     0,     0,    44,    45,     0,     0,     0,    21,
-    22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
-    32,    33,    34,    35,     0,     0,     0,     0,     0,   108,
-   117,    19,     0,    59,     0,    89,    67,    69,     0,    74,
-   101,     0,   103,     0,    19,   115,    19,   118,   120,    19,
-    19,    19,     0,    55,    61,     0,     0,    70,     0,     0,
-   109,     0,     0,     0,     0,   122,   114,     0,     0,    54,
-     0,    58,     0,     0,   110,   112,     0,     0,     0,    57,
-     0,    60,     0,     0,   111,     0,   119,   121,   113,    56,
-     0,     0,   116,     0,     0,     0,   104,     0,   105,     0,
-     0,     0,     0,     0,   107,     0,   106,     0,     0,     0
-};
+// getNumParserThreads - Return the number of threads to parse methods with.
+// This is the number of processors online, or the value of the 
+// LLVM_AS_THREADS environment variable if it is set.
+//
+static unsigned getNumParserThreads() {
+  if (const char *Env = getenv("LLVM_AS_THREADS"))
+    return atoi(Env) > 0 ? atoi(Env) : 1;
+  long NumCPUs = sysconf(_SC_NPROCESSORS_ONLN);
+  return NumCPUs > 0 ? NumCPUs : 1;
+}
 
-static const short yydefgoto[] = {    31,
-    82,    61,    59,   138,   139,    54,    55,   117,     5,   165,
-   166,     1,   218,     2,   148,   106,   107,   108,    34,    35,
-    36,    37,    38,    62,    39,    68,    69,    97,   206,    98,
-   156,   196,   140,   141
-};
+Module *RunVMAsmParser(const ToolCommandLine &Opts, 
+                       const char *BufStart, const char *BufEnd) {
+  CurOptions = &Opts;
+  ParserState PS;
+  PS.ModInfo.CurrentModule = new Module();  // Allocate a new module to read
+  unsigned FirstUID = TypeContext::getCurrent()->getNextUID();
+
+  const char *HeaderEnd;
+  vector<MethodChunk> Methods;
+  unsigned NumThreads = getNumParserThreads();
+  if (NumThreads > 1 && 
+      llvmAsmFindMethods(BufStart, BufEnd, HeaderEnd, Methods) &&
+      Methods.size() > 1) {
+    PS.ModInfo.Partial = true;
+    RunParser(PS, BufStart, HeaderEnd);     // Parse the module header
+
+    if (NumThreads > Methods.size()) NumThreads = Methods.size();
+    ParseMethodsInParallel(Methods, NumThreads);
+
+    PS.ModInfo.Partial = false;
+    PS.ModInfo.ModuleDone();
+  } else {
+    RunParser(PS, BufStart, BufEnd);        // Parse the file.
+  }
+
+  if (PS.Result) NumberTypesCanonically(PS.Result, FirstUID);
+  CurOptions = 0;
+  return PS.Result;
+}
 
-static const short yypact[] = {-32768,
-    59,   295,   -23,-32768,   435,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,   320,   209,
--32768,   -21,   -20,-32768,    38,-32768,-32768,-32768,    83,-32768,
-    66,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,    77,
-   295,   380,   234,   206,   122,-32768,   107,    29,   108,-32768,
-   167,     6,-32768,   111,   145,   101,-32768,-32768,    45,-32768,
--32768,-32768,-32768,-32768,   167,   142,    44,   121,    81,-32768,
--32768,-32768,-32768,   295,-32768,-32768,   295,   295,-32768,   193,
--32768,    45,   405,     1,   264,   149,-32768,-32768,   295,   205,
-   202,   204,    58,   167,    10,   203,-32768,   215,-32768,-32768,
-   217,     7,   116,   116,-32768,-32768,   116,   295,   295,-32768,
--32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
--32768,-32768,-32768,-32768,   295,   295,   295,   295,   295,-32768,
--32768,    72,    28,-32768,   435,-32768,-32768,-32768,   295,-32768,
--32768,   219,-32768,   220,     7,   221,     7,   -59,   141,     7,
-     7,     7,   210,-32768,-32768,   110,   199,-32768,   249,   265,
--32768,   116,   222,   274,   275,-32768,-32768,   226,    43,-32768,
-   435,-32768,   116,   116,-32768,   295,   116,   116,   116,-32768,
-   115,-32768,   227,   233,   221,   228,-32768,-32768,-32768,-32768,
-   297,   264,-32768,   116,   104,     5,-32768,   231,-32768,   104,
-   299,   279,   116,   324,-32768,   116,-32768,   348,   349,-32768
-};
 
-static const short yypgoto[] = {-32768,
--32768,    -2,   350,-32768,-32768,   -93,   -92,   -24,   -62,    -4,
-  -119,   316,-32768,-32768,-32768,-32768,   207,-32768,-32768,-32768,
--32768,   -64,   -89,    11,-32768,   312,   286,   263,-32768,-32768,
-   172,-32768,-32768,-32768
+#line 772 "llvmAsmParser.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "llvmAsmParser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_ESINT64VAL = 3,                 /* ESINT64VAL  */
+  YYSYMBOL_EUINT64VAL = 4,                 /* EUINT64VAL  */
+  YYSYMBOL_SINTVAL = 5,                    /* SINTVAL  */
+  YYSYMBOL_UINTVAL = 6,                    /* UINTVAL  */
+  YYSYMBOL_VOID = 7,                       /* VOID  */
+  YYSYMBOL_BOOL = 8,                       /* BOOL  */
+  YYSYMBOL_SBYTE = 9,                      /* SBYTE  */
+  YYSYMBOL_UBYTE = 10,                     /* UBYTE  */
+  YYSYMBOL_SHORT = 11,                     /* SHORT  */
+  YYSYMBOL_USHORT = 12,                    /* USHORT  */
+  YYSYMBOL_INT = 13,                       /* INT  */
+  YYSYMBOL_UINT = 14,                      /* UINT  */
+  YYSYMBOL_LONG = 15,                      /* LONG  */
+  YYSYMBOL_ULONG = 16,                     /* ULONG  */
+  YYSYMBOL_FLOAT = 17,                     /* FLOAT  */
+  YYSYMBOL_DOUBLE = 18,                    /* DOUBLE  */
+  YYSYMBOL_STRING = 19,                    /* STRING  */
+  YYSYMBOL_TYPE = 20,                      /* TYPE  */
+  YYSYMBOL_LABEL = 21,                     /* LABEL  */
+  YYSYMBOL_VAR_ID = 22,                    /* VAR_ID  */
+  YYSYMBOL_LABELSTR = 23,                  /* LABELSTR  */
+  YYSYMBOL_STRINGCONSTANT = 24,            /* STRINGCONSTANT  */
+  YYSYMBOL_IMPLEMENTATION = 25,            /* IMPLEMENTATION  */
+  YYSYMBOL_TRUE = 26,                      /* TRUE  */
+  YYSYMBOL_FALSE = 27,                     /* FALSE  */
+  YYSYMBOL_BEGINTOK = 28,                  /* BEGINTOK  */
+  YYSYMBOL_END = 29,                       /* END  */
+  YYSYMBOL_DECLARE = 30,                   /* DECLARE  */
+  YYSYMBOL_PHI = 31,                       /* PHI  */
+  YYSYMBOL_CALL = 32,                      /* CALL  */
+  YYSYMBOL_RET = 33,                       /* RET  */
+  YYSYMBOL_BR = 34,                        /* BR  */
+  YYSYMBOL_SWITCH = 35,                    /* SWITCH  */
+  YYSYMBOL_NEG = 36,                       /* NEG  */
+  YYSYMBOL_NOT = 37,                       /* NOT  */
+  YYSYMBOL_TOINT = 38,                     /* TOINT  */
+  YYSYMBOL_TOUINT = 39,                    /* TOUINT  */
+  YYSYMBOL_ADD = 40,                       /* ADD  */
+  YYSYMBOL_SUB = 41,                       /* SUB  */
+  YYSYMBOL_MUL = 42,                       /* MUL  */
+  YYSYMBOL_DIV = 43,                       /* DIV  */
+  YYSYMBOL_REM = 44,                       /* REM  */
+  YYSYMBOL_AND = 45,                       /* AND  */
+  YYSYMBOL_OR = 46,                        /* OR  */
+  YYSYMBOL_XOR = 47,                       /* XOR  */
+  YYSYMBOL_SETLE = 48,                     /* SETLE  */
+  YYSYMBOL_SETGE = 49,                     /* SETGE  */
+  YYSYMBOL_SETLT = 50,                     /* SETLT  */
+  YYSYMBOL_SETGT = 51,                     /* SETGT  */
+  YYSYMBOL_SETEQ = 52,                     /* SETEQ  */
+  YYSYMBOL_SETNE = 53,                     /* SETNE  */
+  YYSYMBOL_MALLOC = 54,                    /* MALLOC  */
+  YYSYMBOL_ALLOCA = 55,                    /* ALLOCA  */
+  YYSYMBOL_FREE = 56,                      /* FREE  */
+  YYSYMBOL_LOAD = 57,                      /* LOAD  */
+  YYSYMBOL_STORE = 58,                     /* STORE  */
+  YYSYMBOL_GETFIELD = 59,                  /* GETFIELD  */
+  YYSYMBOL_PUTFIELD = 60,                  /* PUTFIELD  */
+  YYSYMBOL_61_ = 61,                       /* '='  */
+  YYSYMBOL_62_ = 62,                       /* '['  */
+  YYSYMBOL_63_ = 63,                       /* ']'  */
+  YYSYMBOL_64_x_ = 64,                     /* 'x'  */
+  YYSYMBOL_65_ = 65,                       /* '{'  */
+  YYSYMBOL_66_ = 66,                       /* '}'  */
+  YYSYMBOL_67_ = 67,                       /* ','  */
+  YYSYMBOL_68_ = 68,                       /* '('  */
+  YYSYMBOL_69_ = 69,                       /* ')'  */
+  YYSYMBOL_70_ = 70,                       /* '*'  */
+  YYSYMBOL_YYACCEPT = 71,                  /* $accept  */
+  YYSYMBOL_INTVAL = 72,                    /* INTVAL  */
+  YYSYMBOL_EINT64VAL = 73,                 /* EINT64VAL  */
+  YYSYMBOL_Types = 74,                     /* Types  */
+  YYSYMBOL_TypesV = 75,                    /* TypesV  */
+  YYSYMBOL_UnaryOps = 76,                  /* UnaryOps  */
+  YYSYMBOL_BinaryOps = 77,                 /* BinaryOps  */
+  YYSYMBOL_SIntType = 78,                  /* SIntType  */
+  YYSYMBOL_UIntType = 79,                  /* UIntType  */
+  YYSYMBOL_IntType = 80,                   /* IntType  */
+  YYSYMBOL_OptAssign = 81,                 /* OptAssign  */
+  YYSYMBOL_ConstVal = 82,                  /* ConstVal  */
+  YYSYMBOL_ConstVector = 83,               /* ConstVector  */
+  YYSYMBOL_ConstPool = 84,                 /* ConstPool  */
+  YYSYMBOL_Module = 85,                    /* Module  */
+  YYSYMBOL_MethodList = 86,                /* MethodList  */
+  YYSYMBOL_OptVAR_ID = 87,                 /* OptVAR_ID  */
+  YYSYMBOL_ArgVal = 88,                    /* ArgVal  */
+  YYSYMBOL_ArgListH = 89,                  /* ArgListH  */
+  YYSYMBOL_ArgList = 90,                   /* ArgList  */
+  YYSYMBOL_MethodHeaderH = 91,             /* MethodHeaderH  */
+  YYSYMBOL_MethodHeader = 92,              /* MethodHeader  */
+  YYSYMBOL_Method = 93,                    /* Method  */
+  YYSYMBOL_ConstValueRef = 94,             /* ConstValueRef  */
+  YYSYMBOL_ValueRef = 95,                  /* ValueRef  */
+  YYSYMBOL_TypeList = 96,                  /* TypeList  */
+  YYSYMBOL_BasicBlockList = 97,            /* BasicBlockList  */
+  YYSYMBOL_BasicBlock = 98,                /* BasicBlock  */
+  YYSYMBOL_InstructionList = 99,           /* InstructionList  */
+  YYSYMBOL_BBTerminatorInst = 100,         /* BBTerminatorInst  */
+  YYSYMBOL_JumpTable = 101,                /* JumpTable  */
+  YYSYMBOL_Inst = 102,                     /* Inst  */
+  YYSYMBOL_ValueRefList = 103,             /* ValueRefList  */
+  YYSYMBOL_ValueRefListE = 104,            /* ValueRefListE  */
+  YYSYMBOL_InstVal = 105,                  /* InstVal  */
+  YYSYMBOL_MemoryInst = 106                /* MemoryInst  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
 
-#define	YYLAST		497
-
-
-static const short yytable[] = {    32,
-    56,   115,   116,    64,   174,   -19,    96,    63,   113,     6,
-     7,     8,     9,    42,    43,    44,    45,    46,    47,    48,
-    49,   114,   151,   152,   153,   167,    58,   154,    25,    96,
-    26,   147,    27,    28,    40,    41,    42,    43,    44,    45,
-    46,    47,    48,    49,    65,    63,    50,    51,    75,    77,
-    41,    42,    43,    44,    45,    46,    47,    48,    49,   191,
-    67,    50,    51,    79,   209,   171,     3,   173,    86,    87,
-   176,   177,   178,    63,   -19,    90,    63,    93,    94,    95,
-     3,   103,   185,     4,   104,   105,    52,   164,    85,    53,
-   112,    72,    73,   193,   194,    63,   142,   197,   198,   199,
-    74,    52,   190,   100,    53,    67,     6,     7,   115,   116,
-    63,    70,   115,   116,   207,   155,   157,   146,     6,     7,
-     8,     9,     3,   215,    63,    83,   217,    26,    91,    27,
-    28,   163,   158,   159,   160,   161,   162,    25,    63,    26,
-   208,    27,    28,   102,    87,   212,   105,     6,     7,     8,
-     9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-    19,    20,    21,    22,    23,    24,    25,    84,    26,   180,
-    27,    28,    65,   181,   200,    88,   192,   205,   181,   118,
-   119,   210,   101,   155,   120,   121,   122,   123,   124,   125,
-   126,   127,   128,   129,   130,   131,   132,   133,   134,   135,
-   136,   137,    99,    29,   175,   -19,    30,    63,    80,    81,
-    89,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-    15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-    25,   -19,    26,    63,    27,    28,     6,     7,     8,     9,
-    10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
-    20,    21,    22,    23,    24,    25,    87,    26,   109,    27,
-    28,   182,   181,   143,   144,   145,   149,    29,   179,   183,
-    30,    60,    42,    43,    44,    45,    46,    47,    48,    49,
-   150,   -20,   169,   170,   172,   184,   186,   187,   188,   189,
-   201,   202,    29,   203,   211,    30,    78,     6,     7,     8,
-     9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-    19,    20,    21,    22,    23,    24,    25,   204,    26,   213,
-    27,    28,     6,    57,     8,     9,    10,    11,    12,    13,
-    14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-    24,    25,   214,    26,   216,    27,    28,   219,   220,    66,
-    71,    33,    92,    29,   110,   168,    30,   195,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,    29,     0,
-     0,    30,     6,    76,     8,     9,    10,    11,    12,    13,
-    14,    15,    16,    17,    18,    19,    20,    21,    22,    23,
-    24,    25,     0,    26,     0,    27,    28,     6,     7,     8,
-     9,   111,    11,    12,    13,    14,    15,    16,    17,    18,
-    19,    20,    21,    22,    23,    24,    25,     0,    26,     0,
-    27,    28,     0,     0,     0,     0,     0,     0,    29,     0,
-     0,    30,    41,    42,    43,    44,    45,    46,    47,    48,
-    49,     0,     0,    50,    51,     0,     0,     0,     0,     0,
-     0,     0,     0,    29,     0,     0,    30,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     0,     0,     0,    52,     0,     0,    53
-};
+/* Second part of user prologue.  */
+#line 741 "llvmAsmParser.y"
 
-static const short yycheck[] = {     2,
-     5,    95,    95,    24,    64,    65,    69,    67,     8,     3,
-     4,     5,     6,     9,    10,    11,    12,    13,    14,    15,
-    16,    21,   112,   113,   114,   145,    29,   117,    22,    92,
-    24,    22,    26,    27,    58,     8,     9,    10,    11,    12,
-    13,    14,    15,    16,    65,    67,    19,    20,    51,    52,
-     8,     9,    10,    11,    12,    13,    14,    15,    16,   179,
-    23,    19,    20,    53,    60,   155,    22,   157,    63,    64,
-   160,   161,   162,    67,    65,    65,    67,    33,    34,    35,
-    22,    84,   172,    25,    87,    88,    59,    60,    60,    62,
-    93,    26,    27,   183,   184,    67,    99,   187,   188,   189,
-    24,    59,    60,    60,    62,    23,     3,     4,   202,   202,
-    67,    29,   206,   206,   204,   118,   119,    60,     3,     4,
-     5,     6,    22,   213,    67,     4,   216,    24,    28,    26,
-    27,    60,   135,   136,   137,   138,   139,    22,    67,    24,
-   205,    26,    27,    63,    64,   210,   149,     3,     4,     5,
-     6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
-    16,    17,    18,    19,    20,    21,    22,    61,    24,    60,
-    26,    27,    65,    64,    60,    65,   181,   202,    64,    31,
-    32,   206,    62,   186,    36,    37,    38,    39,    40,    41,
-    42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-    52,    53,    61,    59,    64,    65,    62,    67,     3,     4,
-    66,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-    12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-    22,    65,    24,    67,    26,    27,     3,     4,     5,     6,
-     7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
-    17,    18,    19,    20,    21,    22,    64,    24,    66,    26,
-    27,    63,    64,    59,    63,    62,    64,    59,    59,    21,
-    62,    63,     9,    10,    11,    12,    13,    14,    15,    16,
-    66,    65,    64,    64,    64,    21,    65,    14,    14,    64,
-    64,    59,    59,    66,    64,    62,    63,     3,     4,     5,
-     6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
-    16,    17,    18,    19,    20,    21,    22,    21,    24,    21,
-    26,    27,     3,     4,     5,     6,     7,     8,     9,    10,
-    11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
-    21,    22,    64,    24,    21,    26,    27,     0,     0,    34,
-    39,     2,    67,    59,    92,   149,    62,   186,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    59,    -1,
-    -1,    62,     3,     4,     5,     6,     7,     8,     9,    10,
-    11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
-    21,    22,    -1,    24,    -1,    26,    27,     3,     4,     5,
-     6,     7,     8,     9,    10,    11,    12,    13,    14,    15,
-    16,    17,    18,    19,    20,    21,    22,    -1,    24,    -1,
-    26,    27,    -1,    -1,    -1,    -1,    -1,    -1,    59,    -1,
-    -1,    62,     8,     9,    10,    11,    12,    13,    14,    15,
-    16,    -1,    -1,    19,    20,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    59,    -1,    -1,    62,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-    -1,    -1,    -1,    59,    -1,    -1,    62
-};
-/* -*-C-*-  Note some compilers choke on comments on `#line' lines.  */
-#line 3 "/usr/dcs/software/supported/encap/bison-1.28/share/bison.simple"
-/* This file comes from bison-1.28.  */
+int yylex(YYSTYPE *lvalp);    // The lexer is reentrant too, see Lexer.cpp
 
-/* Skeleton output parser for bison,
-   Copyright (C) 1984, 1989, 1990 Free Software Foundation, Inc.
+#line 916 "llvmAsmParser.cpp"
 
-   This program is free software; you can redistribute it and/or modify
-   it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
 
-   This program is distributed in the hope that it will be useful,
-   but WITHOUT ANY WARRANTY; without even the implied warranty of
-   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
-   GNU General Public License for more details.
+#ifdef short
+# undef short
+#endif
 
-   You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 59 Temple Place - Suite 330,
-   Boston, MA 02111-1307, USA.  */
-
-/* As a special exception, when this file is copied by Bison into a
-   Bison output file, you may use that output file without restriction.
-   This special exception was added by the Free Software Foundation
-   in version 1.24 of Bison.  */
-
-/* This is the parser code that is written into each bison parser
-  when the %semantic_parser declaration is not specified in the grammar.
-  It was written by Richard Stallman by simplifying the hairy parser
-  used when %semantic_parser is specified.  */
-
-#ifndef YYSTACK_USE_ALLOCA
-#ifdef alloca
-#define YYSTACK_USE_ALLOCA
-#else /* alloca not defined */
-#ifdef __GNUC__
-#define YYSTACK_USE_ALLOCA
-#define alloca __builtin_alloca
-#else /* not GNU C.  */
-#if (!defined (__STDC__) && defined (sparc)) || defined (__sparc__) || defined (__sparc) || defined (__sgi) || (defined (__sun) && defined (__i386))
-#define YYSTACK_USE_ALLOCA
-#include <alloca.h>
-#else /* not sparc */
-/* We think this test detects Watcom and Microsoft C.  */
-/* This used to test MSDOS, but that is a bad idea
-   since that symbol is in the user namespace.  */
-#if (defined (_MSDOS) || defined (_MSDOS_)) && !defined (__TURBOC__)
-#if 0 /* No need for malloc.h, which pollutes the namespace;
-	 instead, just don't use alloca.  */
-#include <malloc.h>
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
-#else /* not MSDOS, or __TURBOC__ */
-#if defined(_AIX)
-/* I don't know what this was needed for, but it pollutes the namespace.
-   So I turned it off.   rms, 2 May 1997.  */
-/* #include <malloc.h>  */
- #pragma alloca
-#define YYSTACK_USE_ALLOCA
-#else /* not MSDOS, or __TURBOC__, or _AIX */
-#if 0
-#ifdef __hpux /* haible@ilog.fr says this works for HPUX 9.05 and up,
-		 and on HPUX 10.  Eventually we can turn this on.  */
-#define YYSTACK_USE_ALLOCA
-#define alloca __builtin_alloca
-#endif /* __hpux */
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
-#endif /* not _AIX */
-#endif /* not MSDOS, or __TURBOC__ */
-#endif /* not sparc */
-#endif /* not GNU C */
-#endif /* alloca not defined */
-#endif /* YYSTACK_USE_ALLOCA not defined */
-
-#ifdef YYSTACK_USE_ALLOCA
-#define YYSTACK_ALLOC alloca
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-#define YYSTACK_ALLOC malloc
+typedef short yytype_int16;
 #endif
 
-/* Note: there must be only one dollar sign in this file.
-   It is replaced by the list of actions, each action
-   as one case of the switch.  */
-
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		-2
-#define YYEOF		0
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT 	goto yyabortlab
-#define YYERROR		goto yyerrlab1
-/* Like YYERROR except do call yyerror.
-   This remains here temporarily to ease the
-   transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
-#define YYFAIL		goto yyerrlab
-#define YYRECOVERING()  (!!yyerrstatus)
-#define YYBACKUP(token, value) \
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    { yychar = (token), yylval = (value);			\
-      yychar1 = YYTRANSLATE (yychar);				\
-      YYPOPSTACK;						\
-      goto yybackup;						\
-    }								\
-  else								\
-    { yyerror ("syntax error: cannot back up"); YYERROR; }	\
-while (0)
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-#ifndef YYPURE
-#define YYLEX		yylex()
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYPURE
-#ifdef YYLSP_NEEDED
-#ifdef YYLEX_PARAM
-#define YYLEX		yylex(&yylval, &yylloc, YYLEX_PARAM)
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-#define YYLEX		yylex(&yylval, &yylloc)
+typedef short yytype_uint8;
 #endif
-#else /* not YYLSP_NEEDED */
-#ifdef YYLEX_PARAM
-#define YYLEX		yylex(&yylval, YYLEX_PARAM)
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-#define YYLEX		yylex(&yylval)
+typedef int yytype_uint16;
 #endif
-#endif /* not YYLSP_NEEDED */
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
-/* If nonreentrant, generate the variables here */
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
 
-#ifndef YYPURE
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
 
-int	yychar;			/*  the lookahead symbol		*/
-YYSTYPE	yylval;			/*  the semantic value of the		*/
-				/*  lookahead symbol			*/
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
 
-#ifdef YYLSP_NEEDED
-YYLTYPE yylloc;			/*  location data for the lookahead	*/
-				/*  symbol				*/
-#endif
 
-int yynerrs;			/*  number of parse errors so far       */
-#endif  /* not YYPURE */
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
 
-#if YYDEBUG != 0
-int yydebug;			/*  nonzero means print parse trace	*/
-/* Since this is uninitialized, it does not stop multiple parsers
-   from coexisting.  */
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
 #endif
 
-/*  YYINITDEPTH indicates the initial size of the parser's stacks	*/
 
-#ifndef	YYINITDEPTH
-#define YYINITDEPTH 200
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
-/*  YYMAXDEPTH is the maximum size the stacks can grow to
-    (effective only if the built-in stack extension method is used).  */
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
 
-#if YYMAXDEPTH == 0
-#undef YYMAXDEPTH
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
 #endif
 
-#ifndef YYMAXDEPTH
-#define YYMAXDEPTH 10000
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
-
-/* Define __yy_memcpy.  Note that the size argument
-   should be passed with type unsigned int, because that is what the non-GCC
-   definitions require.  With GCC, __builtin_memcpy takes an arg
-   of type size_t, but it can handle unsigned int.  */
-
-#if __GNUC__ > 1		/* GNU C and GNU C++ define this.  */
-#define __yy_memcpy(TO,FROM,COUNT)	__builtin_memcpy(TO,FROM,COUNT)
-#else				/* not GNU C or C++ */
-#ifndef __cplusplus
-
-/* This is the most reliable way to avoid incompatibilities
-   in available built-in functions on various systems.  */
-static void
-__yy_memcpy (to, from, count)
-     char *to;
-     char *from;
-     unsigned int count;
-{
-  register char *f = from;
-  register char *t = to;
-  register int i = count;
 
-  while (i-- > 0)
-    *t++ = *f++;
-}
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
 
-#else /* __cplusplus */
 
-/* This is the most reliable way to avoid incompatibilities
-   in available built-in functions on various systems.  */
-static void
-__yy_memcpy (char *to, char *from, unsigned int count)
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
 {
-  register char *t = to;
-  register char *f = from;
-  register int i = count;
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
 
-  while (i-- > 0)
-    *t++ = *f++;
-}
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
-#endif
-#endif
-
-#line 217 "/usr/dcs/software/supported/encap/bison-1.28/share/bison.simple"
-
-/* The user can define YYPARSE_PARAM as the name of an argument to be passed
-   into yyparse.  The argument should have type void *.
-   It should actually point to an object.
-   Grammar actions can access the variable by casting it
-   to the proper pointer type.  */
-
-#ifdef YYPARSE_PARAM
-#ifdef __cplusplus
-#define YYPARSE_PARAM_ARG void *YYPARSE_PARAM
-#define YYPARSE_PARAM_DECL
-#else /* not __cplusplus */
-#define YYPARSE_PARAM_ARG YYPARSE_PARAM
-#define YYPARSE_PARAM_DECL void *YYPARSE_PARAM;
-#endif /* not __cplusplus */
-#else /* not YYPARSE_PARAM */
-#define YYPARSE_PARAM_ARG
-#define YYPARSE_PARAM_DECL
-#endif /* not YYPARSE_PARAM */
-
-/* Prevent warning if -Wstrict-prototypes.  */
-#ifdef __GNUC__
-#ifdef YYPARSE_PARAM
-int yyparse (void *);
-#else
-int yyparse (void);
-#endif
 #endif
 
-int
-yyparse(YYPARSE_PARAM_ARG)
-     YYPARSE_PARAM_DECL
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  7
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   449
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  71
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  36
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  126
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  223
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   315
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
-  register int yystate;
-  register int yyn;
-  register short *yyssp;
-  register YYSTYPE *yyvsp;
-  int yyerrstatus;	/*  number of tokens to shift before error messages enabled */
-  int yychar1 = 0;		/*  lookahead token as an internal (translated) token number */
-
-  short	yyssa[YYINITDEPTH];	/*  the state stack			*/
-  YYSTYPE yyvsa[YYINITDEPTH];	/*  the semantic value stack		*/
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+      68,    69,    70,     2,    67,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    61,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,    62,     2,    63,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+      64,     2,     2,    65,     2,    66,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60
+};
 
-  short *yyss = yyssa;		/*  refer to the stacks thru separate pointers */
-  YYSTYPE *yyvs = yyvsa;	/*  to allow yyoverflow to reallocate them elsewhere */
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   811,   811,   812,   819,   820,   831,   831,   831,   831,
+     831,   831,   831,   832,   832,   832,   832,   832,   832,   832,
+     835,   835,   840,   840,   840,   840,   841,   841,   841,   841,
+     841,   841,   841,   841,   842,   842,   842,   842,   842,   842,
+     846,   846,   846,   846,   847,   847,   847,   847,   848,   848,
+     850,   853,   857,   862,   867,   870,   873,   878,   881,   894,
+     898,   916,   923,   931,   945,   948,   954,   963,   974,   979,
+     984,   993,   993,   995,  1003,  1007,  1012,  1015,  1019,  1045,
+    1049,  1058,  1061,  1064,  1067,  1070,  1075,  1078,  1081,  1088,
+    1096,  1101,  1105,  1108,  1111,  1116,  1119,  1124,  1128,  1133,
+    1137,  1146,  1152,  1161,  1165,  1169,  1172,  1175,  1178,  1183,
+    1194,  1202,  1212,  1224,  1228,  1234,  1234,  1236,  1241,  1246,
+    1255,  1292,  1296,  1301,  1311,  1316,  1326
+};
+#endif
 
-#ifdef YYLSP_NEEDED
-  YYLTYPE yylsa[YYINITDEPTH];	/*  the location stack			*/
-  YYLTYPE *yyls = yylsa;
-  YYLTYPE *yylsp;
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-#define YYPOPSTACK   (yyvsp--, yyssp--, yylsp--)
-#else
-#define YYPOPSTACK   (yyvsp--, yyssp--)
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-  int yystacksize = YYINITDEPTH;
-  int yyfree_stacks = 0;
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "ESINT64VAL",
+  "EUINT64VAL", "SINTVAL", "UINTVAL", "VOID", "BOOL", "SBYTE", "UBYTE",
+  "SHORT", "USHORT", "INT", "UINT", "LONG", "ULONG", "FLOAT", "DOUBLE",
+  "STRING", "TYPE", "LABEL", "VAR_ID", "LABELSTR", "STRINGCONSTANT",
+  "IMPLEMENTATION", "TRUE", "FALSE", "BEGINTOK", "END", "DECLARE", "PHI",
+  "CALL", "RET", "BR", "SWITCH", "NEG", "NOT", "TOINT", "TOUINT", "ADD",
+  "SUB", "MUL", "DIV", "REM", "AND", "OR", "XOR", "SETLE", "SETGE",
+  "SETLT", "SETGT", "SETEQ", "SETNE", "MALLOC", "ALLOCA", "FREE", "LOAD",
+  "STORE", "GETFIELD", "PUTFIELD", "'='", "'['", "']'", "'x'", "'{'",
+  "'}'", "','", "'('", "')'", "'*'", "$accept", "INTVAL", "EINT64VAL",
+  "Types", "TypesV", "UnaryOps", "BinaryOps", "SIntType", "UIntType",
+  "IntType", "OptAssign", "ConstVal", "ConstVector", "ConstPool", "Module",
+  "MethodList", "OptVAR_ID", "ArgVal", "ArgListH", "ArgList",
+  "MethodHeaderH", "MethodHeader", "Method", "ConstValueRef", "ValueRef",
+  "TypeList", "BasicBlockList", "BasicBlock", "InstructionList",
+  "BBTerminatorInst", "JumpTable", "Inst", "ValueRefList", "ValueRefListE",
+  "InstVal", "MemoryInst", YY_NULLPTR
+};
 
-#ifdef YYPURE
-  int yychar;
-  YYSTYPE yylval;
-  int yynerrs;
-#ifdef YYLSP_NEEDED
-  YYLTYPE yylloc;
-#endif
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
 #endif
 
-  YYSTYPE yyval;		/*  the variable used to return		*/
-				/*  semantic values from the action	*/
-				/*  routines				*/
+#define YYPACT_NINF (-141)
 
-  int yylen;
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#if YYDEBUG != 0
-  if (yydebug)
-    fprintf(stderr, "Starting parse\n");
-#endif
+#define YYTABLE_NINF (-22)
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;		/* Cause a token to be read.  */
+#define yytable_value_is_error(Yyn) \
+  0
 
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+    -141,   152,     4,   250,   -37,  -141,    23,  -141,  -141,  -141,
+    -141,  -141,  -141,  -141,  -141,  -141,  -141,  -141,  -141,  -141,
+    -141,  -141,  -141,  -141,  -141,  -141,  -141,  -141,  -141,  -141,
+    -141,   280,   186,  -141,   -10,   -21,  -141,    80,  -141,  -141,
+    -141,    -9,  -141,    87,  -141,  -141,  -141,  -141,  -141,  -141,
+    -141,  -141,    25,   250,   313,   216,   132,    62,  -141,    58,
+     -51,    61,  -141,    34,   116,  -141,    82,   149,    18,  -141,
+    -141,    99,  -141,  -141,  -141,  -141,  -141,    34,   108,   -22,
+     114,   118,  -141,  -141,  -141,  -141,   250,  -141,  -141,   250,
+     250,  -141,   111,  -141,    99,   343,     5,   133,   375,  -141,
+    -141,   250,   147,   150,   174,     2,    34,    -7,   148,  -141,
+     172,  -141,  -141,   176,     3,   104,   104,  -141,  -141,   104,
+     250,   250,  -141,  -141,  -141,  -141,  -141,  -141,  -141,  -141,
+    -141,  -141,  -141,  -141,  -141,  -141,  -141,  -141,  -141,  -141,
+     250,   250,   250,   250,   250,  -141,  -141,     8,   371,  -141,
+      23,  -141,  -141,  -141,   250,  -141,  -141,   178,  -141,   179,
+       3,   180,     3,    14,    57,     3,     3,     3,   155,  -141,
+    -141,     7,   120,  -141,   228,   229,  -141,   104,   205,   261,
+     265,  -141,  -141,   213,   384,  -141,    23,  -141,   104,   104,
+    -141,   250,   104,   104,   104,  -141,    26,  -141,   236,   243,
+     180,   239,  -141,  -141,  -141,  -141,   288,   133,  -141,   104,
+      73,    43,  -141,   244,  -141,    73,   289,   246,   104,   293,
+    -141,   104,  -141
+};
 
-  yyssp = yyss - 1;
-  yyvsp = yyvs;
-#ifdef YYLSP_NEEDED
-  yylsp = yyls;
-#endif
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+      67,    51,     0,    68,     0,    70,     0,     1,    81,    82,
+       2,     3,    21,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,    17,    18,    19,    87,    85,    83,
+      84,     0,     0,    86,    20,     0,    67,   104,    69,    88,
+      89,   104,    50,     0,    43,    47,    42,    46,    41,    45,
+      40,    44,     0,     0,     0,     0,     0,     0,    66,    82,
+      20,     0,    95,    97,     0,    96,     0,     0,    51,   104,
+     100,    51,    80,    99,    54,    55,    56,    57,    82,    20,
+       0,     0,     4,     5,    52,    53,     0,    92,    94,     0,
+      77,    91,     0,    79,    51,     0,     0,     0,     0,   101,
+     103,     0,     0,     0,     0,    20,    98,    72,    75,    76,
+       0,    90,   102,   106,    20,     0,     0,    48,    49,     0,
+       0,     0,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+       0,     0,     0,     0,     0,   112,   121,    20,     0,    63,
+       0,    93,    71,    73,     0,    78,   105,     0,   107,     0,
+      20,   119,    20,   122,   124,    20,    20,    20,     0,    59,
+      65,     0,     0,    74,     0,     0,   113,     0,     0,     0,
+       0,   126,   118,     0,     0,    58,     0,    62,     0,     0,
+     114,   116,     0,     0,     0,    61,     0,    64,     0,     0,
+     115,     0,   123,   125,   117,    60,     0,     0,   120,     0,
+       0,     0,   108,     0,   109,     0,     0,     0,     0,     0,
+     111,     0,   110
+};
 
-/* Push a new state, which is found in  yystate  .  */
-/* In all cases, when you get here, the value and location stacks
-   have just been pushed. so pushing a state here evens the stacks.  */
-yynewstate:
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+    -141,  -141,  -141,    -3,   333,  -141,  -141,   -95,   -92,  -106,
+     -49,    -5,  -140,   302,  -141,  -141,  -141,  -141,   187,  -141,
+    -141,  -141,  -141,  -135,   -98,   -44,  -141,   303,   274,   272,
+    -141,  -141,   177,  -141,  -141,  -141
+};
 
-  *++yyssp = yystate;
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
+{
+       0,    33,    84,    63,    61,   143,   144,    56,    57,   119,
+       6,   170,   171,     1,     2,     3,   153,   108,   109,   110,
+      36,    37,    38,    39,    40,    64,    41,    70,    71,    99,
+     211,   100,   161,   201,   145,   146
+};
 
-  if (yyssp >= yyss + yystacksize - 1)
-    {
-      /* Give user a chance to reallocate the stack */
-      /* Use copies of these so that the &'s don't force the real ones into memory. */
-      YYSTYPE *yyvs1 = yyvs;
-      short *yyss1 = yyss;
-#ifdef YYLSP_NEEDED
-      YYLTYPE *yyls1 = yyls;
-#endif
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
+{
+      34,    58,   117,    66,     7,   118,     8,     9,    10,    11,
+     172,    81,    87,   115,    69,   152,   156,   157,   158,    65,
+      72,   159,    98,    92,    42,    27,   116,    28,    60,    29,
+      30,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+       4,   102,    52,    53,   196,    98,    93,    67,    65,    76,
+      77,    79,    44,    45,    46,    47,    48,    49,    50,    51,
+      65,   -20,   176,    65,   178,   151,    85,   181,   182,   183,
+     185,   168,    65,    65,   186,   213,     8,     9,    65,   190,
+     217,   179,   -20,   105,    65,    54,   106,   107,    55,   205,
+     198,   199,   114,   186,   202,   203,   204,    28,   147,    29,
+      30,   210,   -20,    69,    65,   215,   214,     8,     9,    10,
+      11,   212,   117,    74,    75,   118,   117,   160,   162,   118,
+     220,     4,    86,   222,   180,   -20,    27,    65,    28,    67,
+      29,    30,    95,    96,    97,    82,    83,   163,   164,   165,
+     166,   167,    44,    45,    46,    47,    48,    49,    50,    51,
+      90,   107,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    17,    18,    19,    20,    21,    22,    23,    24,    25,
+      26,    27,   101,    28,     4,    29,    30,     5,    89,   103,
+     111,   197,    88,    89,   104,    89,   187,   186,   160,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,   148,
+      28,    31,    29,    30,    32,   154,   149,   184,    91,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+      19,    20,    21,    22,    23,    24,    25,    26,    27,   150,
+      28,   155,    29,    30,   -21,   174,   175,   177,    31,   188,
+     189,    32,    62,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,   191,    28,   192,    29,    30,    31,   193,
+     194,    32,    80,     8,    59,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,   206,    28,   207,    29,    30,   208,   209,
+     218,   216,    31,   219,   221,    32,     8,    78,    10,    11,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    35,    28,    68,    29,
+      30,   173,    31,    94,    73,    32,     8,     9,    10,    11,
+     113,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,   112,    28,   200,    29,
+      30,     0,     0,     0,     0,    31,     0,     0,    32,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,     0,     0,
+      52,    53,    43,    44,    45,    46,    47,    48,    49,    50,
+      51,     0,     0,    52,    53,    31,   120,   121,    32,     0,
+       0,   122,   123,   124,   125,   126,   127,   128,   129,   130,
+     131,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,     0,    54,   169,     0,    55,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    54,   195,     0,    55
+};
 
-      /* Get the current used size of the three stacks, in elements.  */
-      int size = yyssp - yyss + 1;
-
-#ifdef yyoverflow
-      /* Each stack pointer address is followed by the size of
-	 the data in use in that stack, in bytes.  */
-#ifdef YYLSP_NEEDED
-      /* This used to be a conditional around just the two extra args,
-	 but that might be undefined if yyoverflow is a macro.  */
-      yyoverflow("parser stack overflow",
-		 &yyss1, size * sizeof (*yyssp),
-		 &yyvs1, size * sizeof (*yyvsp),
-		 &yyls1, size * sizeof (*yylsp),
-		 &yystacksize);
-#else
-      yyoverflow("parser stack overflow",
-		 &yyss1, size * sizeof (*yyssp),
-		 &yyvs1, size * sizeof (*yyvsp),
-		 &yystacksize);
-#endif
+static const yytype_int16 yycheck[] =
+{
+       3,     6,    97,    24,     0,    97,     3,     4,     5,     6,
+     150,    55,    63,     8,    23,    22,   114,   115,   116,    70,
+      29,   119,    71,    67,    61,    22,    21,    24,    31,    26,
+      27,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      22,    63,    19,    20,   184,    94,    28,    68,    70,    24,
+      53,    54,     9,    10,    11,    12,    13,    14,    15,    16,
+      70,    68,   160,    70,   162,    63,     4,   165,   166,   167,
+      63,    63,    70,    70,    67,   210,     3,     4,    70,   177,
+     215,    67,    68,    86,    70,    62,    89,    90,    65,    63,
+     188,   189,    95,    67,   192,   193,   194,    24,   101,    26,
+      27,   207,    68,    23,    70,   211,    63,     3,     4,     5,
+       6,   209,   207,    26,    27,   207,   211,   120,   121,   211,
+     218,    22,    64,   221,    67,    68,    22,    70,    24,    68,
+      26,    27,    33,    34,    35,     3,     4,   140,   141,   142,
+     143,   144,     9,    10,    11,    12,    13,    14,    15,    16,
+      68,   154,     3,     4,     5,     6,     7,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    64,    24,    22,    26,    27,    25,    67,    65,
+      69,   186,    66,    67,    66,    67,    66,    67,   191,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    62,
+      24,    62,    26,    27,    65,    67,    66,    62,    69,     3,
+       4,     5,     6,     7,     8,     9,    10,    11,    12,    13,
+      14,    15,    16,    17,    18,    19,    20,    21,    22,    65,
+      24,    69,    26,    27,    68,    67,    67,    67,    62,    21,
+      21,    65,    66,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    68,    24,    14,    26,    27,    62,    14,
+      67,    65,    66,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,    13,    14,    15,    16,    17,    18,    19,
+      20,    21,    22,    67,    24,    62,    26,    27,    69,    21,
+      21,    67,    62,    67,    21,    65,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,     3,    24,    36,    26,
+      27,   154,    62,    69,    41,    65,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+      17,    18,    19,    20,    21,    22,    94,    24,   191,    26,
+      27,    -1,    -1,    -1,    -1,    62,    -1,    -1,    65,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    -1,    -1,
+      19,    20,     8,     9,    10,    11,    12,    13,    14,    15,
+      16,    -1,    -1,    19,    20,    62,    31,    32,    65,    -1,
+      -1,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    -1,    62,    63,    -1,    65,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    62,    63,    -1,    65
+};
 
-      yyss = yyss1; yyvs = yyvs1;
-#ifdef YYLSP_NEEDED
-      yyls = yyls1;
-#endif
-#else /* no yyoverflow */
-      /* Extend the stack our own way.  */
-      if (yystacksize >= YYMAXDEPTH)
-	{
-	  yyerror("parser stack overflow");
-	  if (yyfree_stacks)
-	    {
-	      free (yyss);
-	      free (yyvs);
-#ifdef YYLSP_NEEDED
-	      free (yyls);
-#endif
-	    }
-	  return 2;
-	}
-      yystacksize *= 2;
-      if (yystacksize > YYMAXDEPTH)
-	yystacksize = YYMAXDEPTH;
-#ifndef YYSTACK_USE_ALLOCA
-      yyfree_stacks = 1;
-#endif
-      yyss = (short *) YYSTACK_ALLOC (yystacksize * sizeof (*yyssp));
-      __yy_memcpy ((char *)yyss, (char *)yyss1,
-		   size * (unsigned int) sizeof (*yyssp));
-      yyvs = (YYSTYPE *) YYSTACK_ALLOC (yystacksize * sizeof (*yyvsp));
-      __yy_memcpy ((char *)yyvs, (char *)yyvs1,
-		   size * (unsigned int) sizeof (*yyvsp));
-#ifdef YYLSP_NEEDED
-      yyls = (YYLTYPE *) YYSTACK_ALLOC (yystacksize * sizeof (*yylsp));
-      __yy_memcpy ((char *)yyls, (char *)yyls1,
-		   size * (unsigned int) sizeof (*yylsp));
-#endif
-#endif /* no yyoverflow */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,    84,    85,    86,    22,    25,    81,     0,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    24,    26,
+      27,    62,    65,    72,    74,    75,    91,    92,    93,    94,
+      95,    97,    61,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    19,    20,    62,    65,    78,    79,    82,     4,
+      74,    75,    66,    74,    96,    70,    24,    68,    84,    23,
+      98,    99,    29,    98,    26,    27,    24,    74,     4,    74,
+      66,    96,     3,     4,    73,     4,    64,    63,    66,    67,
+      68,    69,    96,    28,    99,    33,    34,    35,    81,   100,
+     102,    64,    63,    65,    66,    74,    74,    74,    88,    89,
+      90,    69,   100,     7,    74,     8,    21,    78,    79,    80,
+      31,    32,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    76,    77,   105,   106,    74,    62,    66,
+      65,    63,    22,    87,    67,    69,    95,    95,    95,    95,
+      74,   103,    74,    74,    74,    74,    74,    74,    63,    63,
+      82,    83,    83,    89,    67,    67,    95,    67,    95,    67,
+      67,    95,    95,    95,    62,    63,    67,    66,    21,    21,
+      95,    68,    14,    14,    67,    63,    83,    82,    95,    95,
+     103,   104,    95,    95,    95,    63,    67,    62,    69,    21,
+      80,   101,    95,    94,    63,    80,    67,    94,    21,    67,
+      95,    21,    95
+};
 
-      yyssp = yyss + size - 1;
-      yyvsp = yyvs + size - 1;
-#ifdef YYLSP_NEEDED
-      yylsp = yyls + size - 1;
-#endif
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    71,    72,    72,    73,    73,    74,    74,    74,    74,
+      74,    74,    74,    74,    74,    74,    74,    74,    74,    74,
+      75,    75,    76,    76,    76,    76,    77,    77,    77,    77,
+      77,    77,    77,    77,    77,    77,    77,    77,    77,    77,
+      78,    78,    78,    78,    79,    79,    79,    79,    80,    80,
+      81,    81,    82,    82,    82,    82,    82,    82,    82,    82,
+      82,    82,    82,    82,    83,    83,    84,    84,    85,    86,
+      86,    87,    87,    88,    89,    89,    90,    90,    91,    92,
+      93,    94,    94,    94,    94,    94,    95,    95,    95,    74,
+      74,    74,    74,    74,    74,    74,    74,    96,    96,    97,
+      97,    98,    98,    99,    99,   100,   100,   100,   100,   100,
+     101,   101,   102,   103,   103,   104,   104,   105,   105,   105,
+     105,   105,   106,   106,   106,   106,   106
+};
 
-#if YYDEBUG != 0
-      if (yydebug)
-	fprintf(stderr, "Stack size increased to %d\n", yystacksize);
-#endif
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       2,     0,     2,     2,     2,     2,     2,     2,     6,     5,
+       8,     7,     6,     4,     3,     1,     3,     0,     1,     2,
+       2,     1,     0,     2,     3,     1,     1,     0,     5,     3,
+       2,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       4,     3,     3,     5,     3,     2,     2,     1,     3,     2,
+       2,     2,     3,     2,     0,     3,     2,     3,     9,     9,
+       6,     5,     2,     2,     3,     1,     0,     5,     3,     2,
+       6,     1,     2,     5,     2,     5,     3
+};
 
-      if (yyssp >= yyss + yystacksize - 1)
-	YYABORT;
-    }
 
-#if YYDEBUG != 0
-  if (yydebug)
-    fprintf(stderr, "Entering state %d\n", yystate);
-#endif
+enum { YYENOMEM = -2 };
 
-  goto yybackup;
- yybackup:
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
-/* Do appropriate processing given the current state.  */
-/* Read a lookahead token if we need one and don't already have one.  */
-/* yyresume: */
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-  /* First try to decide what to do without reference to lookahead token.  */
 
-  yyn = yypact[yystate];
-  if (yyn == YYFLAG)
-    goto yydefault;
+#define YYRECOVERING()  (!!yyerrstatus)
 
-  /* Not known => get a lookahead token if don't already have one.  */
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
-  /* yychar is either YYEMPTY or YYEOF
-     or a valid token in external form.  */
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
 
-  if (yychar == YYEMPTY)
-    {
-#if YYDEBUG != 0
-      if (yydebug)
-	fprintf(stderr, "Reading a token: ");
-#endif
-      yychar = YYLEX;
-    }
 
-  /* Convert token to internal form (in yychar1) for indexing tables with */
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-  if (yychar <= 0)		/* This means end of input. */
-    {
-      yychar1 = 0;
-      yychar = YYEOF;		/* Don't call YYLEX any more */
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-#if YYDEBUG != 0
-      if (yydebug)
-	fprintf(stderr, "Now at end of input.\n");
-#endif
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
     }
-  else
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
     {
-      yychar1 = YYTRANSLATE(yychar);
-
-#if YYDEBUG != 0
-      if (yydebug)
-	{
-	  fprintf (stderr, "Next token is %d (%s", yychar, yytname[yychar1]);
-	  /* Give the individual parser a way to print the precise meaning
-	     of a token, for further debugging info.  */
-#ifdef YYPRINT
-	  YYPRINT (stderr, yychar, yylval);
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
 #endif
-	  fprintf (stderr, ")\n");
-	}
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
 #endif
-    }
 
-  yyn += yychar1;
-  if (yyn < 0 || yyn > YYLAST || yycheck[yyn] != yychar1)
-    goto yydefault;
 
-  yyn = yytable[yyn];
 
-  /* yyn is what to do for this token type in this state.
-     Negative => reduce, -yyn is rule number.
-     Positive => shift, yyn is new state.
-       New state is final state => don't bother to shift,
-       just return success.
-     0, or most negative number => error.  */
 
-  if (yyn < 0)
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+/* Lookahead token kind.  */
+int yychar;
+
+
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
+
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
+
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
-      if (yyn == YYFLAG)
-	goto yyerrlab;
-      yyn = -yyn;
-      goto yyreduce;
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
     }
-  else if (yyn == 0)
-    goto yyerrlab;
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
 
-  if (yyn == YYFINAL)
+  if (yystate == YYFINAL)
     YYACCEPT;
 
-  /* Shift the lookahead token.  */
+  goto yybackup;
 
-#if YYDEBUG != 0
-  if (yydebug)
-    fprintf(stderr, "Shifting token %d (%s), ", yychar, yytname[yychar1]);
-#endif
 
-  /* Discard the token being shifted unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
 
-  *++yyvsp = yylval;
-#ifdef YYLSP_NEEDED
-  *++yylsp = yylloc;
-#endif
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval);
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
 
-  /* count tokens shifted since error; after three, turn off error status.  */
-  if (yyerrstatus) yyerrstatus--;
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
 
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
-/* Do the default action for the current state.  */
-yydefault:
 
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
   yyn = yydefact[yystate];
   if (yyn == 0)
     goto yyerrlab;
+  goto yyreduce;
+
 
-/* Do a reduction.  yyn is the number of a rule to reduce with.  */
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
 yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
-  if (yylen > 0)
-    yyval = yyvsp[1-yylen]; /* implement default value of the action */
-
-#if YYDEBUG != 0
-  if (yydebug)
-    {
-      int i;
-
-      fprintf (stderr, "Reducing via rule %d (line %d), ",
-	       yyn, yyrline[yyn]);
 
-      /* Print the symbols being reduced, and their result.  */
-      for (i = yyprhs[yyn]; yyrhs[i] > 0; i++)
-	fprintf (stderr, "%s ", yytname[yyrhs[i]]);
-      fprintf (stderr, " -> %s\n", yytname[yyr1[yyn]]);
-    }
-#endif
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
 
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
 
-  switch (yyn) {
 
-case 2:
-#line 434 "llvmAsmParser.y"
-{
-  if (yyvsp[0].UIntVal > (uint32_t)INT32_MAX)     // Outside of my range!
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 3: /* INTVAL: UINTVAL  */
+#line 812 "llvmAsmParser.y"
+                 {
+  if ((yyvsp[0].UIntVal) > (uint32_t)INT32_MAX)     // Outside of my range!
     ThrowException("Value too large for type!");
-  yyval.SIntVal = (int32_t)yyvsp[0].UIntVal;
-;
-    break;}
-case 4:
-#line 442 "llvmAsmParser.y"
-{
-  if (yyvsp[0].UInt64Val > (uint64_t)INT64_MAX)     // Outside of my range!
+  (yyval.SIntVal) = (int32_t)(yyvsp[0].UIntVal);
+}
+#line 2084 "llvmAsmParser.cpp"
+    break;
+
+  case 5: /* EINT64VAL: EUINT64VAL  */
+#line 820 "llvmAsmParser.y"
+                       {
+  if ((yyvsp[0].UInt64Val) > (uint64_t)INT64_MAX)     // Outside of my range!
     ThrowException("Value too large for type!");
-  yyval.SInt64Val = (int64_t)yyvsp[0].UInt64Val;
-;
-    break;}
-case 46:
-#line 472 "llvmAsmParser.y"
-{
-    yyval.StrVal = yyvsp[-1].StrVal;
-  ;
-    break;}
-case 47:
-#line 475 "llvmAsmParser.y"
-{ 
-    yyval.StrVal = 0; 
-  ;
-    break;}
-case 48:
-#line 479 "llvmAsmParser.y"
-{     // integral constants
-    if (!ConstPoolSInt::isValueValidForType(yyvsp[-1].TypeVal, yyvsp[0].SInt64Val))
+  (yyval.SInt64Val) = (int64_t)(yyvsp[0].UInt64Val);
+}
+#line 2094 "llvmAsmParser.cpp"
+    break;
+
+  case 50: /* OptAssign: VAR_ID '='  */
+#line 850 "llvmAsmParser.y"
+                       {
+    (yyval.StrVal) = (yyvsp[-1].StrVal);
+  }
+#line 2102 "llvmAsmParser.cpp"
+    break;
+
+  case 51: /* OptAssign: %empty  */
+#line 853 "llvmAsmParser.y"
+              { 
+    (yyval.StrVal) = StrSlice::create(0, 0); 
+  }
+#line 2110 "llvmAsmParser.cpp"
+    break;
+
+  case 52: /* ConstVal: SIntType EINT64VAL  */
+#line 857 "llvmAsmParser.y"
+                              {     // integral constants
+    if (!ConstPoolSInt::isValueValidForType((yyvsp[-1].TypeVal), (yyvsp[0].SInt64Val)))
       ThrowException("Constant value doesn't fit in type!");
-    yyval.ConstVal = new ConstPoolSInt(yyvsp[-1].TypeVal, yyvsp[0].SInt64Val);
-  ;
-    break;}
-case 49:
-#line 484 "llvmAsmParser.y"
-{           // integral constants
-    if (!ConstPoolUInt::isValueValidForType(yyvsp[-1].TypeVal, yyvsp[0].UInt64Val))
+    (yyval.ConstVal) = new ConstPoolSInt((yyvsp[-1].TypeVal), (yyvsp[0].SInt64Val));
+  }
+#line 2120 "llvmAsmParser.cpp"
+    break;
+
+  case 53: /* ConstVal: UIntType EUINT64VAL  */
+#line 862 "llvmAsmParser.y"
+                        {           // integral constants
+    if (!ConstPoolUInt::isValueValidForType((yyvsp[-1].TypeVal), (yyvsp[0].UInt64Val)))
       ThrowException("Constant value doesn't fit in type!");
-    yyval.ConstVal = new ConstPoolUInt(yyvsp[-1].TypeVal, yyvsp[0].UInt64Val);
-  ;
-    break;}
-case 50:
-#line 489 "llvmAsmParser.y"
-{                     // Boolean constants
-    yyval.ConstVal = new ConstPoolBool(true);
-  ;
-    break;}
-case 51:
-#line 492 "llvmAsmParser.y"
-{                    // Boolean constants
-    yyval.ConstVal = new ConstPoolBool(false);
-  ;
-    break;}
-case 52:
-#line 495 "llvmAsmParser.y"
-{         // String constants
+    (yyval.ConstVal) = new ConstPoolUInt((yyvsp[-1].TypeVal), (yyvsp[0].UInt64Val));
+  }
+#line 2130 "llvmAsmParser.cpp"
+    break;
+
+  case 54: /* ConstVal: BOOL TRUE  */
+#line 867 "llvmAsmParser.y"
+              {                     // Boolean constants
+    (yyval.ConstVal) = new ConstPoolBool(true);
+  }
+#line 2138 "llvmAsmParser.cpp"
+    break;
+
+  case 55: /* ConstVal: BOOL FALSE  */
+#line 870 "llvmAsmParser.y"
+               {                    // Boolean constants
+    (yyval.ConstVal) = new ConstPoolBool(false);
+  }
+#line 2146 "llvmAsmParser.cpp"
+    break;
+
+  case 56: /* ConstVal: STRING STRINGCONSTANT  */
+#line 873 "llvmAsmParser.y"
+                          {         // String constants
     cerr << "FIXME: TODO: String constants [sbyte] not implemented yet!\n";
     abort();
-    //$$ = new ConstPoolString($2);
-    free(yyvsp[0].StrVal);
-  ;
-    break;}
-case 53:
-#line 501 "llvmAsmParser.y"
-{                    // Type constants
-    yyval.ConstVal = new ConstPoolType(yyvsp[0].TypeVal);
-  ;
-    break;}
-case 54:
-#line 504 "llvmAsmParser.y"
-{      // Nonempty array constant
+    //$$ = new ConstPoolString($2.str());
+  }
+#line 2156 "llvmAsmParser.cpp"
+    break;
+
+  case 57: /* ConstVal: TYPE Types  */
+#line 878 "llvmAsmParser.y"
+               {                    // Type constants
+    (yyval.ConstVal) = new ConstPoolType((yyvsp[0].TypeVal));
+  }
+#line 2164 "llvmAsmParser.cpp"
+    break;
+
+  case 58: /* ConstVal: '[' Types ']' '[' ConstVector ']'  */
+#line 881 "llvmAsmParser.y"
+                                      {      // Nonempty array constant
     // Verify all elements are correct type!
-    const ArrayType *AT = ArrayType::getArrayType(yyvsp[-4].TypeVal);
-    for (unsigned i = 0; i < yyvsp[-1].ConstVector->size(); i++) {
-      if (yyvsp[-4].TypeVal != (*yyvsp[-1].ConstVector)[i]->getType())
+    const ArrayType *AT = ArrayType::getArrayType((yyvsp[-4].TypeVal));
+    for (unsigned i = 0; i < (yyvsp[-1].ConstVector)->size(); i++) {
+      if ((yyvsp[-4].TypeVal) != (*(yyvsp[-1].ConstVector))[i]->getType())
 	ThrowException("Element #" + utostr(i) + " is not of type '" + 
-		       yyvsp[-4].TypeVal->getName() + "' as required!\nIt is of type '" +
-		       (*yyvsp[-1].ConstVector)[i]->getType()->getName() + "'.");
+		       (yyvsp[-4].TypeVal)->getName() + "' as required!\nIt is of type '" +
+		       (*(yyvsp[-1].ConstVector))[i]->getType()->getName() + "'.");
     }
 
-    yyval.ConstVal = new ConstPoolArray(AT, *yyvsp[-1].ConstVector);
-    delete yyvsp[-1].ConstVector;
-  ;
-    break;}
-case 55:
-#line 517 "llvmAsmParser.y"
-{                  // Empty array constant
+    (yyval.ConstVal) = new ConstPoolArray(AT, *(yyvsp[-1].ConstVector));
+    delete (yyvsp[-1].ConstVector);
+  }
+#line 2182 "llvmAsmParser.cpp"
+    break;
+
+  case 59: /* ConstVal: '[' Types ']' '[' ']'  */
+#line 894 "llvmAsmParser.y"
+                          {                  // Empty array constant
     vector<ConstPoolVal*> Empty;
-    yyval.ConstVal = new ConstPoolArray(ArrayType::getArrayType(yyvsp[-3].TypeVal), Empty);
-  ;
-    break;}
-case 56:
-#line 521 "llvmAsmParser.y"
-{
+    (yyval.ConstVal) = new ConstPoolArray(ArrayType::getArrayType((yyvsp[-3].TypeVal)), Empty);
+  }
+#line 2191 "llvmAsmParser.cpp"
+    break;
+
+  case 60: /* ConstVal: '[' EUINT64VAL 'x' Types ']' '[' ConstVector ']'  */
+#line 898 "llvmAsmParser.y"
+                                                     {
     // Verify all elements are correct type!
-    const ArrayType *AT = ArrayType::getArrayType(yyvsp[-4].TypeVal, (int)yyvsp[-6].UInt64Val);
-    if (yyvsp[-6].UInt64Val != yyvsp[-1].ConstVector->size())
+    const ArrayType *AT = ArrayType::getArrayType((yyvsp[-4].TypeVal), (int)(yyvsp[-6].UInt64Val));
+    if ((yyvsp[-6].UInt64Val) != (yyvsp[-1].ConstVector)->size())
       ThrowException("Type mismatch: constant sized array initialized with " +
-		     utostr(yyvsp[-1].ConstVector->size()) +  " arguments, but has size of " + 
-		     itostr((int)yyvsp[-6].UInt64Val) + "!");
+		     utostr((yyvsp[-1].ConstVector)->size()) +  " arguments, but has size of " + 
+		     itostr((int)(yyvsp[-6].UInt64Val)) + "!");
 
-    for (unsigned i = 0; i < yyvsp[-1].ConstVector->size(); i++) {
-      if (yyvsp[-4].TypeVal != (*yyvsp[-1].ConstVector)[i]->getType())
+    for (unsigned i = 0; i < (yyvsp[-1].ConstVector)->size(); i++) {
+      if ((yyvsp[-4].TypeVal) != (*(yyvsp[-1].ConstVector))[i]->getType())
 	ThrowException("Element #" + utostr(i) + " is not of type '" + 
-		       yyvsp[-4].TypeVal->getName() + "' as required!\nIt is of type '" +
-		       (*yyvsp[-1].ConstVector)[i]->getType()->getName() + "'.");
+		       (yyvsp[-4].TypeVal)->getName() + "' as required!\nIt is of type '" +
+		       (*(yyvsp[-1].ConstVector))[i]->getType()->getName() + "'.");
     }
 
-    yyval.ConstVal = new ConstPoolArray(AT, *yyvsp[-1].ConstVector);
-    delete yyvsp[-1].ConstVector;
-  ;
-    break;}
-case 57:
-#line 539 "llvmAsmParser.y"
-{
-    if (yyvsp[-5].UInt64Val != 0) 
+    (yyval.ConstVal) = new ConstPoolArray(AT, *(yyvsp[-1].ConstVector));
+    delete (yyvsp[-1].ConstVector);
+  }
+#line 2214 "llvmAsmParser.cpp"
+    break;
+
+  case 61: /* ConstVal: '[' EUINT64VAL 'x' Types ']' '[' ']'  */
+#line 916 "llvmAsmParser.y"
+                                         {
+    if ((yyvsp[-5].UInt64Val) != 0) 
       ThrowException("Type mismatch: constant sized array initialized with 0"
-		     " arguments, but has size of " + itostr((int)yyvsp[-5].UInt64Val) + "!");
+		     " arguments, but has size of " + itostr((int)(yyvsp[-5].UInt64Val)) + "!");
     vector<ConstPoolVal*> Empty;
-    yyval.ConstVal = new ConstPoolArray(ArrayType::getArrayType(yyvsp[-3].TypeVal, 0), Empty);
-  ;
-    break;}
-case 58:
-#line 546 "llvmAsmParser.y"
-{
-    StructType::ElementTypes Types(yyvsp[-4].TypeList->begin(), yyvsp[-4].TypeList->end());
-    delete yyvsp[-4].TypeList;
+    (yyval.ConstVal) = new ConstPoolArray(ArrayType::getArrayType((yyvsp[-3].TypeVal), 0), Empty);
+  }
+#line 2226 "llvmAsmParser.cpp"
+    break;
+
+  case 62: /* ConstVal: '{' TypeList '}' '{' ConstVector '}'  */
+#line 923 "llvmAsmParser.y"
+                                         {
+    StructType::ElementTypes Types((yyvsp[-4].TypeList)->begin(), (yyvsp[-4].TypeList)->end());
+    delete (yyvsp[-4].TypeList);
 
     const StructType *St = StructType::getStructType(Types);
-    yyval.ConstVal = new ConstPoolStruct(St, *yyvsp[-1].ConstVector);
-    delete yyvsp[-1].ConstVector;
-  ;
-    break;}
-case 59:
-#line 554 "llvmAsmParser.y"
-{
+    (yyval.ConstVal) = new ConstPoolStruct(St, *(yyvsp[-1].ConstVector));
+    delete (yyvsp[-1].ConstVector);
+  }
+#line 2239 "llvmAsmParser.cpp"
+    break;
+
+  case 63: /* ConstVal: '{' '}' '{' '}'  */
+#line 931 "llvmAsmParser.y"
+                    {
     const StructType *St = 
       StructType::getStructType(StructType::ElementTypes());
     vector<ConstPoolVal*> Empty;
-    yyval.ConstVal = new ConstPoolStruct(St, Empty);
-  ;
-    break;}
-case 60:
-#line 568 "llvmAsmParser.y"
-{
-    (yyval.ConstVector = yyvsp[-2].ConstVector)->push_back(addConstValToConstantPool(yyvsp[0].ConstVal));
-  ;
-    break;}
-case 61:
-#line 571 "llvmAsmParser.y"
-{
-    yyval.ConstVector = new vector<ConstPoolVal*>();
-    yyval.ConstVector->push_back(addConstValToConstantPool(yyvsp[0].ConstVal));
-  ;
-    break;}
-case 62:
-#line 577 "llvmAsmParser.y"
-{ 
-    if (yyvsp[-1].StrVal) {
-      yyvsp[0].ConstVal->setName(yyvsp[-1].StrVal);
-      free(yyvsp[-1].StrVal);
-    }
+    (yyval.ConstVal) = new ConstPoolStruct(St, Empty);
+  }
+#line 2250 "llvmAsmParser.cpp"
+    break;
 
-    addConstValToConstantPool(yyvsp[0].ConstVal);
-  ;
-    break;}
-case 63:
-#line 585 "llvmAsmParser.y"
-{ 
-  ;
-    break;}
-case 64:
-#line 596 "llvmAsmParser.y"
-{
-  yyval.ModuleVal = ParserResult = yyvsp[0].ModuleVal;
-  CurModule.ModuleDone();
-;
-    break;}
-case 65:
-#line 601 "llvmAsmParser.y"
-{
-    yyvsp[-1].ModuleVal->getMethodList().push_back(yyvsp[0].MethodVal);
-    CurMeth.MethodDone();
-    yyval.ModuleVal = yyvsp[-1].ModuleVal;
-  ;
-    break;}
-case 66:
-#line 606 "llvmAsmParser.y"
-{
-    yyval.ModuleVal = CurModule.CurrentModule;
-  ;
-    break;}
-case 68:
-#line 615 "llvmAsmParser.y"
-{ yyval.StrVal = 0; ;
-    break;}
-case 69:
-#line 617 "llvmAsmParser.y"
-{
-  yyval.MethArgVal = new MethodArgument(yyvsp[-1].TypeVal);
-  if (yyvsp[0].StrVal) {      // Was the argument named?
-    yyval.MethArgVal->setName(yyvsp[0].StrVal); 
-    free(yyvsp[0].StrVal);    // The string was strdup'd, so free it now.
-  }
-;
-    break;}
-case 70:
-#line 625 "llvmAsmParser.y"
-{
-    yyval.MethodArgList = yyvsp[0].MethodArgList;
-    yyvsp[0].MethodArgList->push_front(yyvsp[-2].MethArgVal);
-  ;
-    break;}
-case 71:
-#line 629 "llvmAsmParser.y"
-{
-    yyval.MethodArgList = new list<MethodArgument*>();
-    yyval.MethodArgList->push_front(yyvsp[0].MethArgVal);
-  ;
-    break;}
-case 72:
-#line 634 "llvmAsmParser.y"
-{
-    yyval.MethodArgList = yyvsp[0].MethodArgList;
-  ;
-    break;}
-case 73:
-#line 637 "llvmAsmParser.y"
-{
-    yyval.MethodArgList = 0;
-  ;
-    break;}
-case 74:
-#line 641 "llvmAsmParser.y"
-{
+  case 64: /* ConstVector: ConstVector ',' ConstVal  */
+#line 945 "llvmAsmParser.y"
+                                       {
+    ((yyval.ConstVector) = (yyvsp[-2].ConstVector))->push_back(addConstValToConstantPool((yyvsp[0].ConstVal)));
+  }
+#line 2258 "llvmAsmParser.cpp"
+    break;
+
+  case 65: /* ConstVector: ConstVal  */
+#line 948 "llvmAsmParser.y"
+             {
+    (yyval.ConstVector) = new vector<ConstPoolVal*>();
+    (yyval.ConstVector)->push_back(addConstValToConstantPool((yyvsp[0].ConstVal)));
+  }
+#line 2267 "llvmAsmParser.cpp"
+    break;
+
+  case 66: /* ConstPool: ConstPool OptAssign ConstVal  */
+#line 954 "llvmAsmParser.y"
+                                         { 
+    if (!(yyvsp[-1].StrVal).empty())
+      (yyvsp[0].ConstVal)->setName((yyvsp[-1].StrVal).str());
+
+    ConstPoolVal *C = addConstValToConstantPool((yyvsp[0].ConstVal));
+    if (!(yyvsp[-1].StrVal).empty())
+      InsertName(C, (yyvsp[-1].StrVal), CurMeth->CurrentMethod ? (ValueTables&)*CurMeth 
+                                              : *CurModule);
+  }
+#line 2281 "llvmAsmParser.cpp"
+    break;
+
+  case 67: /* ConstPool: %empty  */
+#line 963 "llvmAsmParser.y"
+                             { 
+  }
+#line 2288 "llvmAsmParser.cpp"
+    break;
+
+  case 68: /* Module: MethodList  */
+#line 974 "llvmAsmParser.y"
+                    {
+  (yyval.ModuleVal) = ParserResult = (yyvsp[0].ModuleVal);
+  CurModule->ModuleDone();
+}
+#line 2297 "llvmAsmParser.cpp"
+    break;
+
+  case 69: /* MethodList: MethodList Method  */
+#line 979 "llvmAsmParser.y"
+                               {
+    (yyvsp[-1].ModuleVal)->getMethodList().push_back((yyvsp[0].MethodVal));
+    CurMeth->MethodDone();
+    (yyval.ModuleVal) = (yyvsp[-1].ModuleVal);
+  }
+#line 2307 "llvmAsmParser.cpp"
+    break;
+
+  case 70: /* MethodList: ConstPool IMPLEMENTATION  */
+#line 984 "llvmAsmParser.y"
+                             {
+    (yyval.ModuleVal) = CurModule->CurrentModule;
+  }
+#line 2315 "llvmAsmParser.cpp"
+    break;
+
+  case 72: /* OptVAR_ID: %empty  */
+#line 993 "llvmAsmParser.y"
+                               { (yyval.StrVal) = StrSlice::create(0, 0); }
+#line 2321 "llvmAsmParser.cpp"
+    break;
+
+  case 73: /* ArgVal: Types OptVAR_ID  */
+#line 995 "llvmAsmParser.y"
+                         {
+  (yyval.MethArgVal) = new MethodArgument((yyvsp[-1].TypeVal));
+  if (!(yyvsp[0].StrVal).empty()) {    // Was the argument named?
+    (yyval.MethArgVal)->setName((yyvsp[0].StrVal).str());
+    InsertName((yyval.MethArgVal), (yyvsp[0].StrVal));  // Arguments are in the scope of the new method
+  }
+}
+#line 2333 "llvmAsmParser.cpp"
+    break;
+
+  case 74: /* ArgListH: ArgVal ',' ArgListH  */
+#line 1003 "llvmAsmParser.y"
+                               {
+    (yyval.MethodArgList) = (yyvsp[0].MethodArgList);
+    (yyvsp[0].MethodArgList)->push_front((yyvsp[-2].MethArgVal));
+  }
+#line 2342 "llvmAsmParser.cpp"
+    break;
+
+  case 75: /* ArgListH: ArgVal  */
+#line 1007 "llvmAsmParser.y"
+           {
+    (yyval.MethodArgList) = new list<MethodArgument*>();
+    (yyval.MethodArgList)->push_front((yyvsp[0].MethArgVal));
+  }
+#line 2351 "llvmAsmParser.cpp"
+    break;
+
+  case 76: /* ArgList: ArgListH  */
+#line 1012 "llvmAsmParser.y"
+                   {
+    (yyval.MethodArgList) = (yyvsp[0].MethodArgList);
+  }
+#line 2359 "llvmAsmParser.cpp"
+    break;
+
+  case 77: /* ArgList: %empty  */
+#line 1015 "llvmAsmParser.y"
+                {
+    (yyval.MethodArgList) = 0;
+  }
+#line 2367 "llvmAsmParser.cpp"
+    break;
+
+  case 78: /* MethodHeaderH: TypesV STRINGCONSTANT '(' ArgList ')'  */
+#line 1019 "llvmAsmParser.y"
+                                                      {
   MethodType::ParamTypes ParamTypeList;
-  if (yyvsp[-1].MethodArgList)
-    for (list<MethodArgument*>::iterator I = yyvsp[-1].MethodArgList->begin(); I != yyvsp[-1].MethodArgList->end(); I++)
+  if ((yyvsp[-1].MethodArgList))
+    for (list<MethodArgument*>::iterator I = (yyvsp[-1].MethodArgList)->begin(); I != (yyvsp[-1].MethodArgList)->end(); I++)
       ParamTypeList.push_back((*I)->getType());
 
-  const MethodType *MT = MethodType::getMethodType(yyvsp[-4].TypeVal, ParamTypeList);
+  const MethodType *MT = MethodType::getMethodType((yyvsp[-4].TypeVal), ParamTypeList);
 
-  Method *M = new Method(MT, yyvsp[-3].StrVal);
-  free(yyvsp[-3].StrVal);  // Free strdup'd memory!
+  Method *M = new Method(MT, (yyvsp[-3].StrVal).str());
 
-  InsertValue(M, CurModule.Values);
+  InsertName(M, (yyvsp[-3].StrVal), *CurModule);
 
-  CurMeth.MethodStart(M);
+  CurMeth->MethodStart(M);
 
   // Add all of the arguments we parsed to the method...
-  if (yyvsp[-1].MethodArgList) {        // Is null if empty...
+  if ((yyvsp[-1].MethodArgList)) {        // Is null if empty...
     Method::ArgumentListType &ArgList = M->getArgumentList();
 
-    for (list<MethodArgument*>::iterator I = yyvsp[-1].MethodArgList->begin(); I != yyvsp[-1].MethodArgList->end(); I++) {
+    for (list<MethodArgument*>::iterator I = (yyvsp[-1].MethodArgList)->begin(); I != (yyvsp[-1].MethodArgList)->end(); I++) {
       InsertValue(*I);
       ArgList.push_back(*I);
     }
-    delete yyvsp[-1].MethodArgList;                     // We're now done with the argument list
+    delete (yyvsp[-1].MethodArgList);                     // We're now done with the argument list
   }
-;
-    break;}
-case 75:
-#line 668 "llvmAsmParser.y"
-{
-  yyval.MethodVal = CurMeth.CurrentMethod;
-;
-    break;}
-case 76:
-#line 672 "llvmAsmParser.y"
-{
-  yyval.MethodVal = yyvsp[-1].MethodVal;
-;
-    break;}
-case 77:
-#line 681 "llvmAsmParser.y"
-{    // A reference to a direct constant
-    yyval.ValIDVal = ValID::create(yyvsp[0].SInt64Val);
-  ;
-    break;}
-case 78:
-#line 684 "llvmAsmParser.y"
-{
-    yyval.ValIDVal = ValID::create(yyvsp[0].UInt64Val);
-  ;
-    break;}
-case 79:
-#line 687 "llvmAsmParser.y"
-{
-    yyval.ValIDVal = ValID::create((int64_t)1);
-  ;
-    break;}
-case 80:
-#line 690 "llvmAsmParser.y"
-{
-    yyval.ValIDVal = ValID::create((int64_t)0);
-  ;
-    break;}
-case 81:
-#line 693 "llvmAsmParser.y"
-{        // Quoted strings work too... especially for methods
-    yyval.ValIDVal = ValID::create_conststr(yyvsp[0].StrVal);
-  ;
-    break;}
-case 82:
-#line 698 "llvmAsmParser.y"
-{           // Is it an integer reference...?
-    yyval.ValIDVal = ValID::create(yyvsp[0].SIntVal);
-  ;
-    break;}
-case 83:
-#line 701 "llvmAsmParser.y"
-{                // It must be a named reference then...
-    yyval.ValIDVal = ValID::create(yyvsp[0].StrVal);
-  ;
-    break;}
-case 84:
-#line 704 "llvmAsmParser.y"
-{
-    yyval.ValIDVal = yyvsp[0].ValIDVal;
-  ;
-    break;}
-case 85:
-#line 711 "llvmAsmParser.y"
-{
-    Value *D = getVal(Type::TypeTy, yyvsp[0].ValIDVal, true);
-    if (D == 0) ThrowException("Invalid user defined type: " + yyvsp[0].ValIDVal.getName());
+}
+#line 2397 "llvmAsmParser.cpp"
+    break;
+
+  case 79: /* MethodHeader: MethodHeaderH ConstPool BEGINTOK  */
+#line 1045 "llvmAsmParser.y"
+                                                {
+  (yyval.MethodVal) = CurMeth->CurrentMethod;
+}
+#line 2405 "llvmAsmParser.cpp"
+    break;
+
+  case 80: /* Method: BasicBlockList END  */
+#line 1049 "llvmAsmParser.y"
+                            {
+  (yyval.MethodVal) = (yyvsp[-1].MethodVal);
+}
+#line 2413 "llvmAsmParser.cpp"
+    break;
+
+  case 81: /* ConstValueRef: ESINT64VAL  */
+#line 1058 "llvmAsmParser.y"
+                           {    // A reference to a direct constant
+    (yyval.ValIDVal) = ValID::create((yyvsp[0].SInt64Val));
+  }
+#line 2421 "llvmAsmParser.cpp"
+    break;
+
+  case 82: /* ConstValueRef: EUINT64VAL  */
+#line 1061 "llvmAsmParser.y"
+               {
+    (yyval.ValIDVal) = ValID::create((yyvsp[0].UInt64Val));
+  }
+#line 2429 "llvmAsmParser.cpp"
+    break;
+
+  case 83: /* ConstValueRef: TRUE  */
+#line 1064 "llvmAsmParser.y"
+         {
+    (yyval.ValIDVal) = ValID::create((int64_t)1);
+  }
+#line 2437 "llvmAsmParser.cpp"
+    break;
+
+  case 84: /* ConstValueRef: FALSE  */
+#line 1067 "llvmAsmParser.y"
+          {
+    (yyval.ValIDVal) = ValID::create((int64_t)0);
+  }
+#line 2445 "llvmAsmParser.cpp"
+    break;
+
+  case 85: /* ConstValueRef: STRINGCONSTANT  */
+#line 1070 "llvmAsmParser.y"
+                   {        // Quoted strings work too... especially for methods
+    (yyval.ValIDVal) = ValID::create_conststr((yyvsp[0].StrVal));
+  }
+#line 2453 "llvmAsmParser.cpp"
+    break;
+
+  case 86: /* ValueRef: INTVAL  */
+#line 1075 "llvmAsmParser.y"
+                  {           // Is it an integer reference...?
+    (yyval.ValIDVal) = ValID::create((yyvsp[0].SIntVal));
+  }
+#line 2461 "llvmAsmParser.cpp"
+    break;
+
+  case 87: /* ValueRef: VAR_ID  */
+#line 1078 "llvmAsmParser.y"
+           {                // It must be a named reference then...
+    (yyval.ValIDVal) = ValID::create((yyvsp[0].StrVal));
+  }
+#line 2469 "llvmAsmParser.cpp"
+    break;
+
+  case 88: /* ValueRef: ConstValueRef  */
+#line 1081 "llvmAsmParser.y"
+                  {
+    (yyval.ValIDVal) = (yyvsp[0].ValIDVal);
+  }
+#line 2477 "llvmAsmParser.cpp"
+    break;
+
+  case 89: /* Types: ValueRef  */
+#line 1088 "llvmAsmParser.y"
+                 {
+    Value *D = getVal(Type::TypeTy, (yyvsp[0].ValIDVal), true);
+    if (D == 0) ThrowException("Invalid user defined type: " + (yyvsp[0].ValIDVal).getName());
     assert (D->getValueType() == Value::ConstantVal &&
             "Internal error!  User defined type not in const pool!");
     ConstPoolType *CPT = (ConstPoolType*)D;
-    yyval.TypeVal = CPT->getValue();
-  ;
-    break;}
-case 86:
-#line 719 "llvmAsmParser.y"
-{               // Method derived type?
-    MethodType::ParamTypes Params(yyvsp[-1].TypeList->begin(), yyvsp[-1].TypeList->end());
-    delete yyvsp[-1].TypeList;
-    yyval.TypeVal = MethodType::getMethodType(yyvsp[-3].TypeVal, Params);
-  ;
-    break;}
-case 87:
-#line 724 "llvmAsmParser.y"
-{               // Method derived type?
+    (yyval.TypeVal) = CPT->getValue();
+  }
+#line 2490 "llvmAsmParser.cpp"
+    break;
+
+  case 90: /* Types: TypesV '(' TypeList ')'  */
+#line 1096 "llvmAsmParser.y"
+                            {               // Method derived type?
+    MethodType::ParamTypes Params((yyvsp[-1].TypeList)->begin(), (yyvsp[-1].TypeList)->end());
+    delete (yyvsp[-1].TypeList);
+    (yyval.TypeVal) = MethodType::getMethodType((yyvsp[-3].TypeVal), Params);
+  }
+#line 2500 "llvmAsmParser.cpp"
+    break;
+
+  case 91: /* Types: TypesV '(' ')'  */
+#line 1101 "llvmAsmParser.y"
+                   {               // Method derived type?
     MethodType::ParamTypes Params;     // Empty list
-    yyval.TypeVal = MethodType::getMethodType(yyvsp[-2].TypeVal, Params);
-  ;
-    break;}
-case 88:
-#line 728 "llvmAsmParser.y"
-{
-    yyval.TypeVal = ArrayType::getArrayType(yyvsp[-1].TypeVal);
-  ;
-    break;}
-case 89:
-#line 731 "llvmAsmParser.y"
-{
-    yyval.TypeVal = ArrayType::getArrayType(yyvsp[-1].TypeVal, (int)yyvsp[-3].UInt64Val);
-  ;
-    break;}
-case 90:
-#line 734 "llvmAsmParser.y"
-{
-    StructType::ElementTypes Elements(yyvsp[-1].TypeList->begin(), yyvsp[-1].TypeList->end());
-    delete yyvsp[-1].TypeList;
-    yyval.TypeVal = StructType::getStructType(Elements);
-  ;
-    break;}
-case 91:
-#line 739 "llvmAsmParser.y"
-{
-    yyval.TypeVal = StructType::getStructType(StructType::ElementTypes());
-  ;
-    break;}
-case 92:
-#line 742 "llvmAsmParser.y"
-{
-    yyval.TypeVal = PointerType::getPointerType(yyvsp[-1].TypeVal);
-  ;
-    break;}
-case 93:
-#line 747 "llvmAsmParser.y"
-{
-    yyval.TypeList = new list<const Type*>();
-    yyval.TypeList->push_back(yyvsp[0].TypeVal);
-  ;
-    break;}
-case 94:
-#line 751 "llvmAsmParser.y"
-{
-    (yyval.TypeList=yyvsp[-2].TypeList)->push_back(yyvsp[0].TypeVal);
-  ;
-    break;}
-case 95:
-#line 756 "llvmAsmParser.y"
-{
-    yyvsp[-1].MethodVal->getBasicBlocks().push_back(yyvsp[0].BasicBlockVal);
-    yyval.MethodVal = yyvsp[-1].MethodVal;
-  ;
-    break;}
-case 96:
-#line 760 "llvmAsmParser.y"
-{ // Do not allow methods with 0 basic blocks   
-    yyval.MethodVal = yyvsp[-1].MethodVal;                  // in them...
-    yyvsp[-1].MethodVal->getBasicBlocks().push_back(yyvsp[0].BasicBlockVal);
-  ;
-    break;}
-case 97:
-#line 769 "llvmAsmParser.y"
-{
-    yyvsp[-1].BasicBlockVal->getInstList().push_back(yyvsp[0].TermInstVal);
-    InsertValue(yyvsp[-1].BasicBlockVal);
-    yyval.BasicBlockVal = yyvsp[-1].BasicBlockVal;
-  ;
-    break;}
-case 98:
-#line 774 "llvmAsmParser.y"
-{
-    yyvsp[-1].BasicBlockVal->getInstList().push_back(yyvsp[0].TermInstVal);
-    yyvsp[-1].BasicBlockVal->setName(yyvsp[-2].StrVal);
-    free(yyvsp[-2].StrVal);         // Free the strdup'd memory...
-
-    InsertValue(yyvsp[-1].BasicBlockVal);
-    yyval.BasicBlockVal = yyvsp[-1].BasicBlockVal;
-  ;
-    break;}
-case 99:
-#line 783 "llvmAsmParser.y"
-{
-    yyvsp[-1].BasicBlockVal->getInstList().push_back(yyvsp[0].InstVal);
-    yyval.BasicBlockVal = yyvsp[-1].BasicBlockVal;
-  ;
-    break;}
-case 100:
-#line 787 "llvmAsmParser.y"
-{
-    yyval.BasicBlockVal = new BasicBlock();
-  ;
-    break;}
-case 101:
-#line 791 "llvmAsmParser.y"
-{              // Return with a result...
-    yyval.TermInstVal = new ReturnInst(getVal(yyvsp[-1].TypeVal, yyvsp[0].ValIDVal));
-  ;
-    break;}
-case 102:
-#line 794 "llvmAsmParser.y"
-{                                       // Return with no result...
-    yyval.TermInstVal = new ReturnInst();
-  ;
-    break;}
-case 103:
-#line 797 "llvmAsmParser.y"
-{                         // Unconditional Branch...
-    yyval.TermInstVal = new BranchInst((BasicBlock*)getVal(Type::LabelTy, yyvsp[0].ValIDVal));
-  ;
-    break;}
-case 104:
-#line 800 "llvmAsmParser.y"
-{  
-    yyval.TermInstVal = new BranchInst((BasicBlock*)getVal(Type::LabelTy, yyvsp[-3].ValIDVal), 
-			(BasicBlock*)getVal(Type::LabelTy, yyvsp[0].ValIDVal),
-			getVal(Type::BoolTy, yyvsp[-6].ValIDVal));
-  ;
-    break;}
-case 105:
-#line 805 "llvmAsmParser.y"
-{
-    SwitchInst *S = new SwitchInst(getVal(yyvsp[-7].TypeVal, yyvsp[-6].ValIDVal), 
-                                   (BasicBlock*)getVal(Type::LabelTy, yyvsp[-3].ValIDVal));
-    yyval.TermInstVal = S;
+    (yyval.TypeVal) = MethodType::getMethodType((yyvsp[-2].TypeVal), Params);
+  }
+#line 2509 "llvmAsmParser.cpp"
+    break;
+
+  case 92: /* Types: '[' Types ']'  */
+#line 1105 "llvmAsmParser.y"
+                  {
+    (yyval.TypeVal) = ArrayType::getArrayType((yyvsp[-1].TypeVal));
+  }
+#line 2517 "llvmAsmParser.cpp"
+    break;
+
+  case 93: /* Types: '[' EUINT64VAL 'x' Types ']'  */
+#line 1108 "llvmAsmParser.y"
+                                 {
+    (yyval.TypeVal) = ArrayType::getArrayType((yyvsp[-1].TypeVal), (int)(yyvsp[-3].UInt64Val));
+  }
+#line 2525 "llvmAsmParser.cpp"
+    break;
+
+  case 94: /* Types: '{' TypeList '}'  */
+#line 1111 "llvmAsmParser.y"
+                     {
+    StructType::ElementTypes Elements((yyvsp[-1].TypeList)->begin(), (yyvsp[-1].TypeList)->end());
+    delete (yyvsp[-1].TypeList);
+    (yyval.TypeVal) = StructType::getStructType(Elements);
+  }
+#line 2535 "llvmAsmParser.cpp"
+    break;
+
+  case 95: /* Types: '{' '}'  */
+#line 1116 "llvmAsmParser.y"
+            {
+    (yyval.TypeVal) = StructType::getStructType(StructType::ElementTypes());
+  }
+#line 2543 "llvmAsmParser.cpp"
+    break;
+
+  case 96: /* Types: Types '*'  */
+#line 1119 "llvmAsmParser.y"
+              {
+    (yyval.TypeVal) = PointerType::getPointerType((yyvsp[-1].TypeVal));
+  }
+#line 2551 "llvmAsmParser.cpp"
+    break;
+
+  case 97: /* TypeList: Types  */
+#line 1124 "llvmAsmParser.y"
+                 {
+    (yyval.TypeList) = new list<const Type*>();
+    (yyval.TypeList)->push_back((yyvsp[0].TypeVal));
+  }
+#line 2560 "llvmAsmParser.cpp"
+    break;
+
+  case 98: /* TypeList: TypeList ',' Types  */
+#line 1128 "llvmAsmParser.y"
+                       {
+    ((yyval.TypeList)=(yyvsp[-2].TypeList))->push_back((yyvsp[0].TypeVal));
+  }
+#line 2568 "llvmAsmParser.cpp"
+    break;
+
+  case 99: /* BasicBlockList: BasicBlockList BasicBlock  */
+#line 1133 "llvmAsmParser.y"
+                                           {
+    (yyvsp[-1].MethodVal)->getBasicBlocks().push_back((yyvsp[0].BasicBlockVal));
+    (yyval.MethodVal) = (yyvsp[-1].MethodVal);
+  }
+#line 2577 "llvmAsmParser.cpp"
+    break;
+
+  case 100: /* BasicBlockList: MethodHeader BasicBlock  */
+#line 1137 "llvmAsmParser.y"
+                            { // Do not allow methods with 0 basic blocks   
+    (yyval.MethodVal) = (yyvsp[-1].MethodVal);                  // in them...
+    (yyvsp[-1].MethodVal)->getBasicBlocks().push_back((yyvsp[0].BasicBlockVal));
+  }
+#line 2586 "llvmAsmParser.cpp"
+    break;
+
+  case 101: /* BasicBlock: InstructionList BBTerminatorInst  */
+#line 1146 "llvmAsmParser.y"
+                                               {
+    RecordForwardRefs((yyvsp[0].TermInstVal));
+    (yyvsp[-1].BasicBlockVal)->getInstList().push_back((yyvsp[0].TermInstVal));
+    InsertValue((yyvsp[-1].BasicBlockVal));
+    (yyval.BasicBlockVal) = (yyvsp[-1].BasicBlockVal);
+  }
+#line 2597 "llvmAsmParser.cpp"
+    break;
+
+  case 102: /* BasicBlock: LABELSTR InstructionList BBTerminatorInst  */
+#line 1152 "llvmAsmParser.y"
+                                               {
+    RecordForwardRefs((yyvsp[0].TermInstVal));
+    (yyvsp[-1].BasicBlockVal)->getInstList().push_back((yyvsp[0].TermInstVal));
+    (yyvsp[-1].BasicBlockVal)->setName((yyvsp[-2].StrVal).str());
+
+    InsertName((yyvsp[-1].BasicBlockVal), (yyvsp[-2].StrVal));
+    (yyval.BasicBlockVal) = (yyvsp[-1].BasicBlockVal);
+  }
+#line 2610 "llvmAsmParser.cpp"
+    break;
+
+  case 103: /* InstructionList: InstructionList Inst  */
+#line 1161 "llvmAsmParser.y"
+                                       {
+    (yyvsp[-1].BasicBlockVal)->getInstList().push_back((yyvsp[0].InstVal));
+    (yyval.BasicBlockVal) = (yyvsp[-1].BasicBlockVal);
+  }
+#line 2619 "llvmAsmParser.cpp"
+    break;
+
+  case 104: /* InstructionList: %empty  */
+#line 1165 "llvmAsmParser.y"
+                {
+    (yyval.BasicBlockVal) = new BasicBlock();
+  }
+#line 2627 "llvmAsmParser.cpp"
+    break;
+
+  case 105: /* BBTerminatorInst: RET Types ValueRef  */
+#line 1169 "llvmAsmParser.y"
+                                      {              // Return with a result...
+    (yyval.TermInstVal) = new ReturnInst(getVal((yyvsp[-1].TypeVal), (yyvsp[0].ValIDVal)));
+  }
+#line 2635 "llvmAsmParser.cpp"
+    break;
 
-    list<pair<ConstPoolVal*, BasicBlock*> >::iterator I = yyvsp[-1].JumpTable->begin(), 
-                                                      end = yyvsp[-1].JumpTable->end();
+  case 106: /* BBTerminatorInst: RET VOID  */
+#line 1172 "llvmAsmParser.y"
+             {                                       // Return with no result...
+    (yyval.TermInstVal) = new ReturnInst();
+  }
+#line 2643 "llvmAsmParser.cpp"
+    break;
+
+  case 107: /* BBTerminatorInst: BR LABEL ValueRef  */
+#line 1175 "llvmAsmParser.y"
+                      {                         // Unconditional Branch...
+    (yyval.TermInstVal) = new BranchInst((BasicBlock*)getVal(Type::LabelTy, (yyvsp[0].ValIDVal)));
+  }
+#line 2651 "llvmAsmParser.cpp"
+    break;
+
+  case 108: /* BBTerminatorInst: BR BOOL ValueRef ',' LABEL ValueRef ',' LABEL ValueRef  */
+#line 1178 "llvmAsmParser.y"
+                                                           {  
+    (yyval.TermInstVal) = new BranchInst((BasicBlock*)getVal(Type::LabelTy, (yyvsp[-3].ValIDVal)), 
+			(BasicBlock*)getVal(Type::LabelTy, (yyvsp[0].ValIDVal)),
+			getVal(Type::BoolTy, (yyvsp[-6].ValIDVal)));
+  }
+#line 2661 "llvmAsmParser.cpp"
+    break;
+
+  case 109: /* BBTerminatorInst: SWITCH IntType ValueRef ',' LABEL ValueRef '[' JumpTable ']'  */
+#line 1183 "llvmAsmParser.y"
+                                                                 {
+    SwitchInst *S = new SwitchInst(getVal((yyvsp[-7].TypeVal), (yyvsp[-6].ValIDVal)), 
+                                   (BasicBlock*)getVal(Type::LabelTy, (yyvsp[-3].ValIDVal)));
+    (yyval.TermInstVal) = S;
+
+    list<pair<ConstPoolVal*, BasicBlock*> >::iterator I = (yyvsp[-1].JumpTable)->begin(), 
+                                                      end = (yyvsp[-1].JumpTable)->end();
     for (; I != end; I++)
       S->dest_push_back(I->first, I->second);
-  ;
-    break;}
-case 106:
-#line 816 "llvmAsmParser.y"
-{
-    yyval.JumpTable = yyvsp[-5].JumpTable;
-    ConstPoolVal *V = (ConstPoolVal*)getVal(yyvsp[-4].TypeVal, yyvsp[-3].ValIDVal, true);
+  }
+#line 2676 "llvmAsmParser.cpp"
+    break;
+
+  case 110: /* JumpTable: JumpTable IntType ConstValueRef ',' LABEL ValueRef  */
+#line 1194 "llvmAsmParser.y"
+                                                               {
+    (yyval.JumpTable) = (yyvsp[-5].JumpTable);
+    ConstPoolVal *V = (ConstPoolVal*)getVal((yyvsp[-4].TypeVal), (yyvsp[-3].ValIDVal), true);
     if (V == 0)
       ThrowException("May only switch on a constant pool value!");
 
-    yyval.JumpTable->push_back(make_pair(V, (BasicBlock*)getVal(yyvsp[-1].TypeVal, yyvsp[0].ValIDVal)));
-  ;
-    break;}
-case 107:
-#line 824 "llvmAsmParser.y"
-{
-    yyval.JumpTable = new list<pair<ConstPoolVal*, BasicBlock*> >();
-    ConstPoolVal *V = (ConstPoolVal*)getVal(yyvsp[-4].TypeVal, yyvsp[-3].ValIDVal, true);
+    (yyval.JumpTable)->push_back(make_pair(V, (BasicBlock*)getVal((yyvsp[-1].TypeVal), (yyvsp[0].ValIDVal))));
+  }
+#line 2689 "llvmAsmParser.cpp"
+    break;
+
+  case 111: /* JumpTable: IntType ConstValueRef ',' LABEL ValueRef  */
+#line 1202 "llvmAsmParser.y"
+                                             {
+    (yyval.JumpTable) = new list<pair<ConstPoolVal*, BasicBlock*> >();
+    ConstPoolVal *V = (ConstPoolVal*)getVal((yyvsp[-4].TypeVal), (yyvsp[-3].ValIDVal), true);
 
     if (V == 0)
       ThrowException("May only switch on a constant pool value!");
 
-    yyval.JumpTable->push_back(make_pair(V, (BasicBlock*)getVal(yyvsp[-1].TypeVal, yyvsp[0].ValIDVal)));
-  ;
-    break;}
-case 108:
-#line 834 "llvmAsmParser.y"
-{
-  if (yyvsp[-1].StrVal)              // Is this definition named??
-    yyvsp[0].InstVal->setName(yyvsp[-1].StrVal);   // if so, assign the name...
-
-  InsertValue(yyvsp[0].InstVal);
-  yyval.InstVal = yyvsp[0].InstVal;
-;
-    break;}
-case 109:
-#line 842 "llvmAsmParser.y"
-{    // Used for PHI nodes and call statements...
-    yyval.ValueList = new list<Value*>();
-    yyval.ValueList->push_back(getVal(yyvsp[-1].TypeVal, yyvsp[0].ValIDVal));
-  ;
-    break;}
-case 110:
-#line 846 "llvmAsmParser.y"
-{
-    yyval.ValueList = yyvsp[-2].ValueList;
-    yyvsp[-2].ValueList->push_back(getVal(yyvsp[-2].ValueList->front()->getType(), yyvsp[0].ValIDVal));
-  ;
-    break;}
-case 112:
-#line 852 "llvmAsmParser.y"
-{ yyval.ValueList = 0; ;
-    break;}
-case 113:
-#line 854 "llvmAsmParser.y"
-{
-    yyval.InstVal = Instruction::getBinaryOperator(yyvsp[-4].BinaryOpVal, getVal(yyvsp[-3].TypeVal, yyvsp[-2].ValIDVal), getVal(yyvsp[-3].TypeVal, yyvsp[0].ValIDVal));
-    if (yyval.InstVal == 0)
+    (yyval.JumpTable)->push_back(make_pair(V, (BasicBlock*)getVal((yyvsp[-1].TypeVal), (yyvsp[0].ValIDVal))));
+  }
+#line 2703 "llvmAsmParser.cpp"
+    break;
+
+  case 112: /* Inst: OptAssign InstVal  */
+#line 1212 "llvmAsmParser.y"
+                         {
+  RecordForwardRefs((yyvsp[0].InstVal));   // Note operands that refer to placeholders
+
+  if (!(yyvsp[-1].StrVal).empty()) {        // Is this definition named??
+    (yyvsp[0].InstVal)->setName((yyvsp[-1].StrVal).str());  // if so, assign the name...
+    InsertName((yyvsp[0].InstVal), (yyvsp[-1].StrVal));
+  }
+
+  InsertValue((yyvsp[0].InstVal));
+  (yyval.InstVal) = (yyvsp[0].InstVal);
+}
+#line 2719 "llvmAsmParser.cpp"
+    break;
+
+  case 113: /* ValueRefList: Types ValueRef  */
+#line 1224 "llvmAsmParser.y"
+                              {    // Used for PHI nodes and call statements...
+    (yyval.ValueList) = new list<Value*>();
+    (yyval.ValueList)->push_back(getVal((yyvsp[-1].TypeVal), (yyvsp[0].ValIDVal)));
+  }
+#line 2728 "llvmAsmParser.cpp"
+    break;
+
+  case 114: /* ValueRefList: ValueRefList ',' ValueRef  */
+#line 1228 "llvmAsmParser.y"
+                              {
+    (yyval.ValueList) = (yyvsp[-2].ValueList);
+    (yyvsp[-2].ValueList)->push_back(getVal((yyvsp[-2].ValueList)->front()->getType(), (yyvsp[0].ValIDVal)));
+  }
+#line 2737 "llvmAsmParser.cpp"
+    break;
+
+  case 116: /* ValueRefListE: %empty  */
+#line 1234 "llvmAsmParser.y"
+                                         { (yyval.ValueList) = 0; }
+#line 2743 "llvmAsmParser.cpp"
+    break;
+
+  case 117: /* InstVal: BinaryOps Types ValueRef ',' ValueRef  */
+#line 1236 "llvmAsmParser.y"
+                                                {
+    (yyval.InstVal) = Instruction::getBinaryOperator((yyvsp[-4].BinaryOpVal), getVal((yyvsp[-3].TypeVal), (yyvsp[-2].ValIDVal)), getVal((yyvsp[-3].TypeVal), (yyvsp[0].ValIDVal)));
+    if ((yyval.InstVal) == 0)
       ThrowException("binary operator returned null!");
-  ;
-    break;}
-case 114:
-#line 859 "llvmAsmParser.y"
-{
-    yyval.InstVal = Instruction::getUnaryOperator(yyvsp[-2].UnaryOpVal, getVal(yyvsp[-1].TypeVal, yyvsp[0].ValIDVal));
-    if (yyval.InstVal == 0)
+  }
+#line 2753 "llvmAsmParser.cpp"
+    break;
+
+  case 118: /* InstVal: UnaryOps Types ValueRef  */
+#line 1241 "llvmAsmParser.y"
+                            {
+    (yyval.InstVal) = Instruction::getUnaryOperator((yyvsp[-2].UnaryOpVal), getVal((yyvsp[-1].TypeVal), (yyvsp[0].ValIDVal)));
+    if ((yyval.InstVal) == 0)
       ThrowException("unary operator returned null!");
-  ;
-    break;}
-case 115:
-#line 864 "llvmAsmParser.y"
-{
-    yyval.InstVal = new PHINode(yyvsp[0].ValueList->front()->getType());
-    while (yyvsp[0].ValueList->begin() != yyvsp[0].ValueList->end()) {
+  }
+#line 2763 "llvmAsmParser.cpp"
+    break;
+
+  case 119: /* InstVal: PHI ValueRefList  */
+#line 1246 "llvmAsmParser.y"
+                     {
+    (yyval.InstVal) = new PHINode((yyvsp[0].ValueList)->front()->getType());
+    while ((yyvsp[0].ValueList)->begin() != (yyvsp[0].ValueList)->end()) {
       // TODO: Ensure all types are the same... 
-      ((PHINode*)yyval.InstVal)->addIncoming(yyvsp[0].ValueList->front());
-      yyvsp[0].ValueList->pop_front();
+      ((PHINode*)(yyval.InstVal))->addIncoming((yyvsp[0].ValueList)->front());
+      (yyvsp[0].ValueList)->pop_front();
     }
-    delete yyvsp[0].ValueList;  // Free the list...
-  ;
-    break;}
-case 116:
-#line 873 "llvmAsmParser.y"
-{
-    if (!yyvsp[-4].TypeVal->isMethodType())
+    delete (yyvsp[0].ValueList);  // Free the list...
+  }
+#line 2777 "llvmAsmParser.cpp"
+    break;
+
+  case 120: /* InstVal: CALL Types ValueRef '(' ValueRefListE ')'  */
+#line 1255 "llvmAsmParser.y"
+                                              {
+    if (!(yyvsp[-4].TypeVal)->isMethodType())
       ThrowException("Can only call methods: invalid type '" + 
-		     yyvsp[-4].TypeVal->getName() + "'!");
+		     (yyvsp[-4].TypeVal)->getName() + "'!");
 
-    const MethodType *Ty = (const MethodType*)yyvsp[-4].TypeVal;
+    const MethodType *Ty = (const MethodType*)(yyvsp[-4].TypeVal);
 
-    Value *V = getVal(Ty, yyvsp[-3].ValIDVal);
+    Value *V = getVal(Ty, (yyvsp[-3].ValIDVal));
     if (V->getValueType() != Value::MethodVal || V->getType() != Ty)
-      ThrowException("Cannot call: " + yyvsp[-3].ValIDVal.getName() + "!");
+      ThrowException("Cannot call: " + (yyvsp[-3].ValIDVal).getName() + "!");
 
     // Create or access a new type that corresponds to the function call...
     vector<Value *> Params;
 
-    if (yyvsp[-1].ValueList) {
+    if ((yyvsp[-1].ValueList)) {
       // Pull out just the arguments...
-      Params.insert(Params.begin(), yyvsp[-1].ValueList->begin(), yyvsp[-1].ValueList->end());
-      delete yyvsp[-1].ValueList;
+      Params.insert(Params.begin(), (yyvsp[-1].ValueList)->begin(), (yyvsp[-1].ValueList)->end());
+      delete (yyvsp[-1].ValueList);
 
       // Loop through MethodType's arguments and ensure they are specified
       // correctly!
@@ -1913,288 +2813,274 @@ case 116:
     }
 
     // Create the call node...
-    yyval.InstVal = new CallInst((Method*)V, Params);
-  ;
-    break;}
-case 117:
-#line 910 "llvmAsmParser.y"
-{
-    yyval.InstVal = yyvsp[0].InstVal;
-  ;
-    break;}
-case 118:
-#line 914 "llvmAsmParser.y"
-{
-    ConstPoolVal *TyVal = new ConstPoolType(PointerType::getPointerType(yyvsp[0].TypeVal));
+    (yyval.InstVal) = new CallInst((Method*)V, Params);
+  }
+#line 2819 "llvmAsmParser.cpp"
+    break;
+
+  case 121: /* InstVal: MemoryInst  */
+#line 1292 "llvmAsmParser.y"
+               {
+    (yyval.InstVal) = (yyvsp[0].InstVal);
+  }
+#line 2827 "llvmAsmParser.cpp"
+    break;
+
+  case 122: /* MemoryInst: MALLOC Types  */
+#line 1296 "llvmAsmParser.y"
+                          {
+    ConstPoolVal *TyVal = new ConstPoolType(PointerType::getPointerType((yyvsp[0].TypeVal)));
     TyVal = addConstValToConstantPool(TyVal);
-    yyval.InstVal = new MallocInst((ConstPoolType*)TyVal);
-  ;
-    break;}
-case 119:
-#line 919 "llvmAsmParser.y"
-{
-    if (!yyvsp[-3].TypeVal->isArrayType() || ((const ArrayType*)yyvsp[-3].TypeVal)->isSized())
-      ThrowException("Trying to allocate " + yyvsp[-3].TypeVal->getName() + 
+    (yyval.InstVal) = new MallocInst((ConstPoolType*)TyVal);
+  }
+#line 2837 "llvmAsmParser.cpp"
+    break;
+
+  case 123: /* MemoryInst: MALLOC Types ',' UINT ValueRef  */
+#line 1301 "llvmAsmParser.y"
+                                   {
+    if (!(yyvsp[-3].TypeVal)->isArrayType() || ((const ArrayType*)(yyvsp[-3].TypeVal))->isSized())
+      ThrowException("Trying to allocate " + (yyvsp[-3].TypeVal)->getName() + 
 		     " as unsized array!");
 
-    Value *ArrSize = getVal(yyvsp[-1].TypeVal, yyvsp[0].ValIDVal);
-    ConstPoolVal *TyVal = new ConstPoolType(PointerType::getPointerType(yyvsp[-3].TypeVal));
+    Value *ArrSize = getVal((yyvsp[-1].TypeVal), (yyvsp[0].ValIDVal));
+    ConstPoolVal *TyVal = new ConstPoolType(PointerType::getPointerType((yyvsp[-3].TypeVal)));
     TyVal = addConstValToConstantPool(TyVal);
-    yyval.InstVal = new MallocInst((ConstPoolType*)TyVal, ArrSize);
-  ;
-    break;}
-case 120:
-#line 929 "llvmAsmParser.y"
-{
-    ConstPoolVal *TyVal = new ConstPoolType(PointerType::getPointerType(yyvsp[0].TypeVal));
+    (yyval.InstVal) = new MallocInst((ConstPoolType*)TyVal, ArrSize);
+  }
+#line 2852 "llvmAsmParser.cpp"
+    break;
+
+  case 124: /* MemoryInst: ALLOCA Types  */
+#line 1311 "llvmAsmParser.y"
+                 {
+    ConstPoolVal *TyVal = new ConstPoolType(PointerType::getPointerType((yyvsp[0].TypeVal)));
     TyVal = addConstValToConstantPool(TyVal);
-    yyval.InstVal = new AllocaInst((ConstPoolType*)TyVal);
-  ;
-    break;}
-case 121:
-#line 934 "llvmAsmParser.y"
-{
-    if (!yyvsp[-3].TypeVal->isArrayType() || ((const ArrayType*)yyvsp[-3].TypeVal)->isSized())
-      ThrowException("Trying to allocate " + yyvsp[-3].TypeVal->getName() + 
+    (yyval.InstVal) = new AllocaInst((ConstPoolType*)TyVal);
+  }
+#line 2862 "llvmAsmParser.cpp"
+    break;
+
+  case 125: /* MemoryInst: ALLOCA Types ',' UINT ValueRef  */
+#line 1316 "llvmAsmParser.y"
+                                   {
+    if (!(yyvsp[-3].TypeVal)->isArrayType() || ((const ArrayType*)(yyvsp[-3].TypeVal))->isSized())
+      ThrowException("Trying to allocate " + (yyvsp[-3].TypeVal)->getName() + 
 		     " as unsized array!");
 
-    Value *ArrSize = getVal(yyvsp[-1].TypeVal, yyvsp[0].ValIDVal);
-    ConstPoolVal *TyVal = new ConstPoolType(PointerType::getPointerType(yyvsp[-3].TypeVal));
+    Value *ArrSize = getVal((yyvsp[-1].TypeVal), (yyvsp[0].ValIDVal));
+    ConstPoolVal *TyVal = new ConstPoolType(PointerType::getPointerType((yyvsp[-3].TypeVal)));
     TyVal = addConstValToConstantPool(TyVal);
-    yyval.InstVal = new AllocaInst((ConstPoolType*)TyVal, ArrSize);
-  ;
-    break;}
-case 122:
-#line 944 "llvmAsmParser.y"
-{
-    if (!yyvsp[-1].TypeVal->isPointerType())
-      ThrowException("Trying to free nonpointer type " + yyvsp[-1].TypeVal->getName() + "!");
-    yyval.InstVal = new FreeInst(getVal(yyvsp[-1].TypeVal, yyvsp[0].ValIDVal));
-  ;
-    break;}
-}
-   /* the action file gets copied in in place of this dollarsign */
-#line 543 "/usr/dcs/software/supported/encap/bison-1.28/share/bison.simple"
-
-  yyvsp -= yylen;
-  yyssp -= yylen;
-#ifdef YYLSP_NEEDED
-  yylsp -= yylen;
-#endif
+    (yyval.InstVal) = new AllocaInst((ConstPoolType*)TyVal, ArrSize);
+  }
+#line 2877 "llvmAsmParser.cpp"
+    break;
+
+  case 126: /* MemoryInst: FREE Types ValueRef  */
+#line 1326 "llvmAsmParser.y"
+                        {
+    if (!(yyvsp[-1].TypeVal)->isPointerType())
+      ThrowException("Trying to free nonpointer type " + (yyvsp[-1].TypeVal)->getName() + "!");
+    (yyval.InstVal) = new FreeInst(getVal((yyvsp[-1].TypeVal), (yyvsp[0].ValIDVal)));
+  }
+#line 2887 "llvmAsmParser.cpp"
+    break;
 
-#if YYDEBUG != 0
-  if (yydebug)
-    {
-      short *ssp1 = yyss - 1;
-      fprintf (stderr, "state stack now");
-      while (ssp1 != yyssp)
-	fprintf (stderr, " %d", *++ssp1);
-      fprintf (stderr, "\n");
-    }
-#endif
 
-  *++yyvsp = yyval;
+#line 2891 "llvmAsmParser.cpp"
 
-#ifdef YYLSP_NEEDED
-  yylsp++;
-  if (yylen == 0)
-    {
-      yylsp->first_line = yylloc.first_line;
-      yylsp->first_column = yylloc.first_column;
-      yylsp->last_line = (yylsp-1)->last_line;
-      yylsp->last_column = (yylsp-1)->last_column;
-      yylsp->text = 0;
-    }
-  else
-    {
-      yylsp->last_line = (yylsp+yylen-1)->last_line;
-      yylsp->last_column = (yylsp+yylen-1)->last_column;
+      default: break;
     }
-#endif
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
 
-  /* Now "shift" the result of the reduction.
-     Determine what state that goes to,
-     based on the state we popped back to
-     and the rule number reduced by.  */
-
-  yyn = yyr1[yyn];
+  *++yyvsp = yyval;
 
-  yystate = yypgoto[yyn - YYNTBASE] + *yyssp;
-  if (yystate >= 0 && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTBASE];
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
-yyerrlab:   /* here on detecting error */
 
-  if (! yyerrstatus)
-    /* If not already recovering from an error, report this error.  */
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
     {
       ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
 
-#ifdef YYERROR_VERBOSE
-      yyn = yypact[yystate];
-
-      if (yyn > YYFLAG && yyn < YYLAST)
-	{
-	  int size = 0;
-	  char *msg;
-	  int x, count;
-
-	  count = 0;
-	  /* Start X at -yyn if nec to avoid negative indexes in yycheck.  */
-	  for (x = (yyn < 0 ? -yyn : 0);
-	       x < (sizeof(yytname) / sizeof(char *)); x++)
-	    if (yycheck[x + yyn] == x)
-	      size += strlen(yytname[x]) + 15, count++;
-	  msg = (char *) malloc(size + 15);
-	  if (msg != 0)
-	    {
-	      strcpy(msg, "parse error");
-
-	      if (count < 5)
-		{
-		  count = 0;
-		  for (x = (yyn < 0 ? -yyn : 0);
-		       x < (sizeof(yytname) / sizeof(char *)); x++)
-		    if (yycheck[x + yyn] == x)
-		      {
-			strcat(msg, count == 0 ? ", expecting `" : " or `");
-			strcat(msg, yytname[x]);
-			strcat(msg, "'");
-			count++;
-		      }
-		}
-	      yyerror(msg);
-	      free(msg);
-	    }
-	  else
-	    yyerror ("parse error; also virtual memory exceeded");
-	}
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-#endif /* YYERROR_VERBOSE */
-	yyerror("parse error");
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
     }
 
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
   goto yyerrlab1;
-yyerrlab1:   /* here on error raised explicitly by an action */
 
-  if (yyerrstatus == 3)
-    {
-      /* if just tried and failed to reuse lookahead token after an error, discard it.  */
-
-      /* return failure if at end of input */
-      if (yychar == YYEOF)
-	YYABORT;
 
-#if YYDEBUG != 0
-      if (yydebug)
-	fprintf(stderr, "Discarding token %d (%s).\n", yychar, yytname[yychar1]);
-#endif
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
 
-      yychar = YYEMPTY;
-    }
 
-  /* Else will try to reuse lookahead token
-     after shifting the error token.  */
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
-  yyerrstatus = 3;		/* Each real token shifted decrements this */
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
-  goto yyerrhandle;
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
 
-yyerrdefault:  /* current state does not do anything special for the error token. */
 
-#if 0
-  /* This is wrong; only states that explicitly want error tokens
-     should shift them.  */
-  yyn = yydefact[yystate];  /* If its default is to accept any token, ok.  Otherwise pop it.*/
-  if (yyn) goto yydefault;
-#endif
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
 
-yyerrpop:   /* pop the current state because it cannot handle the error token */
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
-  if (yyssp == yyss) YYABORT;
-  yyvsp--;
-  yystate = *--yyssp;
-#ifdef YYLSP_NEEDED
-  yylsp--;
-#endif
 
-#if YYDEBUG != 0
-  if (yydebug)
-    {
-      short *ssp1 = yyss - 1;
-      fprintf (stderr, "Error: state stack now");
-      while (ssp1 != yyssp)
-	fprintf (stderr, " %d", *++ssp1);
-      fprintf (stderr, "\n");
-    }
-#endif
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
-yyerrhandle:
+  yystate = yyn;
+  goto yynewstate;
 
-  yyn = yypact[yystate];
-  if (yyn == YYFLAG)
-    goto yyerrdefault;
 
-  yyn += YYTERROR;
-  if (yyn < 0 || yyn > YYLAST || yycheck[yyn] != YYTERROR)
-    goto yyerrdefault;
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
 
-  yyn = yytable[yyn];
-  if (yyn < 0)
-    {
-      if (yyn == YYFLAG)
-	goto yyerrpop;
-      yyn = -yyn;
-      goto yyreduce;
-    }
-  else if (yyn == 0)
-    goto yyerrpop;
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
 
-#if YYDEBUG != 0
-  if (yydebug)
-    fprintf(stderr, "Shifting error token, ");
-#endif
 
-  *++yyvsp = yylval;
-#ifdef YYLSP_NEEDED
-  *++yylsp = yylloc;
-#endif
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
 
-  yystate = yyn;
-  goto yynewstate;
 
- yyacceptlab:
-  /* YYACCEPT comes here.  */
-  if (yyfree_stacks)
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
     {
-      free (yyss);
-      free (yyvs);
-#ifdef YYLSP_NEEDED
-      free (yyls);
-#endif
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
     }
-  return 0;
-
- yyabortlab:
-  /* YYABORT comes here.  */
-  if (yyfree_stacks)
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
     {
-      free (yyss);
-      free (yyvs);
-#ifdef YYLSP_NEEDED
-      free (yyls);
-#endif
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
     }
-  return 1;
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
 }
-#line 950 "llvmAsmParser.y"
+
+#line 1332 "llvmAsmParser.y"
 
 int yyerror(char *ErrorMsg) {
   ThrowException(string("Parse error: ") + ErrorMsg);
@@ -1,4 +1,127 @@
-typedef union {
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_LLVMASM_LLVMASMPARSER_H_INCLUDED
+# define YY_LLVMASM_LLVMASMPARSER_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 0
+#endif
+#if YYDEBUG
+extern int llvmAsmdebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    ESINT64VAL = 258,              /* ESINT64VAL  */
+    EUINT64VAL = 259,              /* EUINT64VAL  */
+    SINTVAL = 260,                 /* SINTVAL  */
+    UINTVAL = 261,                 /* UINTVAL  */
+    VOID = 262,                    /* VOID  */
+    BOOL = 263,                    /* BOOL  */
+    SBYTE = 264,                   /* SBYTE  */
+    UBYTE = 265,                   /* UBYTE  */
+    SHORT = 266,                   /* SHORT  */
+    USHORT = 267,                  /* USHORT  */
+    INT = 268,                     /* INT  */
+    UINT = 269,                    /* UINT  */
+    LONG = 270,                    /* LONG  */
+    ULONG = 271,                   /* ULONG  */
+    FLOAT = 272,                   /* FLOAT  */
+    DOUBLE = 273,                  /* DOUBLE  */
+    STRING = 274,                  /* STRING  */
+    TYPE = 275,                    /* TYPE  */
+    LABEL = 276,                   /* LABEL  */
+    VAR_ID = 277,                  /* VAR_ID  */
+    LABELSTR = 278,                /* LABELSTR  */
+    STRINGCONSTANT = 279,          /* STRINGCONSTANT  */
+    IMPLEMENTATION = 280,          /* IMPLEMENTATION  */
+    TRUE = 281,                    /* TRUE  */
+    FALSE = 282,                   /* FALSE  */
+    BEGINTOK = 283,                /* BEGINTOK  */
+    END = 284,                     /* END  */
+    DECLARE = 285,                 /* DECLARE  */
+    PHI = 286,                     /* PHI  */
+    CALL = 287,                    /* CALL  */
+    RET = 288,                     /* RET  */
+    BR = 289,                      /* BR  */
+    SWITCH = 290,                  /* SWITCH  */
+    NEG = 291,                     /* NEG  */
+    NOT = 292,                     /* NOT  */
+    TOINT = 293,                   /* TOINT  */
+    TOUINT = 294,                  /* TOUINT  */
+    ADD = 295,                     /* ADD  */
+    SUB = 296,                     /* SUB  */
+    MUL = 297,                     /* MUL  */
+    DIV = 298,                     /* DIV  */
+    REM = 299,                     /* REM  */
+    AND = 300,                     /* AND  */
+    OR = 301,                      /* OR  */
+    XOR = 302,                     /* XOR  */
+    SETLE = 303,                   /* SETLE  */
+    SETGE = 304,                   /* SETGE  */
+    SETLT = 305,                   /* SETLT  */
+    SETGT = 306,                   /* SETGT  */
+    SETEQ = 307,                   /* SETEQ  */
+    SETNE = 308,                   /* SETNE  */
+    MALLOC = 309,                  /* MALLOC  */
+    ALLOCA = 310,                  /* ALLOCA  */
+    FREE = 311,                    /* FREE  */
+    LOAD = 312,                    /* LOAD  */
+    STORE = 313,                   /* STORE  */
+    GETFIELD = 314,                /* GETFIELD  */
+    PUTFIELD = 315                 /* PUTFIELD  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 711 "llvmAsmParser.y"
+
   Module                  *ModuleVal;
   Method                  *MethodVal;
   MethodArgument          *MethArgVal;
@@ -19,69 +142,26 @@ typedef union {
   int                      SIntVal;
   unsigned                 UIntVal;
 
-  char                    *StrVal;   // This memory is allocated by strdup!
-  ValID                    ValIDVal; // May contain memory allocated by strdup
+  StrSlice                 StrVal;   // Points into the input buffer
+  ValID                    ValIDVal; // May point into the input buffer
 
   Instruction::UnaryOps    UnaryOpVal;
   Instruction::BinaryOps   BinaryOpVal;
   Instruction::TermOps     TermOpVal;
   Instruction::MemoryOps   MemOpVal;
-} YYSTYPE;
-#define	ESINT64VAL	257
-#define	EUINT64VAL	258
-#define	SINTVAL	259
-#define	UINTVAL	260
-#define	VOID	261
-#define	BOOL	262
-#define	SBYTE	263
-#define	UBYTE	264
-#define	SHORT	265
-#define	USHORT	266
-#define	INT	267
-#define	UINT	268
-#define	LONG	269
-#define	ULONG	270
-#define	FLOAT	271
-#define	DOUBLE	272
-#define	STRING	273
-#define	TYPE	274
-#define	LABEL	275
-#define	VAR_ID	276
-#define	LABELSTR	277
-#define	STRINGCONSTANT	278
-#define	IMPLEMENTATION	279
-#define	TRUE	280
-#define	FALSE	281
-#define	BEGINTOK	282
-#define	END	283
-#define	DECLARE	284
-#define	PHI	285
-#define	CALL	286
-#define	RET	287
-#define	BR	288
-#define	SWITCH	289
-#define	NEG	290
-#define	NOT	291
-#define	TOINT	292
-#define	TOUINT	293
-#define	ADD	294
-#define	SUB	295
-#define	MUL	296
-#define	DIV	297
-#define	REM	298
-#define	SETLE	299
-#define	SETGE	300
-#define	SETLT	301
-#define	SETGT	302
-#define	SETEQ	303
-#define	SETNE	304
-#define	MALLOC	305
-#define	ALLOCA	306
-#define	FREE	307
-#define	LOAD	308
-#define	STORE	309
-#define	GETFIELD	310
-#define	PUTFIELD	311
-
-
-extern YYSTYPE llvmAsmlval;
+
+#line 154 "llvmAsmParser.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+
+
+int llvmAsmparse (void);
+
+
+#endif /* !YY_LLVMASM_LLVMASMPARSER_H_INCLUDED  */
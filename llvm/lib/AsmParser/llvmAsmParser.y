@@ -10,6 +10,8 @@
 // for a general IR format.
 //
 
+%pure_parser       // The parser must be reentrant, see RunVMAsmParser
+
 %{
 #include "ParserInternals.h"
 #include "llvm/BasicBlock.h"
@@ -18,48 +20,170 @@
 #include "llvm/Module.h"
 #include "llvm/Type.h"
 #include "llvm/DerivedTypes.h"
+#include "llvm/TypeContext.h"
 #include "llvm/Assembly/Parser.h"
 #include "llvm/ConstantPool.h"
 #include "llvm/iTerminators.h"
 #include "llvm/iMemory.h"
 #include <list>
 #include <utility>            // Get definition of pair class
-#include <stdio.h>            // This embarasment is due to our flex lexer...
+#include <hash_map>
+#include <pthread.h>
+#include <unistd.h>           // for sysconf
+#include <stdlib.h>           // for getenv
+#include "llvm/Tools/Mutex.h"
 
 int yyerror(char *ErrorMsg);  // Forward declarations to prevent "implicit 
-int yylex();                  // declaration" of xxx warnings.
-int yyparse();
+int yyparse();                // declaration" of xxx warnings.
 
-static Module *ParserResult;
-const ToolCommandLine *CurOptions = 0;
+// Each thread running the parser has its own copy of these...
+static __thread Module *ParserResult;
+__thread const ToolCommandLine *CurOptions = 0;
 
-// This contains info used when building the body of a method.  It is destroyed
-// when the method is completed.
+// ValueKey - Identifies a value in one of the parser's tables by its type and
+// its ValID, which must be either a number (Type 0) or a name (Type 1).  Names
+// are slices of the input buffer, so building a key never allocates.
 //
+typedef pair<const Type*, ValID> ValueKey;
+
+struct ValueKeyHash {
+  size_t operator()(const ValueKey &K) const {
+    size_t H = (size_t)K.first;
+    if (K.second.Type == 0)
+      return H ^ (K.second.Num * 2654435761U);
+
+    const char *P = K.second.Name.Ptr, *E = P+K.second.Name.Len;
+    for (; P != E; ++P)
+      H = 5*H + *P;
+    return H;
+  }
+};
+
+struct ValueKeyEq {
+  bool operator()(const ValueKey &A, const ValueKey &B) const {
+    if (A.first != B.first || A.second.Type != B.second.Type) return false;
+    if (A.second.Type == 0) return A.second.Num == B.second.Num;
+    return A.second.Name.Len == B.second.Name.Len &&
+           !memcmp(A.second.Name.Ptr, B.second.Name.Ptr, A.second.Name.Len);
+  }
+};
+
+struct ValuePtrHash {
+  size_t operator()(const Value *V) const { return (size_t)V >> 3; }
+};
+
 typedef vector<Value *> ValueList;           // Numbered defs
-static void ResolveDefinitions(vector<ValueList> &LateResolvers);
+typedef hash_map<ValueKey, Value*, ValueKeyHash, ValueKeyEq> NameTable;
+
+// ForwardRefTable - When a value is referenced before it is defined (a forward
+// branch, or the PHI node for a loop body), getVal hands out a placeholder for
+// it.  All references to the same value share one placeholder, and every
+// operand slot that refers to a placeholder is recorded (RecordForwardRefs) so
+// that it can be patched in place as soon as the real definition is parsed.
+//
+struct ForwardRefTable {
+  typedef vector<pair<User*, unsigned> > FixupList;
+
+  hash_map<ValueKey, Value*, ValueKeyHash, ValueKeyEq> Placeholders;
+  hash_map<Value*, FixupList, ValuePtrHash> Fixups;
+
+  inline bool empty() const { return Placeholders.empty(); }
+
+  Value *lookup(const Type *Ty, const ValID &D) const {
+    hash_map<ValueKey, Value*, ValueKeyHash, ValueKeyEq>::const_iterator I =
+      Placeholders.find(make_pair(Ty, D));
+    return I != Placeholders.end() ? I->second : 0;
+  }
 
-static struct PerModuleInfo {
+  void add(const Type *Ty, const ValID &D, Value *PlaceHolder) {
+    Placeholders[make_pair(Ty, D)] = PlaceHolder;
+    Fixups[PlaceHolder];
+  }
+
+  // recordUse - If operand #i of U is one of our placeholders, remember the 
+  // slot so that it can be patched when the placeholder is resolved.
+  //
+  bool recordUse(User *U, unsigned i) {
+    hash_map<Value*, FixupList, ValuePtrHash>::iterator I = 
+      Fixups.find(U->getOperand(i));
+    if (I == Fixups.end()) return false;
+    I->second.push_back(make_pair(U, i));
+    return true;
+  }
+
+  // resolve - The value identified by Ty/D has been defined to be V.  If there
+  // is a placeholder for it, patch all of the recorded operand slots to refer
+  // to V, and delete the placeholder.
+  //
+  void resolve(const Type *Ty, const ValID &D, Value *V) {
+    hash_map<ValueKey, Value*, ValueKeyHash, ValueKeyEq>::iterator I =
+      Placeholders.find(make_pair(Ty, D));
+    if (I == Placeholders.end()) return;
+    Value *PlaceHolder = I->second;
+    Placeholders.erase(I);
+
+    hash_map<Value*, FixupList, ValuePtrHash>::iterator FI = 
+      Fixups.find(PlaceHolder);
+    FixupList &FL = FI->second;
+    for (unsigned i = 0; i < FL.size(); ++i)
+      FL[i].first->setOperand(FL[i].second, V);
+    Fixups.erase(FI);
+
+    // Catch any uses that were not recorded as fixups...
+    if (!PlaceHolder->use_empty())
+      PlaceHolder->replaceAllUsesWith(V);
+    assert(PlaceHolder->use_empty());
+    delete PlaceHolder;
+  }
+};
+
+// ValueTables - The per scope (module or method) tables used to find values by
+// number or by name while parsing.
+//
+struct ValueTables {
+  vector<ValueList> Values;      // Numbered definitions
+  NameTable         Names;       // Named definitions
+  ForwardRefTable   ForwardRefs; // Values referenced before being defined
+};
+
+static void ResolveDefinitions(ValueTables &Tab);
+
+struct PerModuleInfo : public ValueTables {
   Module *CurrentModule;
-  vector<ValueList> Values;     // Module level numbered definitions
-  vector<ValueList> LateResolveValues;
+
+  // When methods are parsed in parallel (see RunVMAsmParser), each method body
+  // is parsed into a module scope of its own, and Header points to the tables
+  // of the module header.  Partial is set for all of these parses, because 
+  // the module is not complete when they are done.
+  //
+  const ValueTables *Header;
+  bool Partial;
+
+  PerModuleInfo() : CurrentModule(0), Header(0), Partial(false) {}
+
+  // getModuleTables - Return the tables that hold the module level values.
+  inline const ValueTables &getModuleTables() const {
+    return Header ? *Header : *this;
+  }
 
   void ModuleDone() {
-    // If we could not resolve some blocks at parsing time (forward branches)
-    // resolve the branches now...
-    ResolveDefinitions(LateResolveValues);
+    if (Partial) return;    // The module is finished off by RunVMAsmParser
 
-    Values.clear();         // Clear out method local definitions
+    // Any forward references that have not been defined by now are errors...
+    ResolveDefinitions(*this);
+
+    Values.clear();         // Clear out module level definitions
+    Names.clear();
     CurrentModule = 0;
   }
-} CurModule;
+};
 
-static struct PerMethodInfo {
+// This contains info used when building the body of a method.  It is destroyed
+// when the method is completed.
+//
+struct PerMethodInfo : public ValueTables {
   Method *CurrentMethod;         // Pointer to current method being created
 
-  vector<ValueList> Values;          // Keep track of numbered definitions
-  vector<ValueList> LateResolveValues;
-
   inline PerMethodInfo() {
     CurrentMethod = 0;
   }
@@ -71,71 +195,130 @@ static struct PerMethodInfo {
   }
 
   void MethodDone() {
-    // If we could not resolve some blocks at parsing time (forward branches)
-    // resolve the branches now...
-    ResolveDefinitions(LateResolveValues);
+    // Any forward references that have not been defined by now are errors...
+    ResolveDefinitions(*this);
 
     Values.clear();         // Clear out method local definitions
+    Names.clear();
     CurrentMethod = 0;
   }
-} CurMeth;  // Info for the current method...
+};
+
+// The parser always works on the state of the current thread...
+static __thread PerModuleInfo *CurModule;   // Info for the current module...
+static __thread PerMethodInfo *CurMeth;     // Info for the current method...
 
 
 //===----------------------------------------------------------------------===//
 //               Code to handle definitions of all the types
 //===----------------------------------------------------------------------===//
 
-static void InsertValue(Value *D, vector<ValueList> &ValueTab = CurMeth.Values) {
+// InsertValue - Add an unnamed definition to the numbered value table of the
+// specified scope, and patch any forward references to its slot number.
+//
+static void InsertValue(Value *D, ValueTables &Tab = *CurMeth) {
   if (!D->hasName()) {             // Is this a numbered definition?
     unsigned type = D->getType()->getUniqueID();
-    if (ValueTab.size() <= type)
-      ValueTab.resize(type+1, ValueList());
-    //printf("Values[%d][%d] = %d\n", type, ValueTab[type].size(), D);
-    ValueTab[type].push_back(D);
+    if (Tab.Values.size() <= type)
+      Tab.Values.resize(type+1, ValueList());
+    //printf("Values[%d][%d] = %d\n", type, Tab.Values[type].size(), D);
+
+    // Module constants occupy the lowest numbered slots of a method...
+    unsigned Num = Tab.Values[type].size();
+    const ValueTables &ModTab = CurModule->getModuleTables();
+    if (&Tab == CurMeth && type < ModTab.Values.size())
+      Num += ModTab.Values[type].size();
+
+    Tab.Values[type].push_back(D);
+    if (!Tab.ForwardRefs.empty())
+      Tab.ForwardRefs.resolve(D->getType(), ValID::create((int)Num), D);
   }
 }
 
+// InsertName - Add a definition named Name to the name table of the specified
+// scope, and patch any forward references to that name.
+//
+static void InsertName(Value *D, StrSlice Name, ValueTables &Tab = *CurMeth) {
+  ValID ID = ValID::create(Name);
+  Tab.Names[make_pair(D->getType(), ID)] = D;
+  if (!Tab.ForwardRefs.empty())
+    Tab.ForwardRefs.resolve(D->getType(), ID, D);
+}
+
+// getPlaceHolder - Return the placeholder for the value identified by Type/D in
+// the specified scope, making one if this is the first reference to it.
+//
+static Value *getPlaceHolder(const Type *Type, const ValID &D, 
+                             ValueTables &Tab) {
+  // If this value has already been forward referenced, share the placeholder.
+  if (Value *PH = Tab.ForwardRefs.lookup(Type, D))
+    return PH;
+
+  Value *d = 0;
+  switch (Type->getPrimitiveID()) {
+  case Type::LabelTyID:  d = new    BBPlaceHolder(Type, D); break;
+  case Type::MethodTyID: d = new  MethPlaceHolder(Type, D); break;
+//case Type::ClassTyID:  d = new ClassPlaceHolder(Type, D); break;
+  default:               d = new   DefPlaceHolder(Type, D); break;
+  }
+
+  assert(d != 0 && "How did we not make something?");
+  Tab.ForwardRefs.add(Type, D, d);
+  return d;
+}
+
+// getModuleVal - V is the module level value that D refers to.  When methods
+// are being parsed in parallel, module level values may not be used directly, 
+// because that would update their use lists from several threads at once.  
+// Instead they are referred to through placeholders that are resolved when 
+// the method is linked into the module.
+//
+static Value *getModuleVal(Value *V, const Type *Type, const ValID &D,
+                           bool DoNotImprovise) {
+  if (CurModule->Header == 0 || DoNotImprovise) return V;
+  return getPlaceHolder(Type, D, *CurModule);
+}
+
 static Value *getVal(const Type *Type, ValID &D, 
                      bool DoNotImprovise = false) {
   switch (D.Type) {
   case 0: {                 // Is it a numbered definition?
     unsigned type = Type->getUniqueID();
     unsigned Num = (unsigned)D.Num;
+    const ValueTables &ModTab = CurModule->getModuleTables();
 
     // Module constants occupy the lowest numbered slots...
-    if (type < CurModule.Values.size()) {
-      if (Num < CurModule.Values[type].size()) 
-        return CurModule.Values[type][Num];
+    if (type < ModTab.Values.size()) {
+      if (Num < ModTab.Values[type].size()) 
+        return getModuleVal(ModTab.Values[type][Num], Type, D, DoNotImprovise);
 
-      Num -= CurModule.Values[type].size();
+      Num -= ModTab.Values[type].size();
     }
 
     // Make sure that our type is within bounds
-    if (CurMeth.Values.size() <= type)
+    if (CurMeth->Values.size() <= type)
       break;
 
     // Check that the number is within bounds...
-    if (CurMeth.Values[type].size() <= Num)
+    if (CurMeth->Values[type].size() <= Num)
       break;
   
-    return CurMeth.Values[type][Num];
+    return CurMeth->Values[type][Num];
   }
   case 1: {                // Is it a named definition?
-    string Name(D.Name);
-    SymbolTable *SymTab = 0;
-    if (CurMeth.CurrentMethod) 
-      SymTab = CurMeth.CurrentMethod->getSymbolTable();
-    Value *N = SymTab ? SymTab->lookup(Type, Name) : 0;
-
-    if (N == 0) {
-      SymTab = CurModule.CurrentModule->getSymbolTable();
-      if (SymTab)
-        N = SymTab->lookup(Type, Name);
-      if (N == 0) break;
-    }
+    ValueKey Key(Type, D);
+    NameTable::const_iterator I = CurMeth->Names.find(Key);
+    if (I != CurMeth->Names.end()) return I->second;
 
-    D.destroy();  // Free old strdup'd memory...
-    return N;
+    I = CurModule->Names.find(Key);
+    if (I != CurModule->Names.end()) return I->second;
+
+    if (const ValueTables *Header = CurModule->Header) {
+      I = Header->Names.find(Key);
+      if (I != Header->Names.end())
+        return getModuleVal(I->second, Type, D, DoNotImprovise);
+    }
+    break;
   }
 
   case 2:                 // Is it a constant pool reference??
@@ -169,8 +352,7 @@ static Value *getVal(const Type *Type, ValID &D,
     case 4:
       cerr << "FIXME: TODO: String constants [sbyte] not implemented yet!\n";
       abort();
-      //CPV = new ConstPoolString(D.Name);
-      D.destroy();   // Free the string memory
+      //CPV = new ConstPoolString(D.Name.str());
       break;
     }
     assert(CPV && "How did we escape creating a constant??");
@@ -178,9 +360,9 @@ static Value *getVal(const Type *Type, ValID &D,
     // Scan through the constant table and see if we already have loaded this
     // constant.
     //
-    ConstantPool &CP = CurMeth.CurrentMethod ? 
-                         CurMeth.CurrentMethod->getConstantPool() :
-                           CurModule.CurrentModule->getConstantPool();
+    ConstantPool &CP = CurMeth->CurrentMethod ? 
+                         CurMeth->CurrentMethod->getConstantPool() :
+                           CurModule->CurrentModule->getConstantPool();
     ConstPoolVal *C = CP.find(CPV);      // Already have this constant?
     if (C) {
       delete CPV;  // Didn't need this after all, oh well.
@@ -200,21 +382,11 @@ static Value *getVal(const Type *Type, ValID &D,
   //
   if (DoNotImprovise) return 0;  // Do we just want a null to be returned?
 
-  // TODO: Attempt to coallecse nodes that are the same with previous ones.
-  Value *d = 0;
-  switch (Type->getPrimitiveID()) {
-  case Type::LabelTyID: d = new    BBPlaceHolder(Type, D); break;
-  case Type::MethodTyID:
-    d = new MethPlaceHolder(Type, D); 
-    InsertValue(d, CurModule.LateResolveValues);
-    return d;
-//case Type::ClassTyID:      d = new ClassPlaceHolder(Type, D); break;
-  default:                   d = new   DefPlaceHolder(Type, D); break;
-  }
-
-  assert(d != 0 && "How did we not make something?");
-  InsertValue(d, CurMeth.LateResolveValues);
-  return d;
+  // Method references are resolved at the module level, everything else is
+  // local to the current method.
+  if (Type->isMethodType())
+    return getPlaceHolder(Type, D, *CurModule);
+  return getPlaceHolder(Type, D, *CurMeth);
 }
 
 
@@ -226,38 +398,38 @@ static Value *getVal(const Type *Type, ValID &D,
 // values not defined yet... for example, a forward branch, or the PHI node for
 // a loop body.
 //
-// This keeps a table (CurMeth.LateResolveValues) of all such forward references
-// and back patchs after we are done.
+// Each scope keeps a table (ForwardRefs) of all such forward references, along
+// with the operand slots that use them.  The slots are back patched as soon as
+// the definition is seen (by InsertValue and InsertName).
 //
 
-// ResolveDefinitions - If we could not resolve some defs at parsing 
-// time (forward branches, phi functions for loops, etc...) resolve the 
-// defs now...
+// RecordForwardRefs - Called for each instruction once it is completely built.
+// Record which of its operands refer to placeholders.
 //
-static void ResolveDefinitions(vector<ValueList> &LateResolvers) {
-  // Loop over LateResolveDefs fixing up stuff that couldn't be resolved
-  for (unsigned ty = 0; ty < LateResolvers.size(); ty++) {
-    while (!LateResolvers[ty].empty()) {
-      Value *V = LateResolvers[ty].back();
-      LateResolvers[ty].pop_back();
-      ValID &DID = getValIDFromPlaceHolder(V);
-
-      Value *TheRealValue = getVal(Type::getUniqueIDType(ty), DID, true);
+static void RecordForwardRefs(Instruction *I) {
+  if (CurMeth->ForwardRefs.empty() && CurModule->ForwardRefs.empty())
+    return;
 
-      if (TheRealValue == 0 && DID.Type == 1)
-        ThrowException("Reference to an invalid definition: '" +DID.getName() +
-                       "' of type '" + V->getType()->getName() + "'");
-      else if (TheRealValue == 0)
-        ThrowException("Reference to an invalid definition: #" +itostr(DID.Num)+
-                       " of type '" + V->getType()->getName() + "'");
-
-      V->replaceAllUsesWith(TheRealValue);
-      assert(V->use_empty());
-      delete V;
-    }
-  }
+  for (unsigned i = 0, e = I->getNumOperands(); i != e; ++i)
+    if (!CurMeth->ForwardRefs.recordUse(I, i))
+      CurModule->ForwardRefs.recordUse(I, i);
+}
 
-  LateResolvers.clear();
+// ResolveDefinitions - Called at the end of a scope.  Any forward references 
+// that are still outstanding refer to values that were never defined, so 
+// report them.
+//
+static void ResolveDefinitions(ValueTables &Tab) {
+  if (Tab.ForwardRefs.empty()) return;
+
+  const ValueKey &Key = Tab.ForwardRefs.Placeholders.begin()->first;
+  const ValID &DID = Key.second;
+  if (DID.Type == 1)
+    ThrowException("Reference to an invalid definition: '" +DID.getName() +
+                   "' of type '" + Key.first->getName() + "'");
+  else
+    ThrowException("Reference to an invalid definition: #" +itostr(DID.Num)+
+                   " of type '" + Key.first->getName() + "'");
 }
 
 // addConstValToConstantPool - This code is used to insert a constant into the
@@ -266,11 +438,11 @@ static void ResolveDefinitions(vector<ValueList> &LateResolvers) {
 // multiple references to %4, for example will all get merged.
 //
 static ConstPoolVal *addConstValToConstantPool(ConstPoolVal *C) {
-  vector<ValueList> &ValTab = CurMeth.CurrentMethod ? 
-                                  CurMeth.Values : CurModule.Values;
-  ConstantPool &CP = CurMeth.CurrentMethod ? 
-                          CurMeth.CurrentMethod->getConstantPool() : 
-                          CurModule.CurrentModule->getConstantPool();
+  ValueTables &ValTab = CurMeth->CurrentMethod ? 
+                            (ValueTables&)*CurMeth : *CurModule;
+  ConstantPool &CP = CurMeth->CurrentMethod ? 
+                          CurMeth->CurrentMethod->getConstantPool() : 
+                          CurModule->CurrentModule->getConstantPool();
 
   if (ConstPoolVal *CPV = CP.find(C)) {
     // Constant already in constant pool. Try to merge the two constants
@@ -317,19 +489,221 @@ static ConstPoolVal *addConstValToConstantPool(ConstPoolVal *C) {
 //            RunVMAsmParser - Define an interface to this parser
 //===----------------------------------------------------------------------===//
 //
-Module *RunVMAsmParser(const ToolCommandLine &Opts, FILE *F) {
-  llvmAsmin = F;
-  CurOptions = &Opts;
-  llvmAsmlineno = 1;      // Reset the current line number...
+// A file with more than one method in it is parsed in several steps.  First 
+// the input is scanned for the end of the module header and of each method 
+// (llvmAsmFindMethods).  Then the header is parsed, and the method bodies are 
+// parsed by a number of threads, each one into its own scratch module with its
+// own ParserState.  Finally the methods are moved into the real module in 
+// source order, and the references between them are resolved.
+//
 
-  CurModule.CurrentModule = new Module();  // Allocate a new module to read
-  yyparse();       // Parse the file.
-  Module *Result = ParserResult;
-  CurOptions = 0;
-  llvmAsmin = stdin;    // F is about to go away, don't use it anymore...
+// ParserState - All of the state used by one run of the parser.
+//
+struct ParserState {
+  PerModuleInfo ModInfo;
+  PerMethodInfo MethInfo;
+  Module       *Result;
+
+  ParserState() : Result(0) {}
+};
+
+// RunParser - Parse the specified range of the input buffer into PS.  If 
+// FirstToken is nonzero, the lexer returns it before the first real token.
+//
+static void RunParser(ParserState &PS, const char *Start, const char *End,
+                      int LineNo = 1, int FirstToken = 0) {
+  CurModule = &PS.ModInfo;
+  CurMeth   = &PS.MethInfo;
+  llvmAsmSetInput(Start, End, LineNo, FirstToken);
+
+  yyparse();       // Parse the input.
+  PS.Result = ParserResult;
+
+  llvmAsmSetInput(0, 0);  // The buffer is about to go away, don't use it...
   ParserResult = 0;
+}
+
+// ParallelParseInfo - Shared by all of the threads parsing method bodies.
+// Threads grab methods to parse in order, until there are none left.
+//
+struct ParallelParseInfo {
+  const vector<MethodChunk> &Methods;
+  const PerModuleInfo       &Header;
+  const ToolCommandLine     &Options;
+  TypeContext              *Context;  // The caller's type context
+
+  vector<ParserState*>    States;   // Indexed by method number
+  vector<ParseException*> Errors;   // Indexed by method number
+
+  Mutex    Lock;                    // Protects NextMethod
+  unsigned NextMethod;
+
+  ParallelParseInfo(const vector<MethodChunk> &M, const PerModuleInfo &H,
+                    const ToolCommandLine &O)
+    : Methods(M), Header(H), Options(O), Context(TypeContext::getCurrent()),
+      States(M.size()), Errors(M.size()), NextMethod(0) {}
+};
+
+static void *MethodParserThread(void *Arg) {
+  ParallelParseInfo &PI = *(ParallelParseInfo*)Arg;
+  TypeContext::Scope S(PI.Context);
+  CurOptions = &PI.Options;
+
+  while (1) {
+    unsigned i;
+    {
+      MutexLocker L(PI.Lock);
+      i = PI.NextMethod++;
+    }
+    if (i >= PI.Methods.size()) break;
+
+    ParserState *PS = PI.States[i] = new ParserState();
+    PS->ModInfo.Header = &PI.Header;
+    PS->ModInfo.Partial = true;
+    PS->ModInfo.CurrentModule = new Module();  // Scratch module for the method
+
+    // The method is parsed as if it were the only one in a module with an
+    // empty header.
+    try {
+      RunParser(*PS, PI.Methods[i].Start, PI.Methods[i].End, 
+                PI.Methods[i].LineNo, IMPLEMENTATION);
+    } catch (const ParseException &E) {
+      PI.Errors[i] = new ParseException(E);
+    }
+  }
+
+  CurOptions = 0;
+  return 0;
+}
+
+// ParseMethodsInParallel - Parse all of the method bodies with NumThreads 
+// threads, then link them into the module read from the header (which is the
+// current state of this thread).
+//
+static void ParseMethodsInParallel(const vector<MethodChunk> &Methods,
+                                   unsigned NumThreads) {
+  ParallelParseInfo PI(Methods, *CurModule, *CurOptions);
+  PerModuleInfo *MainModule = CurModule;
+  PerMethodInfo *MainMeth   = CurMeth;
+
+  vector<pthread_t> Threads(NumThreads-1);
+  unsigned NumStarted = 0;
+  for (; NumStarted < Threads.size(); ++NumStarted)
+    if (pthread_create(&Threads[NumStarted], 0, MethodParserThread, &PI))
+      break;                     // Make do with the threads we have...
+  MethodParserThread(&PI);       // This thread works too
+  for (unsigned i = 0; i < NumStarted; ++i)
+    pthread_join(Threads[i], 0);
+
+  CurModule = MainModule;
+  CurMeth   = MainMeth;
+  CurOptions = &PI.Options;
+
+  // Report the error from the first method that failed, so that the error is
+  // the same whatever order the methods were parsed in.
+  //
+  for (unsigned i = 0; i < Methods.size(); ++i)
+    if (PI.Errors[i]) {
+      ParseException E(*PI.Errors[i]);
+      for (unsigned j = 0; j < Methods.size(); ++j) {
+        delete PI.Errors[j];
+        if (PI.States[j]) delete PI.States[j]->ModInfo.CurrentModule;
+        delete PI.States[j];
+      }
+      throw E;
+    }
+
+  // Move the methods into the real module, in source order.  A name that is
+  // defined again refers to the later definition, as it does when the file is
+  // parsed serially (see InsertName).
+  //
+  Module *M = CurModule->CurrentModule;
+  for (unsigned i = 0; i < Methods.size(); ++i) {
+    ParserState *PS = PI.States[i];
+    Module::MethodListType &ML = PS->ModInfo.CurrentModule->getMethodList();
+    while (!ML.empty()) {
+      Module::MethodListType::iterator I = ML.begin();
+      M->getMethodList().push_back(ML.remove(I));
+    }
+    NameTable &Names = PS->ModInfo.Names;
+    for (NameTable::iterator I = Names.begin(); I != Names.end(); ++I)
+      CurModule->Names[I->first] = I->second;
+  }
+
+  // Now that all of the methods are defined, resolve the references each 
+  // method body made to module level values...
+  //
+  for (unsigned i = 0; i < Methods.size(); ++i) {
+    ParserState *PS = PI.States[i];
+    ForwardRefTable &FR = PS->ModInfo.ForwardRefs;
+    llvmAsmlineno = Methods[i].LineNo;
+    while (!FR.empty()) {
+      ValueKey Key = FR.Placeholders.begin()->first;
+      Value *V = getVal(Key.first, Key.second, true);
+      if (V == 0) ResolveDefinitions(PS->ModInfo);  // Throws an exception
+      FR.resolve(Key.first, Key.second, V);
+    }
+
+    delete PS->ModInfo.CurrentModule;  // Delete the (now empty) scratch module
+    delete PS;
+  }
+}
 
-  return Result;
+// NumberTypesCanonically - Give the types created while M was parsed (the ones
+// with UIDs from FirstUID up) UIDs that only depend on what the types are, and
+// sort the constant pools of M, which are ordered by type UID, again.  When 
+// methods are parsed in parallel, the types are created in whatever order the
+// threads happen to run in, and a serial parse creates them in yet another 
+// order.  This is done after both, so that the output does not depend on how
+// many threads were used.
+//
+static void NumberTypesCanonically(Module *M, unsigned FirstUID) {
+  TypeContext::getCurrent()->renumberTypes(FirstUID);
+  M->getConstantPool().sortPlanes();
+  for (Module::MethodListType::iterator MI = M->getMethodList().begin();
+       MI != M->getMethodList().end(); ++MI)
+    (*MI)->getConstantPool().sortPlanes();
+}
+
+// getNumParserThreads - Return the number of threads to parse methods with.
+// This is the number of processors online, or the value of the 
+// LLVM_AS_THREADS environment variable if it is set.
+//
+static unsigned getNumParserThreads() {
+  if (const char *Env = getenv("LLVM_AS_THREADS"))
+    return atoi(Env) > 0 ? atoi(Env) : 1;
+  long NumCPUs = sysconf(_SC_NPROCESSORS_ONLN);
+  return NumCPUs > 0 ? NumCPUs : 1;
+}
+
+Module *RunVMAsmParser(const ToolCommandLine &Opts, 
+                       const char *BufStart, const char *BufEnd) {
+  CurOptions = &Opts;
+  ParserState PS;
+  PS.ModInfo.CurrentModule = new Module();  // Allocate a new module to read
+  unsigned FirstUID = TypeContext::getCurrent()->getNextUID();
+
+  const char *HeaderEnd;
+  vector<MethodChunk> Methods;
+  unsigned NumThreads = getNumParserThreads();
+  if (NumThreads > 1 && 
+      llvmAsmFindMethods(BufStart, BufEnd, HeaderEnd, Methods) &&
+      Methods.size() > 1) {
+    PS.ModInfo.Partial = true;
+    RunParser(PS, BufStart, HeaderEnd);     // Parse the module header
+
+    if (NumThreads > Methods.size()) NumThreads = Methods.size();
+    ParseMethodsInParallel(Methods, NumThreads);
+
+    PS.ModInfo.Partial = false;
+    PS.ModInfo.ModuleDone();
+  } else {
+    RunParser(PS, BufStart, BufEnd);        // Parse the file.
+  }
+
+  if (PS.Result) NumberTypesCanonically(PS.Result, FirstUID);
+  CurOptions = 0;
+  return PS.Result;
 }
 
 %}
@@ -355,8 +729,8 @@ Module *RunVMAsmParser(const ToolCommandLine &Opts, FILE *F) {
   int                      SIntVal;
   unsigned                 UIntVal;
 
-  char                    *StrVal;   // This memory is allocated by strdup!
-  ValID                    ValIDVal; // May contain memory allocated by strdup
+  StrSlice                 StrVal;   // Points into the input buffer
+  ValID                    ValIDVal; // May point into the input buffer
 
   Instruction::UnaryOps    UnaryOpVal;
   Instruction::BinaryOps   BinaryOpVal;
@@ -364,6 +738,10 @@ Module *RunVMAsmParser(const ToolCommandLine &Opts, FILE *F) {
   Instruction::MemoryOps   MemOpVal;
 }
 
+%{
+int yylex(YYSTYPE *lvalp);    // The lexer is reentrant too, see Lexer.cpp
+%}
+
 %type <ModuleVal>     Module MethodList
 %type <MethodVal>     Method MethodHeader BasicBlockList
 %type <BasicBlockVal> BasicBlock InstructionList
@@ -416,7 +794,7 @@ Module *RunVMAsmParser(const ToolCommandLine &Opts, FILE *F) {
 
 // Binary Operators 
 %type  <BinaryOpVal> BinaryOps  // all the binary operators
-%token <BinaryOpVal> ADD SUB MUL DIV REM
+%token <BinaryOpVal> ADD SUB MUL DIV REM AND OR XOR
 
 // Binary Comarators
 %token <BinaryOpVal> SETLE SETGE SETLT SETGT SETEQ SETNE 
@@ -460,7 +838,7 @@ TypesV    : Types | VOID
 // RET, BR, & SWITCH because they end basic blocks and are treated specially.
 //
 UnaryOps  : NEG | NOT | TOINT | TOUINT
-BinaryOps : ADD | SUB | MUL | DIV | REM
+BinaryOps : ADD | SUB | MUL | DIV | REM | AND | OR | XOR
 BinaryOps : SETLE | SETGE | SETLT | SETGT | SETEQ | SETNE
 
 // Valueine some types that allow classification if we only want a particular 
@@ -473,7 +851,7 @@ OptAssign : VAR_ID '=' {
     $$ = $1;
   }
   | /*empty*/ { 
-    $$ = 0; 
+    $$ = StrSlice::create(0, 0); 
   }
 
 ConstVal : SIntType EINT64VAL {     // integral constants
@@ -495,8 +873,7 @@ ConstVal : SIntType EINT64VAL {     // integral constants
   | STRING STRINGCONSTANT {         // String constants
     cerr << "FIXME: TODO: String constants [sbyte] not implemented yet!\n";
     abort();
-    //$$ = new ConstPoolString($2);
-    free($2);
+    //$$ = new ConstPoolString($2.str());
   } 
   | TYPE Types {                    // Type constants
     $$ = new ConstPoolType($2);
@@ -575,12 +952,13 @@ ConstVector : ConstVector ',' ConstVal {
 
 
 ConstPool : ConstPool OptAssign ConstVal { 
-    if ($2) {
-      $3->setName($2);
-      free($2);
-    }
+    if (!$2.empty())
+      $3->setName($2.str());
 
-    addConstValToConstantPool($3);
+    ConstPoolVal *C = addConstValToConstantPool($3);
+    if (!$2.empty())
+      InsertName(C, $2, CurMeth->CurrentMethod ? (ValueTables&)*CurMeth 
+                                              : *CurModule);
   }
   | /* empty: end of list */ { 
   }
@@ -595,16 +973,16 @@ ConstPool : ConstPool OptAssign ConstVal {
 //
 Module : MethodList {
   $$ = ParserResult = $1;
-  CurModule.ModuleDone();
+  CurModule->ModuleDone();
 }
 
 MethodList : MethodList Method {
     $1->getMethodList().push_back($2);
-    CurMeth.MethodDone();
+    CurMeth->MethodDone();
     $$ = $1;
   } 
   | ConstPool IMPLEMENTATION {
-    $$ = CurModule.CurrentModule;
+    $$ = CurModule->CurrentModule;
   }
 
 
@@ -612,13 +990,13 @@ MethodList : MethodList Method {
 //                       Rules to match Method Headers
 //===----------------------------------------------------------------------===//
 
-OptVAR_ID : VAR_ID | /*empty*/ { $$ = 0; }
+OptVAR_ID : VAR_ID | /*empty*/ { $$ = StrSlice::create(0, 0); }
 
 ArgVal : Types OptVAR_ID {
   $$ = new MethodArgument($1);
-  if ($2) {      // Was the argument named?
-    $$->setName($2); 
-    free($2);    // The string was strdup'd, so free it now.
+  if (!$2.empty()) {    // Was the argument named?
+    $$->setName($2.str());
+    InsertName($$, $2);  // Arguments are in the scope of the new method
   }
 }
 
@@ -646,12 +1024,11 @@ MethodHeaderH : TypesV STRINGCONSTANT '(' ArgList ')' {
 
   const MethodType *MT = MethodType::getMethodType($1, ParamTypeList);
 
-  Method *M = new Method(MT, $2);
-  free($2);  // Free strdup'd memory!
+  Method *M = new Method(MT, $2.str());
 
-  InsertValue(M, CurModule.Values);
+  InsertName(M, $2, *CurModule);
 
-  CurMeth.MethodStart(M);
+  CurMeth->MethodStart(M);
 
   // Add all of the arguments we parsed to the method...
   if ($4) {        // Is null if empty...
@@ -666,7 +1043,7 @@ MethodHeaderH : TypesV STRINGCONSTANT '(' ArgList ')' {
 }
 
 MethodHeader : MethodHeaderH ConstPool BEGINTOK {
-  $$ = CurMeth.CurrentMethod;
+  $$ = CurMeth->CurrentMethod;
 }
 
 Method : BasicBlockList END {
@@ -767,16 +1144,17 @@ BasicBlockList : BasicBlockList BasicBlock {
 // br, br/cc, switch, ret
 //
 BasicBlock : InstructionList BBTerminatorInst  {
+    RecordForwardRefs($2);
     $1->getInstList().push_back($2);
     InsertValue($1);
     $$ = $1;
   }
   | LABELSTR InstructionList BBTerminatorInst  {
+    RecordForwardRefs($3);
     $2->getInstList().push_back($3);
-    $2->setName($1);
-    free($1);         // Free the strdup'd memory...
+    $2->setName($1.str());
 
-    InsertValue($2);
+    InsertName($2, $1);
     $$ = $2;
   }
 
@@ -832,8 +1210,12 @@ JumpTable : JumpTable IntType ConstValueRef ',' LABEL ValueRef {
   }
 
 Inst : OptAssign InstVal {
-  if ($1)              // Is this definition named??
-    $2->setName($1);   // if so, assign the name...
+  RecordForwardRefs($2);   // Note operands that refer to placeholders
+
+  if (!$1.empty()) {        // Is this definition named??
+    $2->setName($1.str());  // if so, assign the name...
+    InsertName($2, $1);
+  }
 
   InsertValue($2);
   $$ = $2;
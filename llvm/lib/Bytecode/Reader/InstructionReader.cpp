@@ -206,6 +206,19 @@ bool BytecodeParser::ParseInstruction(const uchar *&Buf, const uchar *EndBuf,
     if (!Val->getType()->isPointerType()) return true;
     Res = new FreeInst(Val);
     return false;
+  } else if (Raw.Opcode == Instruction::Load) {
+    if (Raw.NumOperands != 1) return true;
+    Value *Ptr = getValue(Raw.Ty, Raw.Arg1);
+    if (!Ptr->getType()->isPointerType()) return true;
+    Res = new LoadInst(Ptr);
+    return false;
+  } else if (Raw.Opcode == Instruction::Store) {
+    // The type of the value stored is encoded, the pointer is to that type...
+    if (Raw.NumOperands != 2) return true;
+    Value *Val = getValue(Raw.Ty, Raw.Arg1);
+    Value *Ptr = getValue(PointerType::getPointerType(Raw.Ty), Raw.Arg2);
+    Res = new StoreInst(Val, Ptr);
+    return false;
   }
 
   cerr << "Unrecognized instruction! " << Raw.Opcode << endl;
@@ -123,14 +123,12 @@ Value *BytecodeParser::getValue(const Type *Ty, unsigned oNum, bool Create) {
 
 bool BytecodeParser::postResolveValues(ValueTable &ValTab) {
   bool Error = false;
+  map<const Value*, Value*> Resolved;    // Placeholder -> real definition
   for (unsigned ty = 0; ty < ValTab.size(); ty++) {
     ValueList &DL = ValTab[ty];
-    unsigned Size;
-    while ((Size = DL.size())) {
-      unsigned IDNumber = getValueIDNumberFromPlaceHolder(DL[Size-1]);
-
-      Value *D = DL[Size-1];
-      DL.pop_back();
+    for (unsigned i = 0; i < DL.size(); ++i) {
+      Value *D = DL[i];
+      unsigned IDNumber = getValueIDNumberFromPlaceHolder(D);
 
       Value *NewDef = getValue(D->getType(), IDNumber, false);
       if (NewDef == 0) {
@@ -138,16 +136,22 @@ bool BytecodeParser::postResolveValues(ValueTable &ValTab) {
 	cerr << "Unresolvable reference found: <" << D->getType()->getName()
 	     << ">:" << IDNumber << "!\n";
       } else {
-	// Fixup all of the uses of this placeholder def...
-        D->replaceAllUsesWith(NewDef);
-
-        // Now that all the uses are gone, delete the placeholder...
-        // If we couldn't find a def (error case), then leak a little
-	delete D;  // memory, 'cause otherwise we can't remove all uses!
+        Resolved[D] = NewDef;
       }
     }
+    DL.clear();
   }
 
+  // Fixup all of the uses of the placeholders at once...
+  User::replaceAllUses(Resolved);
+
+  // Now that all the uses are gone, delete the placeholders...  If we couldn't
+  // find a def (error case), then leak a little memory, 'cause otherwise we
+  // can't remove all uses!
+  for (map<const Value*, Value*>::iterator I = Resolved.begin();
+       I != Resolved.end(); ++I)
+    delete (Value*)I->first;
+
   return Error;
 }
 
@@ -32,14 +32,11 @@ static void outputInstructionFormat0(const Instruction *I,
   output_vbr(I->getInstType(), Out);             // Instruction Opcode ID
   output_vbr(Type, Out);                         // Result type
 
-  unsigned NumArgs;  // Count the number of arguments to the instruction
-  for (NumArgs = 0; I->getOperand(NumArgs); NumArgs++) /*empty*/;
-  output_vbr(NumArgs, Out);
+  output_vbr(I->getNumOperands(), Out);          // Number of arguments
 
-  for (unsigned i = 0; const Value *N = I->getOperand(i); i++) {
-    assert(i < NumArgs && "Count of arguments failed!");
-
-    int Slot = Table.getValSlot(N);
+  for (Instruction::op_const_iterator OI = I->op_begin(); OI != I->op_end(); 
+       ++OI) {
+    int Slot = Table.getValSlot(*OI);
     output_vbr((unsigned)Slot, Out);
   }
   align32(Out);    // We must maintain correct alignment!
@@ -118,17 +115,15 @@ static void outputInstructionFormat3(const Instruction *I,
 bool BytecodeWriter::processInstruction(const Instruction *I) {
   assert(I->getInstType() < 64 && "Opcode too big???");
 
-  unsigned NumOperands = 0;
+  unsigned NumOperands = I->getNumOperands();
   int MaxOpSlot = 0;
   int Slots[3]; Slots[0] = (1 << 12)-1;
 
-  const Value *Def;
-  while ((Def = I->getOperand(NumOperands))) {
-    int slot = Table.getValSlot(Def);
+  for (unsigned i = 0; i < NumOperands; ++i) {
+    int slot = Table.getValSlot(I->op_begin()[i]);
     assert(slot != -1 && "Broken bytecode!");
     if (slot > MaxOpSlot) MaxOpSlot = slot;
-    if (NumOperands < 3) Slots[NumOperands] = slot;
-    NumOperands++;
+    if (i < 3) Slots[i] = slot;
   }
 
   // Figure out which type to encode with the instruction.  Typically we want
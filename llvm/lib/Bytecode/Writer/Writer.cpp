@@ -125,7 +125,7 @@ bool BytecodeWriter::processMethod(const Method *M) {
 
   Table.incorporateMethod(M);
 
-  if (ModuleAnalyzer::processMethod(M)) return true;
+  if (ModuleAnalyzer<BytecodeWriter>::processMethod(M)) return true;
   
   // If needed, output the symbol table for the method...
   if (M->hasSymbolTable())
@@ -138,7 +138,7 @@ bool BytecodeWriter::processMethod(const Method *M) {
 
 bool BytecodeWriter::processBasicBlock(const BasicBlock *BB) {
   BytecodeBlock MethodBlock(BytecodeFormat::BasicBlock, Out);
-  return ModuleAnalyzer::processBasicBlock(BB);
+  return ModuleAnalyzer<BytecodeWriter>::processBasicBlock(BB);
 }
 
 void BytecodeWriter::outputSymbolTable(const SymbolTable &MST) {
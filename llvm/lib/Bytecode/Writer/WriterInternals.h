@@ -19,17 +19,18 @@
 #include "llvm/Tools/DataTypes.h"
 #include "llvm/Instruction.h"
 
-class BytecodeWriter : public ModuleAnalyzer {
+class BytecodeWriter : public ModuleAnalyzer<BytecodeWriter> {
+  friend class ModuleAnalyzer<BytecodeWriter>;
   vector<unsigned char> &Out;
   SlotCalculator Table;
 public:
   BytecodeWriter(vector<unsigned char> &o, const Module *M);
 
 protected:
-  virtual bool processConstPool(const ConstantPool &CP, bool isMethod);
-  virtual bool processMethod(const Method *M);
-  virtual bool processBasicBlock(const BasicBlock *BB);
-  virtual bool processInstruction(const Instruction *I);
+  bool processConstPool(const ConstantPool &CP, bool isMethod);
+  bool processMethod(const Method *M);
+  bool processBasicBlock(const BasicBlock *BB);
+  bool processInstruction(const Instruction *I);
 
 private :
   inline void outputSignature() {
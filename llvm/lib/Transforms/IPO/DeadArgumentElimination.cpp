@@ -0,0 +1,127 @@
+//===- DeadArgumentElimination.cpp - Remove arguments that are not used ---===//
+//
+// This file implements a module level pass that deletes the formal arguments
+// of methods that are never used in the body of the method.  The method is
+// given a new MethodType without them, and every call to it is rewritten to
+// stop passing them.
+//
+// Specifically, this:
+//   * Removes the arguments that have no uses from methods that have a body
+//   * Rewrites all of the CallInsts of such a method to drop the values that
+//     were passed for them
+//
+// Notice that:
+//   * The signature of a root (a method that may be called from outside of the
+//     module) is never changed, nor is that of a method that is used by
+//     anything other than calls to it, or that is not called at all.
+//   * A module that does not define any of its roots is left alone.
+//   * An argument that is only passed on to a recursive call of the method is
+//     used by that call, and so it is kept.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Module.h"
+#include "llvm/Method.h"
+#include "llvm/BasicBlock.h"
+#include "llvm/DerivedTypes.h"
+#include "llvm/iOther.h"
+#include "llvm/Opt/AllOpts.h"
+#include <algorithm>
+
+// getCallsTo - Fill in Calls with the CallInsts that call M, returning false
+// if M is used in any other way.
+//
+static bool getCallsTo(Method *M, vector<CallInst*> &Calls) {
+  for (Value::use_iterator UI = M->use_begin(); UI != M->use_end(); ++UI) {
+    if ((*UI)->getValueType() != Value::InstructionVal) return false;
+    Instruction *I = (Instruction*)*UI;
+    if (I->getInstType() != Instruction::Call) return false;
+
+    CallInst *CI = (CallInst*)I;
+    if (CI->getCalledMethod() != M) return false;   // Passed as an argument?
+    for (unsigned i = 1; i < CI->getNumOperands(); ++i)
+      if (CI->getOperand(i) == M) return false;
+    Calls.push_back(CI);
+  }
+  return true;
+}
+
+// RewriteCall - Replace CI with a call that only passes the arguments that
+// are still live.
+//
+static void RewriteCall(CallInst *CI, const vector<bool> &ArgIsDead) {
+  vector<Value*> Params;
+  for (unsigned i = 0; i < ArgIsDead.size(); ++i)
+    if (!ArgIsDead[i])
+      Params.push_back(CI->getOperand(i+1));
+
+  string Name = CI->getName();
+  CI->setName("");                   // Give the name to the new call
+  CallInst *NewCI = new CallInst(CI->getCalledMethod(), Params, Name);
+
+  BasicBlock::InstListType &Insts = CI->getParent()->getInstList();
+  BasicBlock::InstListType::iterator Pos = find(Insts.begin(), Insts.end(), CI);
+  Insts.insert(Pos, NewCI);          // Pos now points to NewCI
+  ++Pos;
+
+  CI->replaceAllUsesWith(NewCI);
+  delete Insts.remove(Pos);
+}
+
+// RemoveDeadArguments - Remove the unused arguments of M, if it is safe to
+// change its signature.
+//
+static bool RemoveDeadArguments(Method *M) {
+  Method::ArgumentListType &Args = M->getArgumentList();
+  vector<bool> ArgIsDead;
+  bool HasDeadArg = false;
+  for (Method::ArgumentListType::iterator AI = Args.begin(); AI != Args.end();
+       ++AI) {
+    ArgIsDead.push_back((*AI)->use_empty());
+    HasDeadArg |= ArgIsDead.back();
+  }
+  if (!HasDeadArg) return false;
+
+  // A method that is not called from inside of the module may still be called
+  // from outside of it, with all of its arguments...
+  vector<CallInst*> Calls;
+  if (!getCallsTo(M, Calls) || Calls.empty()) return false;
+
+  // Build the new signature, and drop the dead arguments from the method...
+  const MethodType *MT = M->getMethodType();
+  MethodType::ParamTypes Params;
+  for (unsigned i = 0; i < ArgIsDead.size(); ++i)
+    if (!ArgIsDead[i])
+      Params.push_back(MT->getParamTypes()[i]);
+
+  M->setMethodType(MethodType::getMethodType(MT->getReturnType(), Params));
+
+  unsigned ArgNo = 0;
+  for (Method::ArgumentListType::iterator AI = Args.begin(); AI != Args.end();
+       ++ArgNo) {
+    if (ArgIsDead[ArgNo])
+      delete Args.remove(AI);        // AI now points to the next argument
+    else
+      ++AI;
+  }
+
+  // Now that the method takes the new arguments, fix up the calls to it...
+  for (unsigned i = 0; i < Calls.size(); ++i)
+    RewriteCall(Calls[i], ArgIsDead);
+  return true;
+}
+
+bool DoDeadArgumentElimination(Module *M, const vector<string> &Roots) {
+  if (!DefinesRootMethod(M, Roots)) return false;
+  bool Changed = false;
+  Module::MethodListType &Methods = M->getMethodList();
+  for (Module::MethodListType::iterator MI = Methods.begin();
+       MI != Methods.end(); ++MI) {
+    Method *Meth = *MI;
+    if (Meth->isMethodExternal()) continue;   // The body is not known
+    if (isRootMethod(Meth, Roots)) continue;
+
+    Changed |= RemoveDeadArguments(Meth);
+  }
+  return Changed;
+}
@@ -0,0 +1,95 @@
+//===- DeadMethodElimination.cpp - Remove methods that are never called ---===//
+//
+// This file implements a module level pass that deletes the methods that can
+// not be reached from the entry points of the module.  The entry points (the
+// roots) are the methods that may be called from outside of the module, and
+// are named by the user.  Everything that they call, directly or indirectly,
+// is found by walking the call graph.
+//
+// Specifically, this:
+//   * Deletes methods, including external ones, that are not reachable from a
+//     root in the call graph.  A method with no uses is never reachable unless
+//     it is a root itself.
+//   * Keeps any method that is used by something other than an instruction, as
+//     if it were a root
+//
+// Notice that:
+//   * If none of the roots are defined in the module, nothing is known about
+//     how it is entered, and it is left alone.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Module.h"
+#include "llvm/Method.h"
+#include "llvm/Analysis/CallGraph.h"
+#include "llvm/Opt/AllOpts.h"
+#include <algorithm>
+#include <set>
+
+// isUsedOutsideOfCode - Return true if M is used by something that is not an
+// instruction, so that it can not be told whether it is called or not.
+//
+static bool isUsedOutsideOfCode(Method *M) {
+  for (Value::use_iterator UI = M->use_begin(); UI != M->use_end(); ++UI)
+    if ((*UI)->getValueType() != Value::InstructionVal)
+      return true;
+  return false;
+}
+
+// isRootMethod - Return true if M is one of the methods named in Roots.
+bool isRootMethod(const Method *M, const vector<string> &Roots) {
+  return find(Roots.begin(), Roots.end(), M->getName()) != Roots.end();
+}
+
+// DefinesRootMethod - Return true if one of the methods of M is a root.
+bool DefinesRootMethod(Module *M, const vector<string> &Roots) {
+  Module::MethodListType &Methods = M->getMethodList();
+  for (Module::MethodListType::iterator MI = Methods.begin();
+       MI != Methods.end(); ++MI)
+    if (isRootMethod(*MI, Roots)) return true;
+  return false;
+}
+
+bool DoDeadMethodElimination(Module *M, CallGraph &CG,
+                             const vector<string> &Roots) {
+  if (!DefinesRootMethod(M, Roots)) return false;
+  Module::MethodListType &Methods = M->getMethodList();
+
+  // Start out with the roots that the module defines...
+  vector<Method*> Worklist;
+  for (Module::MethodListType::iterator MI = Methods.begin();
+       MI != Methods.end(); ++MI)
+    if (isRootMethod(*MI, Roots) || isUsedOutsideOfCode(*MI))
+      Worklist.push_back(*MI);
+
+  // Mark everything that the roots may call...
+  set<Method*> Reachable;
+  while (!Worklist.empty()) {
+    Method *Meth = Worklist.back();
+    Worklist.pop_back();
+    if (!Reachable.insert(Meth).second) continue;   // Already visited
+
+    const vector<Method*> &Callees = CG.getCallees(Meth);
+    Worklist.insert(Worklist.end(), Callees.begin(), Callees.end());
+  }
+  if (Reachable.size() == Methods.size()) return false;
+
+  // The dead methods may call each other, so they all have to let go of their
+  // references before any of them can be deleted.  Only dead code calls a dead
+  // method, so after that none of them are used.
+  //
+  vector<Method*> Dead;
+  for (Module::MethodListType::iterator MI = Methods.begin();
+       MI != Methods.end(); ++MI)
+    if (!Reachable.count(*MI)) {
+      (*MI)->dropAllReferences();
+      Dead.push_back(*MI);
+    }
+
+  for (unsigned i = 0; i < Dead.size(); ++i) {
+    assert(Dead[i]->use_empty() && "Dead method is still used!");
+    Methods.remove(Dead[i]);
+    delete Dead[i];
+  }
+  return true;
+}
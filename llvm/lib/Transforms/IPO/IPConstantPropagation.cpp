@@ -0,0 +1,115 @@
+//===- IPConstantPropagation.cpp - Propagate constant arguments -----------===//
+//
+// This file implements a module level pass that finds the arguments of a
+// method that are passed the same constant by every call to it, and replaces
+// their uses in the method with that constant.  Local constant propagation is
+// then run on the method, so that the code that the constant decides is folded
+// away (for example, a branch on a flag that is always false).
+//
+// Specifically, this:
+//   * Propagates constant arguments into methods that are only called directly
+//     from inside of the module, and are not roots
+//   * Puts a copy of the constant into the callee's constant pool, unless it
+//     already has an equal one
+//   * Keeps going until no more arguments are found, because folding a callee
+//     may make it pass constants to the methods that it calls
+//
+// Notice that:
+//   * The arguments are not removed, they are only left unused.  Running the
+//     -deadargs pass afterwards removes them from the method and its calls.
+//   * Running -dce afterwards removes the blocks that are no longer reachable.
+//   * A module that does not define any of its roots is left alone, because
+//     any of its methods may then be called from outside of it.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Module.h"
+#include "llvm/Method.h"
+#include "llvm/iOther.h"
+#include "llvm/ConstPoolVals.h"
+#include "llvm/ConstantPool.h"
+#include "llvm/Opt/AllOpts.h"
+
+// getCallsTo - Fill in Calls with the CallInsts that call M, returning false
+// if M is used in any other way.
+//
+static bool getCallsTo(Method *M, vector<CallInst*> &Calls) {
+  for (Value::use_iterator UI = M->use_begin(); UI != M->use_end(); ++UI) {
+    if ((*UI)->getValueType() != Value::InstructionVal) return false;
+    Instruction *I = (Instruction*)*UI;
+    if (I->getInstType() != Instruction::Call ||
+        ((CallInst*)I)->getCalledMethod() != M)
+      return false;
+    Calls.push_back((CallInst*)I);
+  }
+  return true;
+}
+
+// getUniformConstant - Return the constant that every call in Calls passes for
+// argument #ArgNo, or null if there is no such constant.
+//
+static ConstPoolVal *getUniformConstant(const vector<CallInst*> &Calls,
+                                        unsigned ArgNo) {
+  Value *V = Calls[0]->getOperand(ArgNo+1);
+  if (V->getValueType() != Value::ConstantVal) return 0;
+  ConstPoolVal *C = (ConstPoolVal*)V;
+
+  for (unsigned i = 1; i < Calls.size(); ++i) {
+    Value *Op = Calls[i]->getOperand(ArgNo+1);
+    if (Op != C && (Op->getValueType() != Value::ConstantVal ||
+                    !C->equals((ConstPoolVal*)Op)))
+      return 0;
+  }
+  return C;
+}
+
+// PropagateArguments - Replace the arguments of M that are passed the same
+// constant by every call with that constant.
+//
+static bool PropagateArguments(Method *M) {
+  vector<CallInst*> Calls;
+  if (!getCallsTo(M, Calls) || Calls.empty()) return false;
+
+  bool Changed = false;
+  Method::ArgumentListType &Args = M->getArgumentList();
+  unsigned ArgNo = 0;
+  for (Method::ArgumentListType::iterator AI = Args.begin(); AI != Args.end();
+       ++AI, ++ArgNo) {
+    if ((*AI)->use_empty()) continue;           // Nothing to replace
+    ConstPoolVal *C = getUniformConstant(Calls, ArgNo);
+    if (C == 0) continue;
+
+    // The constant belongs to a caller, so the callee needs its own...
+    ConstPoolVal *Local = M->getConstantPool().find(C);
+    if (Local == 0) {
+      Local = C->clone();
+      M->getConstantPool().insert(Local);
+    }
+
+    (*AI)->replaceAllUsesWith(Local);
+    Changed = true;
+  }
+  return Changed;
+}
+
+bool DoIPConstantPropagation(Module *M, const vector<string> &Roots) {
+  if (!DefinesRootMethod(M, Roots)) return false;
+  Module::MethodListType &Methods = M->getMethodList();
+  bool Changed = false, LocalChange = true;
+  while (LocalChange) {
+    LocalChange = false;
+    for (Module::MethodListType::iterator MI = Methods.begin();
+         MI != Methods.end(); ++MI) {
+      Method *Meth = *MI;
+      if (Meth->isMethodExternal()) continue;   // The body is not known
+      if (isRootMethod(Meth, Roots)) continue;
+
+      if (PropagateArguments(Meth)) {
+        DoConstantPropogation(Meth);            // Fold the new constants
+        LocalChange = true;
+      }
+    }
+    Changed |= LocalChange;
+  }
+  return Changed;
+}
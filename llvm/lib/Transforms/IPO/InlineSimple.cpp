@@ -34,20 +34,23 @@
 // current values into those specified by ValueMap.
 //
 static inline void RemapInstruction(Instruction *I, 
-				    map<const Value *, Value*> &ValueMap) {
-
-  for (unsigned op = 0; const Value *Op = I->getOperand(op); op++) {
-    Value *V = ValueMap[Op];
-    if (!V && Op->getValueType() == Value::MethodVal) 
-      continue;  // Methods don't get relocated
-
-    if (!V) {
-      cerr << "Val = " << endl << Op << "Addr = " << (void*)Op << endl;
-      cerr << "Inst = " << I;
-    }
-    assert(V && "Referenced value not in value map!");
-    I->setOperand(op, V);
-  }
+				    const map<const Value *, Value*> &ValueMap) {
+#ifndef NDEBUG
+  // Methods don't get relocated, everything else must be in the map...
+  unsigned NumMethodOps = 0;
+  for (Instruction::op_iterator OI = I->op_begin(); OI != I->op_end(); ++OI)
+    if ((*OI)->getValueType() == Value::MethodVal && !ValueMap.count(*OI))
+      ++NumMethodOps;
+#endif
+
+  unsigned NumMapped = I->replaceUsesOfWith(ValueMap);
+
+#ifndef NDEBUG
+  if (NumMapped + NumMethodOps != I->getNumOperands())
+    cerr << "Inst = " << I;
+#endif
+  assert(NumMapped + NumMethodOps == I->getNumOperands() &&
+         "Referenced value not in value map!");
 }
 
 // InlineMethod - This function forcibly inlines the called method into the
@@ -114,8 +117,9 @@ bool InlineMethod(BasicBlock::InstListType::iterator CIIt) {
   //
   Method::ArgumentListType::const_iterator PTI = 
     CalledMeth->getArgumentList().begin();
-  for (unsigned a = 1; Value *Operand = CI->getOperand(a); ++a, ++PTI) {
-    ValueMap[*PTI] = Operand;
+  for (Instruction::op_iterator OI = CI->op_begin()+1; OI != CI->op_end(); 
+       ++OI, ++PTI) {
+    ValueMap[*PTI] = *OI;
   }
   
 
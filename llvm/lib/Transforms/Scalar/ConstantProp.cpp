@@ -7,9 +7,11 @@
 //     Note that if one is named and the other is not, that the result gets the
 //     original name.
 //   * Converts instructions like "add int %1, %2" into a direct def of %3 in
-//     the constant pool
+//     the constant pool.  Every binary operator, shift and cast to a primitive
+//     type is folded, using the rules in llvm/Opt/ConstantHandling.h.
 //   * Converts conditional branches on a constant boolean value into direct
-//     branches.
+//     branches, removing the incoming value for the edge that goes away from
+//     the PHI nodes of the block that it went to.
 //   * Converts phi nodes with one incoming def to the incoming def directly
 //   . Converts switch statements with one entry into a test & conditional
 //     branch
@@ -26,10 +28,12 @@
 #include "llvm/BasicBlock.h"
 #include "llvm/iTerminators.h"
 #include "llvm/iOther.h"
+#include "llvm/iUnary.h"
 #include "llvm/ConstPoolVals.h"
 #include "llvm/ConstantPool.h"
 #include "llvm/Opt/AllOpts.h"
 #include "llvm/Opt/ConstantHandling.h"
+#include "llvm/InstVisitor.h"
 
 // Merge identical constant values in the constant pool.
 // 
@@ -73,6 +77,10 @@ ConstantFoldUnaryInst(Method *M, Method::inst_iterator &DI,
   switch (Op->getInstType()) {
   case Instruction::Not:  ReplaceWith = !*D; break;
   case Instruction::Neg:  ReplaceWith = -*D; break;
+  default:            // A cast has the type that it converts to
+    if (GenericUnaryInst::getCastType(Op->getInstType()))
+      ReplaceWith = ConstRules::get(*D)->castTo(D, Op->getType());
+    break;
   }
 
   if (!ReplaceWith) return false;   // Nothing new to change...
@@ -95,15 +103,26 @@ ConstantFoldUnaryInst(Method *M, Method::inst_iterator &DI,
   return true;
 }
 
+// ConstantFoldBinaryInst - Fold a binary operator or a shift, whose operands
+// are both constants.
+//
 inline static bool 
 ConstantFoldBinaryInst(Method *M, Method::inst_iterator &DI,
-		       BinaryOperator *Op,
+		       Instruction *Op,
 		       ConstPoolVal *D1, ConstPoolVal *D2) {
   ConstPoolVal *ReplaceWith = 0;
 
   switch (Op->getInstType()) {
   case Instruction::Add:     ReplaceWith = *D1 + *D2; break;
   case Instruction::Sub:     ReplaceWith = *D1 - *D2; break;
+  case Instruction::Mul:     ReplaceWith = *D1 * *D2; break;
+  case Instruction::Div:     ReplaceWith = *D1 / *D2; break;
+  case Instruction::Rem:     ReplaceWith = *D1 % *D2; break;
+  case Instruction::And:     ReplaceWith = *D1 & *D2; break;
+  case Instruction::Or:      ReplaceWith = *D1 | *D2; break;
+  case Instruction::Xor:     ReplaceWith = *D1 ^ *D2; break;
+  case Instruction::Shl:     ReplaceWith = *D1 << *D2; break;
+  case Instruction::Shr:     ReplaceWith = *D1 >> *D2; break;
 
   case Instruction::SetEQ:   ReplaceWith = *D1 == *D2; break;
   case Instruction::SetNE:   ReplaceWith = *D1 != *D2; break;
@@ -132,6 +151,26 @@ ConstantFoldBinaryInst(Method *M, Method::inst_iterator &DI,
   return true;
 }
 
+// getEdgeNumber - Return the position of edge #SuccNo of BB among the edges
+// into the block that it goes to.  PHI nodes have their incoming values in this
+// order: by block in the method, and then by successor.
+//
+static unsigned getEdgeNumber(BasicBlock *BB, unsigned SuccNo) {
+  TerminatorInst *T = BB->getTerminator();
+  BasicBlock *Dest = T->getSuccessor(SuccNo);
+  unsigned EdgeNo = 0;
+
+  Method::BasicBlocksType &BBs = BB->getParent()->getBasicBlocks();
+  for (Method::BasicBlocksType::iterator BBI = BBs.begin(); *BBI != BB; ++BBI)
+    if (TerminatorInst *PT = (*BBI)->getTerminator())
+      for (unsigned i = 0; i < PT->getNumSuccessors(); ++i)
+        if (PT->getSuccessor(i) == Dest) ++EdgeNo;
+
+  for (unsigned i = 0; i < SuccNo; ++i)
+    if (T->getSuccessor(i) == Dest) ++EdgeNo;
+  return EdgeNo;
+}
+
 inline static bool ConstantFoldTerminator(TerminatorInst *T) {
   // Branch - See if we are conditional jumping on constant
   if (T->getInstType() == Instruction::Br) {
@@ -142,6 +181,12 @@ inline static bool ConstantFoldTerminator(TerminatorInst *T) {
       ConstPoolBool *Cond = (ConstPoolBool*)BI->getOperand(2);
       Value *Destination = BI->getOperand(Cond->getValue() ? 0 : 1);
 
+      // The edge to the other successor goes away...
+      unsigned DeadSucc = Cond->getValue() ? 1 : 0;
+      BasicBlock *Dead = BI->getSuccessor(DeadSucc);
+      if (Dead->getInstList().front()->getInstType() == Instruction::PHINode)
+        Dead->removePHIOperand(getEdgeNumber(BI->getParent(), DeadSucc));
+
       BI->setOperand(0, Destination);  // Set the unconditional destination
       BI->setOperand(1, 0);            // Clear the conditional destination
       BI->setOperand(2, 0);            // Clear the condition...
@@ -151,43 +196,74 @@ inline static bool ConstantFoldTerminator(TerminatorInst *T) {
   return false;
 }
 
-// ConstantFoldInstruction - If an instruction references constants, try to fold
-// them together...
+// ConstantFolder - If an instruction references constants, try to fold them
+// together...  Each visit method returns true if it folded the instruction, in
+// which case II has already been advanced past it.
 //
-inline static bool 
-ConstantFoldInstruction(Method *M, Method::inst_iterator &II) {
-  Instruction *Inst = *II;
-  if (Inst->isBinaryOp()) {
+struct ConstantFolder : public InstVisitor<ConstantFolder, bool> {
+  Method *M;
+  Method::inst_iterator &II;
+
+  ConstantFolder(Method *m, Method::inst_iterator &ii) : M(m), II(ii) {}
+
+  bool visitBinaryOperator(BinaryOperator *Inst) {
     Value *D1, *D2;
     if (((D1 = Inst->getOperand(0))->getValueType() == Value::ConstantVal) &
         ((D2 = Inst->getOperand(1))->getValueType() == Value::ConstantVal))
-      return ConstantFoldBinaryInst(M, II, (BinaryOperator*)Inst, 
+      return ConstantFoldBinaryInst(M, II, Inst, 
                                     (ConstPoolVal*)D1, (ConstPoolVal*)D2);
+    return false;
+  }
 
-  } else if (Inst->isUnaryOp()) {
+  bool visitUnaryOperator(UnaryOperator *Inst) {
     Value *D;
     if ((D = Inst->getOperand(0))->getValueType() == Value::ConstantVal)
-      return ConstantFoldUnaryInst(M, II, (UnaryOperator*)Inst, 
-                                   (ConstPoolVal*)D);
-  } else if (Inst->isTerminator()) {
-    return ConstantFoldTerminator((TerminatorInst*)Inst);
-
-  } else if (Inst->getInstType() == Instruction::PHINode) {
-    PHINode *PN = (PHINode*)Inst; // If it's a PHI node and only has one operand
-                                  // Then replace it directly with that operand.
-    assert(PN->getOperand(0) && "PHI Node must have at least one operand!");
-    if (PN->getOperand(1) == 0) {       // If the PHI Node has exactly 1 operand
-      Value *V = PN->getOperand(0);
-      PN->replaceAllUsesWith(V);                 // Replace all uses of this PHI
-                                                 // Unlink from basic block
-      PN->getParent()->getInstList().remove(II.getInstructionIterator());
-      if (PN->hasName()) V->setName(PN->getName()); // Inherit PHINode name
-      delete PN;                                 // Finally, delete the node...
-      return true;
-    }
+      return ConstantFoldUnaryInst(M, II, Inst, (ConstPoolVal*)D);
+    return false;
   }
-  return false;
-}
+
+  bool visitTerminatorInst(TerminatorInst *Inst) {
+    return ConstantFoldTerminator(Inst);
+  }
+
+  bool visitPHINode(PHINode *PN) {
+    // If it's a PHI node and only has one operand, then replace it directly
+    // with that operand.  A PHI node with no operands is in a block that is
+    // no longer branched to, which DCE removes.
+    if (PN->getNumOperands() != 1) return false;
+
+    Value *V = PN->getOperand(0);
+    PN->replaceAllUsesWith(V);                 // Replace all uses of this PHI
+                                               // Unlink from basic block
+    PN->getParent()->getInstList().remove(II.getInstructionIterator());
+    // Inherit the PHINode name, unless V belongs to the module.  Renaming a 
+    // module level value would change the module symbol table, which is
+    // shared by all of the methods.
+    //
+    if (PN->hasName() && V->getValueType() != Value::MethodVal &&
+        (V->getValueType() != Value::ConstantVal || 
+         ((ConstPoolVal*)V)->getParent() == M))
+      V->setName(PN->getName());
+    delete PN;                                 // Finally, delete the node...
+    return true;
+  }
+
+  // Shifts are not BinaryOperators, because their operands may have different
+  // types, so they are picked out here...
+  //
+  bool visitInstruction(Instruction *I) {
+    if (I->getInstType() != Instruction::Shl &&
+        I->getInstType() != Instruction::Shr)
+      return false;
+
+    Value *D1, *D2;
+    if (((D1 = I->getOperand(0))->getValueType() == Value::ConstantVal) &
+        ((D2 = I->getOperand(1))->getValueType() == Value::ConstantVal))
+      return ConstantFoldBinaryInst(M, II, I,
+                                    (ConstPoolVal*)D1, (ConstPoolVal*)D2);
+    return false;
+  }
+};
 
 // DoConstPropPass - Propogate constants and do constant folding on instructions
 // this returns true if something was changed, false if nothing was changed.
@@ -198,7 +274,7 @@ static bool DoConstPropPass(Method *M) {
 #if 1
   Method::inst_iterator It = M->inst_begin();
   while (It != M->inst_end())
-    if (ConstantFoldInstruction(M, It)) {
+    if (ConstantFolder(M, It).visit(*It)) {
       SomethingChanged = true;  // If returned true, iter is already incremented
 
       // Incrementing the iterator in an unchecked manner could mess up the
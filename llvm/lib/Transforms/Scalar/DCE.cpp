@@ -8,6 +8,13 @@
 //   * merges a basic block into its predecessor if there is only one and the
 //     predecessor only has one successor.
 //
+// Notice that:
+//   * PHI nodes have an incoming value for each edge into their block, in the
+//     order of the predecessor lists of a freshly built MethodCFG.  When a
+//     block is removed, the incoming values for its edges are removed from the
+//     PHI nodes of its successors, and the PHI nodes of a block that is merged
+//     into its predecessor are replaced by their only incoming value.
+//
 // TODO: This should REALLY be recursive instead of iterative.  Right now, we 
 // scan linearly through values, removing unused ones as we go.  The problem is
 // that this may cause other earlier values to become unused.  To make sure that
@@ -21,7 +28,10 @@
 #include "llvm/Method.h"
 #include "llvm/BasicBlock.h"
 #include "llvm/iTerminators.h"
+#include "llvm/iOther.h"
+#include "llvm/Analysis/CFG.h"
 #include "llvm/Opt/AllOpts.h"
+#include <algorithm>
 
 struct ConstPoolDCE { 
   enum { EndOffs = 0 };
@@ -87,6 +97,25 @@ static void ReplaceUsesWithConstant(Instruction *I) {
   I->replaceAllUsesWith(CPV);
 }
 
+// RemovePHIOperandsFrom - BB is about to be removed, so take the incoming
+// values for its edges out of the PHI nodes of its successors.  CFG still lists
+// BB as a predecessor of each of them, once for each edge, in the same order as
+// the incoming values.
+//
+static void RemovePHIOperandsFrom(BasicBlock *BB, const MethodCFG &CFG) {
+  const vector<BasicBlock*> &Succs = CFG.getSuccessors(BB);
+  for (unsigned s = 0; s < Succs.size(); ++s) {
+    if (find(Succs.begin(), Succs.begin()+s, Succs[s]) != Succs.begin()+s)
+      continue;                          // Already done for this successor
+
+    // Go from the back, so that the positions before p do not move...
+    const vector<BasicBlock*> &Preds = CFG.getPredecessors(Succs[s]);
+    for (unsigned p = Preds.size(); p != 0; --p)
+      if (Preds[p-1] == BB)
+        Succs[s]->removePHIOperand(p-1);
+  }
+}
+
 static bool DoDCEPass(Method *M) {
   Method::BasicBlocksType::iterator BBIt;
   Method::BasicBlocksType &BBs = M->getBasicBlocks();
@@ -96,6 +125,11 @@ static bool DoDCEPass(Method *M) {
   for (BBIt = BBs.begin(); BBIt != BBs.end(); BBIt++)
     Changed |= RemoveUnusedDefs((*BBIt)->getInstList(), BasicBlockDCE());
 
+  // Find the predecessors of all of the blocks once, and keep them up to date
+  // as blocks are removed and merged below...
+  //
+  MethodCFG CFG(M);
+
   // Scan through and remove basic blocks that have no predecessors (except,
   // of course, the first one.  :)  (so skip first block)
   //
@@ -104,8 +138,10 @@ static bool DoDCEPass(Method *M) {
     assert(BB->getTerminator() && 
 	   "Degenerate basic block encountered!");  // Empty bb???
 
-    if (BB->pred_begin() == BB->pred_end() &&
+    if (CFG.getPredecessors(BB).empty() &&
 	!BB->hasConstantPoolReferences()) {
+      RemovePHIOperandsFrom(BB, CFG);
+      CFG.removeBlock(BB);
 
       while (!BB->getInstList().empty()) {
 	Instruction *I = BB->getInstList().front();
@@ -132,10 +168,10 @@ static bool DoDCEPass(Method *M) {
     BasicBlock *BB = *BBIt;
 
     // Is there exactly one predecessor to this block?
-    BasicBlock::pred_iterator PI(BB->pred_begin());
-    if (PI != BB->pred_end() && ++PI == BB->pred_end() && 
+    const vector<BasicBlock*> &Preds = CFG.getPredecessors(BB);
+    if (Preds.size() == 1 && Preds[0] != BB &&
 	!BB->hasConstantPoolReferences()) {
-      BasicBlock *Pred = *BB->pred_begin();
+      BasicBlock *Pred = Preds[0];
       TerminatorInst *Term = Pred->getTerminator();
       if (Term == 0) continue; // Err... malformed basic block!
 
@@ -144,10 +180,26 @@ static bool DoDCEPass(Method *M) {
           !((BranchInst*)Term)->isUnconditional())
         continue;  // Nope, maybe next time...
 
+      // BB takes the place of the entry block only if it comes right after it
+      if (Pred == BBs.front() && *(BBs.begin()+1) != BB) continue;
+
       Changed = true;
 
+      // BB only has one edge into it, so each of its PHI nodes has only one
+      // incoming value.  Pred's predecessors are about to become BB's, so the
+      // PHI nodes are replaced by that value.
+      //
+      BasicBlock::InstListType &Insts = BB->getInstList();
+      while (Insts.front()->getInstType() == Instruction::PHINode) {
+        PHINode *PN = (PHINode*)Insts.front();
+        PN->replaceAllUsesWith(PN->getIncomingValue(0));
+        BasicBlock::InstListType::iterator II = Insts.begin();
+        delete Insts.remove(II);
+      }
+
       // Make all branches to the predecessor now point to the successor...
-      Pred->replaceAllUsesWith(BB);
+      CFG.redirectBranches(Pred, BB);
+      CFG.removeBlock(Pred);
 
       // Move all definitions in the predecessor to the successor...
       BasicBlock::InstListType::iterator DI = Pred->getInstList().end();
@@ -0,0 +1,166 @@
+//===- GVN.cpp - Value numbering common subexpression elimination ---------===//
+//
+// This file implements a simple value numbering pass, which finds instructions
+// that compute a value that has already been computed, and replaces them with
+// the earlier instruction.  The method is walked in preorder over the dominator
+// tree, with a table of the expressions that are available in each block: the
+// ones that are computed in the blocks that dominate it.
+//
+// Specifically, this:
+//   * Numbers unary operators (including casts) and binary operators
+//     (including setcc), keyed on the opcode, the result type and the operands
+//   * Puts the operands of commutative operators in a canonical order
+//   * Treats constants that have the same type and value as the same operand,
+//     even if they are different objects in the constant pool
+//
+// Notice that:
+//   * test/gvn.ll has examples of what is and is not removed.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Method.h"
+#include "llvm/BasicBlock.h"
+#include "llvm/ConstPoolVals.h"
+#include "llvm/Type.h"
+#include "llvm/Analysis/Dominators.h"
+#include "llvm/Opt/AllOpts.h"
+#include <map>
+#include <string.h>
+#include <utility>
+
+// ValueExpr - The opcode, type and operands of an instruction, which are
+// the same for instructions that compute the same value.
+//
+struct ValueExpr {
+  unsigned Opcode;
+  const Type *Ty;
+  Value *Op1, *Op2;
+
+  bool operator<(const ValueExpr &E) const {
+    if (Opcode != E.Opcode) return Opcode < E.Opcode;
+    if (Ty != E.Ty) return Ty < E.Ty;
+    if (Op1 != E.Op1) return Op1 < E.Op1;
+    return Op2 < E.Op2;
+  }
+};
+
+class ValueNumbering {
+  map<ValueExpr, Instruction*> Available;  // Expressions in the current scope
+  vector<ValueExpr> ScopeLog;              // Expressions, in insertion order
+  map<const Type*, vector<ConstPoolVal*> > Leaders;  // Constants, by type
+public:
+  bool run(DominatorTree &DT);
+private:
+  Value *getOperandLeader(Value *V);
+  bool getExpression(Instruction *I, ValueExpr &E);
+  bool processBlock(BasicBlock *BB);
+};
+
+// isSameConstant - Return true if C1 and C2 are constants of the same type
+// with the same value.  equals() compares floating point values with ==, which
+// holds for 0.0 and -0.0, so those are compared bit for bit instead.
+//
+static bool isSameConstant(ConstPoolVal *C1, ConstPoolVal *C2) {
+  if (C1 == C2) return true;
+  const Type *Ty = C1->getType();
+  if (Ty != Type::FloatTy && Ty != Type::DoubleTy) return C1->equals(C2);
+
+  double V1 = ((ConstPoolFP*)C1)->getValue();
+  double V2 = ((ConstPoolFP*)C2)->getValue();
+  return memcmp(&V1, &V2, sizeof(double)) == 0;
+}
+
+// getOperandLeader - Return the value that stands for V in an expression.  This
+// is V, unless it is a constant that is equal to one seen before.
+//
+Value *ValueNumbering::getOperandLeader(Value *V) {
+  if (V->getValueType() != Value::ConstantVal) return V;
+
+  ConstPoolVal *CPV = (ConstPoolVal*)V;
+  vector<ConstPoolVal*> &Plane = Leaders[CPV->getType()];
+  for (unsigned i = 0; i < Plane.size(); ++i)
+    if (isSameConstant(Plane[i], CPV))
+      return Plane[i];
+  Plane.push_back(CPV);
+  return CPV;
+}
+
+// getExpression - Fill in E for I, returning false if I is not an instruction
+// that is numbered.
+//
+bool ValueNumbering::getExpression(Instruction *I, ValueExpr &E) {
+  if (I->hasSideEffects()) return false;
+  if (!I->isUnaryOp() && !I->isBinaryOp()) return false;
+
+  E.Opcode = I->getInstType();
+  E.Ty = I->getType();
+  E.Op1 = getOperandLeader(I->getOperand(0));
+  E.Op2 = I->isBinaryOp() ? getOperandLeader(I->getOperand(1)) : 0;
+  if (E.Op2 && Instruction::isCommutative(E.Opcode) && E.Op2 < E.Op1) {
+    Value *Tmp = E.Op1; E.Op1 = E.Op2; E.Op2 = Tmp;
+  }
+  return true;
+}
+
+// processBlock - Replace the instructions in BB that are already available,
+// and make the rest available to the blocks that BB dominates.
+//
+bool ValueNumbering::processBlock(BasicBlock *BB) {
+  bool Changed = false;
+  BasicBlock::InstListType &Insts = BB->getInstList();
+  for (BasicBlock::InstListType::iterator II = Insts.begin();
+       II != Insts.end(); ) {
+    ValueExpr E;
+    if (!getExpression(*II, E)) { ++II; continue; }
+
+    map<ValueExpr, Instruction*>::iterator AI = Available.find(E);
+    if (AI == Available.end()) {
+      Available[E] = *II;
+      ScopeLog.push_back(E);
+      ++II;
+    } else {
+      Instruction *I = Insts.remove(II);  // II now points to the next inst
+      I->replaceAllUsesWith(AI->second);
+      delete I;
+      Changed = true;
+    }
+  }
+  return Changed;
+}
+
+bool ValueNumbering::run(DominatorTree &DT) {
+  if (DT.getRoot() == 0) return false;   // External method
+  bool Changed = false;
+
+  // Walk the dominator tree, keeping the length of the scope log on entry to
+  // each block, so that its expressions can be forgotten on the way out.
+  //
+  vector<pair<BasicBlock*, unsigned> > Stack;   // Block, next child
+  vector<unsigned> ScopeStart;
+  Stack.push_back(make_pair(DT.getRoot(), 0U));
+  ScopeStart.push_back(0);
+  Changed |= processBlock(DT.getRoot());
+
+  while (!Stack.empty()) {
+    const vector<BasicBlock*> &Children = DT.getChildren(Stack.back().first);
+    if (Stack.back().second < Children.size()) {
+      BasicBlock *Child = Children[Stack.back().second++];
+      Stack.push_back(make_pair(Child, 0U));
+      ScopeStart.push_back(ScopeLog.size());
+      Changed |= processBlock(Child);
+    } else {
+      while (ScopeLog.size() > ScopeStart.back()) {
+        Available.erase(ScopeLog.back());
+        ScopeLog.pop_back();
+      }
+      ScopeStart.pop_back();
+      Stack.pop_back();
+    }
+  }
+  return Changed;
+}
+
+bool DoGlobalValueNumbering(Method *M, DominatorTree &DT) {
+  ValueNumbering VN;
+  return VN.run(DT);
+}
@@ -0,0 +1,203 @@
+//===- InstructionCombining.cpp - Combine multiple instructions -----------===//
+//
+// InstructionCombining - Combine instructions to form fewer, simple
+// instructions.  This pass does not modify the CFG, and has a tendency to
+// make instructions dead, so a subsequent DCE pass is useful.
+//
+// This pass is driven by a worklist, which starts out holding every instruction
+// in the method.  When an instruction is simplified, the instructions that use
+// it are put back on the worklist, because they may now be simplified too.
+// The rules are written with the matchers in llvm/Opt/PatternMatch.h.
+//
+// Specifically, this:
+//   * Moves the constant operand of commutative operators to the right
+//   * Simplifies x+0, x-0, x*1, x|0 and x^0 to x, and x*0 and x&0 to 0
+//   * Simplifies x-x and x^x to 0, and x&x and x|x to x
+//   * Simplifies neg (neg x) and not (not x) to x
+//   * Turns not (setcc a, b) into the inverted setcc, if the setcc has no
+//     other uses and does not compare floating point values
+//
+// Notice that:
+//   * not flips every bit of an integer, as ConstRules folds it, and is
+//     logical negation for bool, so not (not x) is x for every type.
+//   * test/instcombine.ll has an example of each rule.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Method.h"
+#include "llvm/BasicBlock.h"
+#include "llvm/iBinary.h"
+#include "llvm/ConstPoolVals.h"
+#include "llvm/ConstantPool.h"
+#include "llvm/Opt/AllOpts.h"
+#include "llvm/Opt/PatternMatch.h"
+#include <algorithm>
+#include <set>
+
+class InstCombiner {
+  Method *M;
+  vector<Instruction*> WorkList;
+  set<Instruction*> Dead;           // Replaced, to be deleted at the end
+public:
+  inline InstCombiner(Method *m) : M(m) {}
+  bool run();
+private:
+  // addUsesToWorkList - Add the instructions that use V to the worklist.
+  void addUsesToWorkList(Value *V) {
+    for (Value::use_iterator UI = V->use_begin(); UI != V->use_end(); ++UI)
+      if ((*UI)->getValueType() == Value::InstructionVal)
+        WorkList.push_back((Instruction*)*UI);
+  }
+
+  Value *getNullValue(const Type *Ty);
+  Value *combine(Instruction *I);
+};
+
+// getNullValue - Return a zero of type Ty, in the constant pool of the method.
+// The one that is already in the pool is used, if there is one.
+//
+Value *InstCombiner::getNullValue(const Type *Ty) {
+  ConstPoolVal *Null = ConstPoolVal::getNullConstant(Ty);
+  if (ConstPoolVal *Existing = M->getConstantPool().find(Null)) {
+    delete Null;
+    return Existing;
+  }
+  M->getConstantPool().insert(Null);
+  return Null;
+}
+
+static inline bool isIntegral(const Type *Ty) {
+  return Ty->isSigned() || Ty->isUnsigned();
+}
+
+// getInverseCondition - Return the setcc opcode that is true exactly when Op
+// is false, for integral operands.
+//
+static unsigned getInverseCondition(unsigned Op) {
+  switch (Op) {
+  case Instruction::SetEQ: return Instruction::SetNE;
+  case Instruction::SetNE: return Instruction::SetEQ;
+  case Instruction::SetLT: return Instruction::SetGE;
+  case Instruction::SetGE: return Instruction::SetLT;
+  case Instruction::SetGT: return Instruction::SetLE;
+  case Instruction::SetLE: return Instruction::SetGT;
+  default: assert(0 && "Not a setcc opcode!"); return 0;
+  }
+}
+
+// combine - Try to simplify I.  Returns the value that I should be replaced
+// with, I itself if it was changed in place, or null if nothing was done.
+//
+Value *InstCombiner::combine(Instruction *I) {
+  Value *X, *Y;
+  unsigned Cond;
+
+  // Put a constant operand of a commutative operator on the right, so that the
+  // rules below only have to look for it there...
+  if (I->isBinaryOp() && I->isCommutative() &&
+      I->getOperand(0)->getValueType() == Value::ConstantVal &&
+      I->getOperand(1)->getValueType() != Value::ConstantVal) {
+    Value *LHS = I->getOperand(0);
+    I->setOperand(0, I->getOperand(1));
+    I->setOperand(1, LHS);
+    WorkList.push_back(I);          // Look at it again with the new order
+    return I;
+  }
+
+  switch (I->getInstType()) {
+  case Instruction::Add:
+    if (match(I, m_Add(m_Value(X), m_Zero()))) return X;      // x+0 = x
+    break;
+  case Instruction::Sub:
+    if (match(I, m_Sub(m_Value(X), m_Zero()))) return X;      // x-0 = x
+    if (match(I, m_Sub(m_Value(X), m_Value(Y))) && X == Y &&  // x-x = 0
+        isIntegral(I->getType()))
+      return getNullValue(I->getType());
+    break;
+  case Instruction::Mul:
+    if (match(I, m_Mul(m_Value(X), m_One()))) return X;       // x*1 = x
+    if (match(I, m_Mul(m_Value(), m_Value(Y))) &&             // x*0 = 0
+        match(Y, m_Zero()))
+      return Y;
+    break;
+  case Instruction::And:
+    if (match(I, m_And(m_Value(), m_Value(Y))) &&             // x&0 = 0
+        match(Y, m_Zero()))
+      return Y;
+    if (match(I, m_And(m_Value(X), m_Value(Y))) && X == Y)    // x&x = x
+      return X;
+    break;
+  case Instruction::Or:
+    if (match(I, m_Or(m_Value(X), m_Zero()))) return X;       // x|0 = x
+    if (match(I, m_Or(m_Value(X), m_Value(Y))) && X == Y)     // x|x = x
+      return X;
+    break;
+  case Instruction::Xor:
+    if (match(I, m_Xor(m_Value(X), m_Zero()))) return X;      // x^0 = x
+    if (match(I, m_Xor(m_Value(X), m_Value(Y))) && X == Y &&  // x^x = 0
+        isIntegral(I->getType()))
+      return getNullValue(I->getType());
+    break;
+  case Instruction::Neg:
+    if (match(I, m_Neg(m_Neg(m_Value(X))))) return X;         // --x = x
+    break;
+  case Instruction::Not:
+    if (match(I, m_Not(m_Not(m_Value(X))))) return X;         // ~~x = x
+
+    // not (setcc a, b) = inverted setcc a, b
+    if (match(I, m_Not(m_SetCond(Cond, m_Value(X), m_Value(Y))))) {
+      Instruction *SetCC = (Instruction*)I->getOperand(0);
+      if (SetCC->use_size() != 1 || !isIntegral(X->getType())) break;
+
+      Instruction *New =
+        new SetCondInst((Instruction::BinaryOps)getInverseCondition(Cond),
+                        X, Y);
+      BasicBlock::InstListType &Insts = I->getParent()->getInstList();
+      BasicBlock::InstListType::iterator Pos =
+        find(Insts.begin(), Insts.end(), I);
+      Insts.insert(Pos, New);
+      return New;
+    }
+    break;
+  }
+  return 0;
+}
+
+bool InstCombiner::run() {
+  bool Changed = false;
+  for (Method::inst_iterator I = M->inst_begin(); I != M->inst_end(); ++I)
+    WorkList.push_back(*I);
+  reverse(WorkList.begin(), WorkList.end());   // Visit in program order
+
+  while (!WorkList.empty()) {
+    Instruction *I = WorkList.back();
+    WorkList.pop_back();
+    if (Dead.count(I)) continue;
+
+    Value *Result = combine(I);
+    if (Result == 0) continue;
+    Changed = true;
+    if (Result == I) continue;                  // Changed in place
+
+    // The users of I may be simplified further once they use Result...
+    addUsesToWorkList(I);
+    if (Result->getValueType() == Value::InstructionVal)
+      WorkList.push_back((Instruction*)Result);
+
+    I->replaceAllUsesWith(Result);
+    I->dropAllReferences();
+    Dead.insert(I);
+  }
+
+  for (set<Instruction*>::iterator DI = Dead.begin(); DI != Dead.end(); ++DI) {
+    Instruction *I = *DI;
+    I->getParent()->getInstList().remove(I);
+    delete I;
+  }
+  return Changed;
+}
+
+bool DoInstructionCombining(Method *M) {
+  InstCombiner IC(M);
+  return IC.run();
+}
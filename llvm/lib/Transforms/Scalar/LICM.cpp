@@ -0,0 +1,156 @@
+//===- LICM.cpp - Loop invariant code motion ------------------------------===//
+//
+// This file implements loop invariant code motion: instructions inside of a
+// loop that compute the same value on every trip around it are moved into a
+// preheader block, which is run once before the loop is entered.
+//
+// Specifically, this:
+//   * Hoists unary and binary operators whose operands are all defined outside
+//     of the loop (or are themselves hoisted)
+//   * Handles the innermost loops first, so that code hoisted out of an inner
+//     loop may then be hoisted out of the loops around it
+//   * Creates a new preheader for each loop that has code to hoist.  DCE will
+//     merge it into the block before the loop, if there is just one.
+//
+// Notice that:
+//   * Instructions are hoisted even if they would not have been run on the
+//     path taken through the loop, so nothing that may trap (division and
+//     remainder) or that has side effects is moved.
+//   * PHI nodes do not record which block each incoming value comes from, but
+//     have one for each edge into their block, in the order of the blocks in
+//     the method.  The preheader is put right after the block that enters the
+//     loop, so that its edge takes the place of the old one in that order.  A
+//     loop whose header has PHI nodes and is entered by more than one edge, or
+//     is the entry block, can not be given a preheader, and is left alone.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Method.h"
+#include "llvm/BasicBlock.h"
+#include "llvm/iTerminators.h"
+#include "llvm/Analysis/LoopInfo.h"
+#include "llvm/Opt/AllOpts.h"
+#include <algorithm>
+#include <set>
+
+// isInvariant - Return true if V has the same value on every trip around L.
+static bool isInvariant(const Value *V, const Loop *L, const LoopInfo &LI,
+                        const set<const Instruction*> &Hoisted) {
+  if (V->getValueType() != Value::InstructionVal) return true;
+  const Instruction *I = (const Instruction*)V;
+  return Hoisted.count(I) || !L->contains(LI.getLoopFor(I->getParent()));
+}
+
+// canHoist - Return true if I may be moved out of L.
+static bool canHoist(Instruction *I, const Loop *L, const LoopInfo &LI,
+                     const set<const Instruction*> &Hoisted) {
+  if (!I->isUnaryOp() && !I->isBinaryOp()) return false;
+  if (I->hasSideEffects() || I->getInstType() == Instruction::Div ||
+      I->getInstType() == Instruction::Rem)
+    return false;
+
+  for (Instruction::op_iterator OI = I->op_begin(); OI != I->op_end(); ++OI)
+    if (!isInvariant(*OI, L, LI, Hoisted)) return false;
+  return true;
+}
+
+// InsertPreheader - Create a block that branches to the header of L, and make
+// all of the branches into L from outside of it go there instead.  Returns
+// null if this can not be done.
+//
+static BasicBlock *InsertPreheader(Method *M, Loop *L, LoopInfo &LI) {
+  BasicBlock *Header = L->getHeader();
+
+  // Find the blocks outside of L that branch into it, from the terminators
+  // that use the header, and count their edges to it...
+  vector<BasicBlock*> Outside;
+  unsigned NumEdges = 0;
+  for (Value::use_iterator UI = Header->use_begin(); 
+       UI != Header->use_end(); ++UI) {
+    if ((*UI)->getValueType() != Value::InstructionVal) continue;
+    BasicBlock *Pred = ((Instruction*)*UI)->getParent();
+    if (L->contains(LI.getLoopFor(Pred))) continue;
+    ++NumEdges;
+    if (find(Outside.begin(), Outside.end(), Pred) == Outside.end())
+      Outside.push_back(Pred);
+  }
+
+  Method::BasicBlocksType &BBs = M->getBasicBlocks();
+  bool IsEntry = Header == BBs.front();
+  if (Header->getInstList().front()->getInstType() == Instruction::PHINode &&
+      (NumEdges != 1 || IsEntry))
+    return 0;
+
+  BasicBlock *Preheader = new BasicBlock();
+  if (IsEntry) {
+    BBs.push_front(Preheader);                // Must be the new entry block
+  } else if (Outside.empty()) {
+    BBs.push_back(Preheader);                 // The loop is not reachable
+  } else {
+    Method::BasicBlocksType::iterator Pos =
+      find(BBs.begin(), BBs.end(), Outside[0]);
+    ++Pos;
+    BBs.insert(Pos, Preheader);               // Right after the block
+  }
+  LI.addBlockToLoop(Preheader, L->getParentLoop());
+
+  for (unsigned i = 0; i < Outside.size(); ++i) {
+    TerminatorInst *T = Outside[i]->getTerminator();
+    for (unsigned s = 0; s < T->getNumSuccessors(); ++s)
+      if (T->getSuccessor(s) == Header)
+        T->setSuccessor(s, Preheader);
+  }
+  return Preheader;
+}
+
+// HoistLoop - Hoist the invariant instructions out of L, after doing its
+// subloops.
+//
+static bool HoistLoop(Method *M, Loop *L, LoopInfo &LI) {
+  bool Changed = false;
+  const vector<Loop*> &SubLoops = L->getSubLoops();
+  for (unsigned i = 0; i < SubLoops.size(); ++i)
+    Changed |= HoistLoop(M, SubLoops[i], LI);
+
+  // Find the instructions to hoist, in an order that puts each one after the
+  // instructions that it uses.  Hoisting an instruction may make the ones that
+  // use it invariant, so keep looking until no more are found.
+  //
+  vector<Instruction*> ToHoist;
+  set<const Instruction*> Hoisted;
+  bool Found = true;
+  while (Found) {
+    Found = false;
+    const vector<BasicBlock*> &Blocks = L->getBlocks();
+    for (unsigned b = 0; b < Blocks.size(); ++b) {
+      BasicBlock::InstListType &Insts = Blocks[b]->getInstList();
+      for (BasicBlock::InstListType::iterator I = Insts.begin();
+           I != Insts.end(); ++I)
+        if (!Hoisted.count(*I) && canHoist(*I, L, LI, Hoisted)) {
+          ToHoist.push_back(*I);
+          Hoisted.insert(*I);
+          Found = true;
+        }
+    }
+  }
+  if (ToHoist.empty()) return Changed;
+
+  BasicBlock *Preheader = InsertPreheader(M, L, LI);
+  if (Preheader == 0) return Changed;
+
+  for (unsigned i = 0; i < ToHoist.size(); ++i) {
+    Instruction *I = ToHoist[i];
+    I->getParent()->getInstList().remove(I);
+    Preheader->getInstList().push_back(I);
+  }
+  Preheader->getInstList().push_back(new BranchInst(L->getHeader()));
+  return true;
+}
+
+bool DoLoopInvariantCodeMotion(Method *M, LoopInfo &LI) {
+  bool Changed = false;
+  const vector<Loop*> &Loops = LI.getTopLevelLoops();
+  for (unsigned i = 0; i < Loops.size(); ++i)
+    Changed |= HoistLoop(M, Loops[i], LI);
+  return Changed;
+}
@@ -0,0 +1,277 @@
+//===- PromoteMemoryToRegister.cpp - Promote allocas to registers ---------===//
+//
+// This file promotes memory references to be register references.  It promotes
+// alloca instructions which only have loads and stores as uses.  An alloca is
+// transformed by using dominance frontiers to place PHI nodes, then walking the
+// dominator tree in preorder, renaming each load to the value most recently
+// stored on the way down.  The values that a block stores are logged, and put
+// back once the walk leaves the part of the tree that the block dominates.
+//
+// Specifically, this:
+//   * Promotes allocas of primitive type that are not arrays, whose address is
+//     only used as the pointer operand of loads and stores
+//   * Places PHI nodes at the iterated dominance frontier of the stores
+//   * Uses the null value of the type for loads that are reached without a
+//     store before them
+//
+// Notice that:
+//   * PHI nodes do not record which block each incoming value comes from, so
+//     the new PHI nodes get one incoming value for each edge into their block,
+//     in the order of the predecessor lists of a freshly built MethodCFG.  The
+//     CFG that the DominatorTree was built from is used to place the PHI nodes
+//     and to fill them in, so the DominatorTree must be up to date.  Debug
+//     builds check that its CFG matches a freshly built one.
+//   * PHI nodes that turn out not to be used are left for DCE to remove.
+//   * Methods whose entry block has predecessors are left alone.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Method.h"
+#include "llvm/BasicBlock.h"
+#include "llvm/iMemory.h"
+#include "llvm/iOther.h"
+#include "llvm/ConstPoolVals.h"
+#include "llvm/ConstantPool.h"
+#include "llvm/Analysis/Dominators.h"
+#include "llvm/Opt/AllOpts.h"
+#include <map>
+#include <utility>
+
+// isAllocaPromotable - Return true if AI may be turned into a register.  Its
+// type must have a null value, to use when a load is not preceeded by a store.
+//
+static bool isAllocaPromotable(const AllocaInst *AI) {
+  if (AI->getArraySize()) return false;
+  const Type *Ty = AI->getType()->getValueType();
+  if (Ty->getPrimitiveID() < Type::BoolTyID ||      // bool, integer and FP
+      Ty->getPrimitiveID() > Type::DoubleTyID)
+    return false;
+
+  for (Value::use_const_iterator UI = AI->use_begin(); UI != AI->use_end();
+       ++UI) {
+    if ((*UI)->getValueType() != Value::InstructionVal) return false;
+    const Instruction *I = (const Instruction*)*UI;
+    if (I->getInstType() == Instruction::Load) continue;
+    if (I->getInstType() != Instruction::Store ||
+        ((const StoreInst*)I)->getValueOperand() == AI)
+      return false;                      // The address escapes
+  }
+  return true;
+}
+
+// PlacePHINodes - Insert a PHI node for alloca #AllocaNo into each block of the
+// iterated dominance frontier of the blocks that store to it.  Each PHI node
+// starts out with the null value for every incoming value.
+//
+static void PlacePHINodes(AllocaInst *AI, unsigned AllocaNo, ConstPoolVal *Null,
+                          DominatorTree &DT,
+                          map<PHINode*, unsigned> &PHIAllocas) {
+  const MethodCFG &CFG = DT.getCFG();
+  vector<bool> HasPHI(CFG.getNumBlocks()), Queued(CFG.getNumBlocks());
+
+  vector<BasicBlock*> Worklist;
+  for (Value::use_iterator UI = AI->use_begin(); UI != AI->use_end(); ++UI) {
+    Instruction *I = (Instruction*)*UI;
+    unsigned BBNo = CFG.getBlockNumber(I->getParent());
+    if (I->getInstType() == Instruction::Store && !Queued[BBNo]) {
+      Queued[BBNo] = true;
+      Worklist.push_back(I->getParent());
+    }
+  }
+
+  while (!Worklist.empty()) {
+    BasicBlock *BB = Worklist.back();
+    Worklist.pop_back();
+    if (!DT.isReachable(BB)) continue;
+
+    const vector<BasicBlock*> &DF = DT.getDominanceFrontier(BB);
+    for (unsigned i = 0; i < DF.size(); ++i) {
+      unsigned DFNo = CFG.getBlockNumber(DF[i]);
+      if (HasPHI[DFNo]) continue;
+      HasPHI[DFNo] = true;
+
+      PHINode *PN = new PHINode(Null->getType());
+      unsigned NumPreds = CFG.getPredecessors(DFNo).size();
+      for (unsigned p = 0; p < NumPreds; ++p)
+        PN->addIncoming(Null);
+      DF[i]->getInstList().push_front(PN);
+      PHIAllocas[PN] = AllocaNo;
+
+      if (!Queued[DFNo]) {              // The PHI node is a store too
+        Queued[DFNo] = true;
+        Worklist.push_back(DF[i]);
+      }
+    }
+  }
+}
+
+// setValue - Make V the value of alloca #No, logging the value that it had, so
+// that it can be put back when the walk leaves the block.
+//
+static inline void setValue(vector<Value*> &Values,
+                            vector<pair<unsigned, Value*> > &Log,
+                            unsigned No, Value *V) {
+  Log.push_back(make_pair(No, Values[No]));
+  Values[No] = V;
+}
+
+// RenameBlock - Rewrite the loads and stores of the promoted allocas in BB,
+// given the values that they have on entry to it, and fill in the PHI node
+// operands of BB's successors.  Values is updated to the values on exit, and
+// the values that it had are added to Log.
+//
+static void RenameBlock(BasicBlock *BB, vector<Value*> &Values,
+                        vector<pair<unsigned, Value*> > &Log,
+                        const map<AllocaInst*, unsigned> &AllocaNums,
+                        const map<PHINode*, unsigned> &PHIAllocas,
+                        const MethodCFG &CFG) {
+  BasicBlock::InstListType &Insts = BB->getInstList();
+  for (BasicBlock::InstListType::iterator II = Insts.begin();
+       II != Insts.end(); ) {
+    Instruction *I = *II;
+    if (I->getInstType() == Instruction::PHINode) {
+      map<PHINode*, unsigned>::const_iterator PI =
+        PHIAllocas.find((PHINode*)I);
+      if (PI != PHIAllocas.end()) setValue(Values, Log, PI->second, I);
+    } else if (I->getInstType() == Instruction::Load ||
+               I->getInstType() == Instruction::Store) {
+      Value *Ptr = I->getInstType() == Instruction::Load ?
+        ((LoadInst*)I)->getPointerOperand() :
+        ((StoreInst*)I)->getPointerOperand();
+
+      if (Ptr->getValueType() == Value::InstructionVal &&
+          ((Instruction*)Ptr)->getInstType() == Instruction::Alloca) {
+        map<AllocaInst*, unsigned>::const_iterator AI =
+          AllocaNums.find((AllocaInst*)Ptr);
+        if (AI != AllocaNums.end()) {
+          if (I->getInstType() == Instruction::Load)
+            I->replaceAllUsesWith(Values[AI->second]);
+          else
+            setValue(Values, Log, AI->second,
+                     ((StoreInst*)I)->getValueOperand());
+
+          delete Insts.remove(II);       // II now points to the next inst
+          continue;
+        }
+      }
+    }
+    ++II;
+  }
+
+  // Fill in the operands of the successors' PHI nodes that come from BB...
+  const vector<BasicBlock*> &Succs = CFG.getSuccessors(BB);
+  for (unsigned s = 0; s < Succs.size(); ++s) {
+    const vector<BasicBlock*> &Preds = CFG.getPredecessors(Succs[s]);
+    BasicBlock::InstListType &SuccInsts = Succs[s]->getInstList();
+    for (BasicBlock::InstListType::iterator II = SuccInsts.begin();
+         II != SuccInsts.end() &&
+           (*II)->getInstType() == Instruction::PHINode; ++II) {
+      map<PHINode*, unsigned>::const_iterator PI =
+        PHIAllocas.find((PHINode*)*II);
+      if (PI == PHIAllocas.end()) continue;
+
+      for (unsigned p = 0; p < Preds.size(); ++p)
+        if (Preds[p] == BB)
+          (*II)->setOperand(p, Values[PI->second]);
+    }
+  }
+}
+
+#ifndef NDEBUG
+// isCFGCurrent - Return true if CFG has the blocks and edges that M has now, in
+// the order that a freshly built MethodCFG has them in.
+//
+static bool isCFGCurrent(Method *M, const MethodCFG &CFG) {
+  MethodCFG Fresh(M);
+  if (Fresh.getNumBlocks() != CFG.getNumBlocks()) return false;
+  for (unsigned i = 0; i < Fresh.getNumBlocks(); ++i)
+    if (Fresh.getBlock(i) != CFG.getBlock(i) ||
+        Fresh.getPredecessors(i) != CFG.getPredecessors(i) ||
+        Fresh.getSuccessors(i) != CFG.getSuccessors(i))
+      return false;
+  return true;
+}
+#endif
+
+bool DoPromoteMemoryToRegister(Method *M, DominatorTree &DT) {
+  BasicBlock *Root = DT.getRoot();
+  if (Root == 0) return false;           // External method
+  const MethodCFG &CFG = DT.getCFG();
+  assert(isCFGCurrent(M, CFG) && "DominatorTree is out of date!");
+
+  // If the entry block is branched to, a PHI node in it would need an incoming
+  // value for entering the method, which can not be told apart from the rest.
+  //
+  if (!CFG.getPredecessors(Root).empty()) return false;
+
+  // Find the allocas that can be promoted.  Frontends put them in the entry
+  // block, but any reachable block will do...
+  //
+  vector<AllocaInst*> Allocas;
+  map<AllocaInst*, unsigned> AllocaNums;
+  for (Method::inst_iterator I = M->inst_begin(); I != M->inst_end(); ++I)
+    if ((*I)->getInstType() == Instruction::Alloca &&
+        isAllocaPromotable((AllocaInst*)*I) &&
+        DT.isReachable((*I)->getParent())) {
+      AllocaNums[(AllocaInst*)*I] = Allocas.size();
+      Allocas.push_back((AllocaInst*)*I);
+    }
+  if (Allocas.empty()) return false;
+
+  // Each alloca starts out holding the null value of its type...
+  vector<Value*> Nulls;
+  map<PHINode*, unsigned> PHIAllocas;
+  for (unsigned i = 0; i < Allocas.size(); ++i) {
+    ConstPoolVal *Null =
+      ConstPoolVal::getNullConstant(Allocas[i]->getType()->getValueType());
+    if (ConstPoolVal *Existing = M->getConstantPool().find(Null)) {
+      delete Null;                       // Use the one that is already there
+      Null = Existing;
+    } else {
+      M->getConstantPool().insert(Null);
+    }
+    Nulls.push_back(Null);
+    PlacePHINodes(Allocas[i], i, Null, DT, PHIAllocas);
+  }
+  vector<Value*> Values(Nulls);
+
+  // Walk the dominator tree in preorder.  Each block starts with the values
+  // that its immediate dominator ends with.  A null block on the stack marks
+  // the end of the subtree of a block: the values are put back to what they
+  // were before it, by undoing the log down to the recorded size.
+  //
+  vector<pair<unsigned, Value*> > Log;
+  vector<pair<BasicBlock*, unsigned> > Stack;
+  Stack.push_back(make_pair(Root, 0U));
+  while (!Stack.empty()) {
+    BasicBlock *BB = Stack.back().first;
+    unsigned LogSize = Stack.back().second;
+    Stack.pop_back();
+
+    if (BB == 0) {
+      for (; Log.size() > LogSize; Log.pop_back())
+        Values[Log.back().first] = Log.back().second;
+      continue;
+    }
+
+    Stack.push_back(make_pair((BasicBlock*)0, Log.size()));
+    RenameBlock(BB, Values, Log, AllocaNums, PHIAllocas, CFG);
+
+    const vector<BasicBlock*> &Children = DT.getChildren(BB);
+    for (unsigned i = 0; i < Children.size(); ++i)
+      Stack.push_back(make_pair(Children[i], 0U));
+  }
+
+  // The allocas are only used by loads and stores in unreachable code now...
+  for (unsigned i = 0; i < Allocas.size(); ++i) {
+    AllocaInst *AI = Allocas[i];
+    while (!AI->use_empty()) {
+      Instruction *I = (Instruction*)*AI->use_begin();
+      if (I->getInstType() == Instruction::Load)
+        I->replaceAllUsesWith(Nulls[i]);
+      delete I->getParent()->getInstList().remove(I);
+    }
+    delete AI->getParent()->getInstList().remove(AI);
+  }
+  return true;
+}
@@ -0,0 +1,227 @@
+//===- SimplifyCFG.cpp - Simplify the control flow graph of a method ------===//
+//
+// This file implements a pass that cleans up the control flow of a method.  It
+// works with a worklist of blocks, looked up in the cached MethodCFG, which is
+// kept up to date as the branches are changed.  A block goes back on the
+// worklist only when a change was made that may let it be simplified further,
+// so the pass runs in time linear in the size of the method.
+//
+// Specifically, this:
+//   * Turns a conditional branch whose two targets are the same block into an
+//     unconditional branch
+//   * Turns a switch with no cases into an unconditional branch to the default
+//     block, and one with a single case into a setcc and a conditional branch
+//   * Threads the branches to a block that holds nothing but an unconditional
+//     branch straight to its target, and then removes the empty block
+//   * Hoists the instructions that begin both arms of a conditional branch into
+//     the block that branches, while they are identical, if each arm has no
+//     other predecessors
+//
+// Notice that:
+//   * PHI nodes do not record which block each incoming value comes from, but
+//     have one incoming value for each entry in the predecessor list of their
+//     block.  A change that would add or remove a predecessor of a block that
+//     has PHI nodes is not made.
+//   * Unreachable blocks are left for DCE to remove.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Method.h"
+#include "llvm/BasicBlock.h"
+#include "llvm/iTerminators.h"
+#include "llvm/iBinary.h"
+#include "llvm/ConstPoolVals.h"
+#include "llvm/Analysis/CFG.h"
+#include "llvm/Opt/AllOpts.h"
+#include <algorithm>
+#include <set>
+
+class CFGSimplifier {
+  Method *M;
+  MethodCFG &CFG;
+  vector<BasicBlock*> WorkList;
+  set<BasicBlock*> Dead;            // Removed, to be deleted at the end
+public:
+  inline CFGSimplifier(Method *m, MethodCFG &cfg) : M(m), CFG(cfg) {}
+  bool run();
+private:
+  void replaceTerminator(BasicBlock *BB, TerminatorInst *New);
+
+  bool foldSameTargetBranch(BasicBlock *BB);
+  bool foldSwitch(BasicBlock *BB);
+  bool removeForwardingBlock(BasicBlock *BB);
+  bool hoistCommonCode(BasicBlock *BB);
+};
+
+// hasPHINodes - Return true if BB begins with a PHI node, so that the order of
+// its predecessors must not change.
+//
+static inline bool hasPHINodes(BasicBlock *BB) {
+  return BB->getInstList().front()->getInstType() == Instruction::PHINode;
+}
+
+static inline bool isUnconditionalBranch(Instruction *I) {
+  return I->getInstType() == Instruction::Br &&
+         ((BranchInst*)I)->isUnconditional();
+}
+
+// isIdenticalInst - Return true if I1 and I2 compute the same value from the
+// same operands.
+//
+static bool isIdenticalInst(Instruction *I1, Instruction *I2) {
+  if (I1->getInstType() != I2->getInstType() ||
+      I1->getType() != I2->getType() ||
+      I1->getNumOperands() != I2->getNumOperands())
+    return false;
+
+  for (unsigned i = 0; i < I1->getNumOperands(); ++i)
+    if (I1->getOperand(i) != I2->getOperand(i))
+      return false;
+  return true;
+}
+
+// replaceTerminator - Replace the terminator of BB with New, and tell the CFG.
+void CFGSimplifier::replaceTerminator(BasicBlock *BB, TerminatorInst *New) {
+  BasicBlock::InstListType &Insts = BB->getInstList();
+  BasicBlock::InstListType::iterator II = Insts.end()-1;
+  delete Insts.remove(II);
+  Insts.push_back(New);
+  CFG.terminatorChanged(BB);
+}
+
+// foldSameTargetBranch - "br bool %C, label %A, label %A" is "br label %A".
+bool CFGSimplifier::foldSameTargetBranch(BasicBlock *BB) {
+  TerminatorInst *T = BB->getTerminator();
+  if (T->getInstType() != Instruction::Br || isUnconditionalBranch(T))
+    return false;
+
+  const vector<BasicBlock*> &Succs = CFG.getSuccessors(BB);
+  if (Succs[0] != Succs[1] || hasPHINodes(Succs[0])) return false;
+
+  replaceTerminator(BB, new BranchInst(Succs[0]));
+  return true;
+}
+
+// foldSwitch - Turn a switch with at most one case into a branch.
+bool CFGSimplifier::foldSwitch(BasicBlock *BB) {
+  TerminatorInst *T = BB->getTerminator();
+  if (T->getInstType() != Instruction::Switch || T->getNumOperands() > 4)
+    return false;
+
+  const vector<BasicBlock*> &Succs = CFG.getSuccessors(BB);
+  BasicBlock *Default = Succs[0];
+  if (Succs.size() == 1 || Succs[1] == Default) {
+    // Every value goes to the default block...
+    if (Succs.size() != 1 && hasPHINodes(Default)) return false;
+    replaceTerminator(BB, new BranchInst(Default));
+    return true;
+  }
+
+  // The case block and the default block keep one edge each...
+  Instruction *Cond = new SetCondInst(Instruction::SetEQ, T->getOperand(0),
+                                      T->getOperand(2));
+  BasicBlock::InstListType &Insts = BB->getInstList();
+  BasicBlock::InstListType::iterator II = Insts.end()-1;
+  Insts.insert(II, Cond);
+  replaceTerminator(BB, new BranchInst(Succs[1], Default, Cond));
+  return true;
+}
+
+// removeForwardingBlock - If BB holds only an unconditional branch, make its
+// predecessors branch to its target instead, and remove it.
+//
+bool CFGSimplifier::removeForwardingBlock(BasicBlock *BB) {
+  if (BB == M->getBasicBlocks().front() || BB->getInstList().size() != 1 ||
+      !isUnconditionalBranch(BB->getTerminator()))
+    return false;
+
+  BasicBlock *Succ = CFG.getSuccessors(BB)[0];
+  if (Succ == BB || hasPHINodes(Succ)) return false;
+
+  // The predecessors may be simplified further, now that they branch to Succ
+  // (for example, they may branch to it on both sides of a condition).
+  //
+  const vector<BasicBlock*> &Preds = CFG.getPredecessors(BB);
+  WorkList.insert(WorkList.end(), Preds.begin(), Preds.end());
+
+  CFG.redirectBranches(BB, Succ);
+  CFG.removeBlock(BB);
+  Dead.insert(BB);
+  return true;
+}
+
+// hoistCommonCode - If BB branches to two blocks that it is the only
+// predecessor of, move the instructions that both of them start with into BB.
+// Both arms would have run them, so it does not matter that they now run
+// before the branch.
+//
+bool CFGSimplifier::hoistCommonCode(BasicBlock *BB) {
+  TerminatorInst *T = BB->getTerminator();
+  if (T->getInstType() != Instruction::Br || isUnconditionalBranch(T))
+    return false;
+
+  const vector<BasicBlock*> &Succs = CFG.getSuccessors(BB);
+  BasicBlock *Arm1 = Succs[0], *Arm2 = Succs[1];
+  if (Arm1 == Arm2 || Arm1 == BB || Arm2 == BB ||
+      CFG.getPredecessors(Arm1).size() != 1 ||
+      CFG.getPredecessors(Arm2).size() != 1)
+    return false;
+
+  bool Changed = false;
+  BasicBlock::InstListType &Insts = BB->getInstList();
+  BasicBlock::InstListType &Insts1 = Arm1->getInstList();
+  BasicBlock::InstListType &Insts2 = Arm2->getInstList();
+  while (true) {
+    Instruction *I1 = Insts1.front(), *I2 = Insts2.front();
+    if (I1->isTerminator() || I1->getInstType() == Instruction::PHINode ||
+        !isIdenticalInst(I1, I2))
+      break;
+
+    BasicBlock::InstListType::iterator II = Insts1.begin();
+    Insts1.remove(II);
+    II = Insts.end()-1;
+    Insts.insert(II, I1);                 // Before the branch
+
+    I2->replaceAllUsesWith(I1);
+    II = Insts2.begin();
+    delete Insts2.remove(II);
+    Changed = true;
+  }
+
+  if (Changed) {                          // The arms may be empty now
+    WorkList.push_back(Arm1);
+    WorkList.push_back(Arm2);
+  }
+  return Changed;
+}
+
+bool CFGSimplifier::run() {
+  bool Changed = false;
+  Method::BasicBlocksType &BBs = M->getBasicBlocks();
+  WorkList.insert(WorkList.end(), BBs.begin(), BBs.end());
+  reverse(WorkList.begin(), WorkList.end());   // Visit in method order
+
+  while (!WorkList.empty()) {
+    BasicBlock *BB = WorkList.back();
+    WorkList.pop_back();
+    if (Dead.count(BB) || BB->getTerminator() == 0) continue;
+
+    if (foldSameTargetBranch(BB) || foldSwitch(BB)) {
+      WorkList.push_back(BB);             // It may be a forwarding block now
+      Changed = true;
+    } else if (removeForwardingBlock(BB) || hoistCommonCode(BB)) {
+      Changed = true;
+    }
+  }
+
+  for (set<BasicBlock*>::iterator DI = Dead.begin(); DI != Dead.end(); ++DI) {
+    BBs.remove(*DI);
+    delete *DI;
+  }
+  return Changed;
+}
+
+bool DoCFGSimplification(Method *M, MethodCFG &CFG) {
+  CFGSimplifier S(M, CFG);
+  return S.run();
+}
@@ -0,0 +1,149 @@
+//===- TailRecursionElimination.cpp - Turn tail recursion into loops ------===//
+//
+// This file transforms calls of the current method (self recursion) that are
+// immediately followed by a return of the value that they produce into
+// branches back to the top of the method.  The old entry block becomes the
+// header of a loop, with a PHI node for each argument, and a new entry block
+// is put in front of it.  Recursion that is written this way then runs in a
+// constant amount of stack space.
+//
+// Specifically, this:
+//   * Transforms "%X = call M(...)" followed by "ret %X" in method M, and
+//     "call M(...)" followed by "ret void" in a method returning void, if the
+//     call has no other uses
+//   * Replaces every use of an argument with a PHI node in the loop header,
+//     whose incoming values are the argument itself (on entry to the method)
+//     and the values passed by each of the transformed calls
+//
+// Notice that:
+//   * PHI nodes do not record which block each incoming value comes from, so
+//     the new PHI nodes get one incoming value for each entry in the CFG's
+//     predecessor list of the header, in that order: the new entry block comes
+//     first, then the blocks of the transformed calls, in method order.
+//   * The allocas of the old entry block are moved into the new one, so that
+//     they are run once.  Methods with an alloca there whose size is not a
+//     constant, or whose address is used for anything but loads and stores,
+//     are left alone.
+//   * Methods whose entry block is already branched to are left alone.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Method.h"
+#include "llvm/BasicBlock.h"
+#include "llvm/iTerminators.h"
+#include "llvm/iOther.h"
+#include "llvm/iMemory.h"
+#include "llvm/Type.h"
+#include "llvm/Opt/AllOpts.h"
+
+// isTailRecursiveCall - Return true if BB ends with a call of M whose result is
+// only returned.
+//
+static bool isTailRecursiveCall(Method *M, BasicBlock *BB) {
+  BasicBlock::InstListType &Insts = BB->getInstList();
+  if (Insts.size() < 2) return false;
+  Instruction *Ret = Insts.back();
+  Instruction *Call = *(Insts.end()-2);
+
+  if (Ret->getInstType() != Instruction::Ret ||
+      Call->getInstType() != Instruction::Call ||
+      ((CallInst*)Call)->getCalledMethod() != M)
+    return false;
+
+  Value *RetVal = ((ReturnInst*)Ret)->getReturnValue();
+  if (M->getReturnType() == Type::VoidTy)
+    return RetVal == 0 && Call->use_empty();
+  return RetVal == Call && Call->use_size() == 1;
+}
+
+// canHoistAlloca - Return true if AI may be moved out of the loop, to be run
+// once instead of on every trip around it.  Every trip then uses the same
+// memory, so this is only done if the address is used for nothing but loading
+// and storing: otherwise it could be passed to the next trip, which would find
+// its own variable in it.  The size must be known before the loop, too.
+//
+static bool canHoistAlloca(AllocaInst *AI) {
+  if (AI->getArraySize() &&
+      AI->getArraySize()->getValueType() != Value::ConstantVal)
+    return false;
+
+  for (Value::use_iterator UI = AI->use_begin(); UI != AI->use_end(); ++UI) {
+    Instruction *I = (Instruction*)*UI;
+    if (I->getInstType() == Instruction::Load) continue;
+    if (I->getInstType() != Instruction::Store ||
+        ((StoreInst*)I)->getValueOperand() == AI)
+      return false;                           // The address escapes
+  }
+  return true;
+}
+
+bool DoTailRecursionElimination(Method *M) {
+  if (M->isMethodExternal()) return false;
+  Method::BasicBlocksType &BBs = M->getBasicBlocks();
+  BasicBlock *OldEntry = BBs.front();
+  if (!OldEntry->use_empty()) return false;   // Already branched to
+
+  // Find the blocks that end in a tail call, in method order...
+  vector<BasicBlock*> TailBlocks;
+  for (Method::BasicBlocksType::iterator BBI = BBs.begin(); BBI != BBs.end();
+       ++BBI)
+    if (isTailRecursiveCall(M, *BBI))
+      TailBlocks.push_back(*BBI);
+  if (TailBlocks.empty()) return false;
+
+  // The allocas of the entry block get new memory each time that they are run,
+  // so they have to be moved in front of the loop for it to run in a constant
+  // amount of stack space.
+  //
+  vector<AllocaInst*> Allocas;
+  BasicBlock::InstListType &EntryInsts = OldEntry->getInstList();
+  for (BasicBlock::InstListType::iterator II = EntryInsts.begin();
+       II != EntryInsts.end(); ++II)
+    if ((*II)->getInstType() == Instruction::Alloca) {
+      if (!canHoistAlloca((AllocaInst*)*II)) return false;
+      Allocas.push_back((AllocaInst*)*II);
+    }
+
+  // Put a new entry block in front of the old one, which becomes the header
+  // of the loop...
+  BasicBlock *NewEntry = new BasicBlock();
+  for (unsigned i = 0; i < Allocas.size(); ++i) {
+    EntryInsts.remove(Allocas[i]);
+    NewEntry->getInstList().push_back(Allocas[i]);
+  }
+  NewEntry->getInstList().push_back(new BranchInst(OldEntry));
+  BBs.push_front(NewEntry);
+
+  // Make the arguments flow through PHI nodes in the header.  The value that
+  // comes from the new entry block is the argument itself.
+  //
+  vector<PHINode*> PHIs;
+  BasicBlock::InstListType &HeaderInsts = OldEntry->getInstList();
+  BasicBlock::InstListType::iterator Pos = HeaderInsts.begin();
+  Method::ArgumentListType &Args = M->getArgumentList();
+  for (Method::ArgumentListType::iterator AI = Args.begin(); AI != Args.end();
+       ++AI) {
+    PHINode *PN = new PHINode((*AI)->getType());
+    (*AI)->replaceAllUsesWith(PN);
+    PN->addIncoming(*AI);
+    HeaderInsts.insert(Pos, PN);                // Pos now points to PN
+    ++Pos;
+    PHIs.push_back(PN);
+  }
+
+  // Replace each call and return with the values for the next trip around the
+  // loop, and a branch back to the header...
+  for (unsigned i = 0; i < TailBlocks.size(); ++i) {
+    BasicBlock::InstListType &Insts = TailBlocks[i]->getInstList();
+    CallInst *Call = (CallInst*)*(Insts.end()-2);
+    for (unsigned a = 0; a < PHIs.size(); ++a)
+      PHIs[a]->addIncoming(Call->getOperand(a+1));
+
+    BasicBlock::InstListType::iterator II = Insts.end()-1;
+    delete Insts.remove(II);                    // The return uses the call
+    II = Insts.end()-1;
+    delete Insts.remove(II);
+    Insts.push_back(new BranchInst(OldEntry));
+  }
+  return true;
+}
@@ -18,10 +18,14 @@
 #include "llvm/ConstPoolVals.h"
 #include "llvm/iOther.h"
 #include "llvm/iMemory.h"
+#include "llvm/InstVisitor.h"
 
-class AssemblyWriter : public ModuleAnalyzer {
+class AssemblyWriter : public ModuleAnalyzer<AssemblyWriter>,
+                       public InstVisitor<AssemblyWriter> {
   ostream &Out;
   SlotCalculator &Table;
+  friend class ModuleAnalyzer<AssemblyWriter>;
+  friend class InstVisitor<AssemblyWriter>;
 public:
   inline AssemblyWriter(ostream &o, SlotCalculator &Tab) : Out(o), Table(Tab) {
   }
@@ -33,16 +37,24 @@ public:
   inline void write(const ConstPoolVal *CPV) { processConstant(CPV);  }
 
 protected:
-  virtual bool visitMethod(const Method *M);
-  virtual bool processConstPool(const ConstantPool &CP, bool isMethod);
-  virtual bool processConstant(const ConstPoolVal *CPV);
-  virtual bool processMethod(const Method *M);
-  virtual bool processMethodArgument(const MethodArgument *MA);
-  virtual bool processBasicBlock(const BasicBlock *BB);
-  virtual bool processInstruction(const Instruction *I);
+  bool visitMethod(const Method *M);
+  bool processConstPool(const ConstantPool &CP, bool isMethod);
+  bool processConstant(const ConstPoolVal *CPV);
+  bool processMethod(const Method *M);
+  bool processMethodArgument(const MethodArgument *MA);
+  bool processBasicBlock(const BasicBlock *BB);
+  bool processInstruction(const Instruction *I);
 
 private :
   void writeOperand(const Value *Op, bool PrintType, bool PrintName = true);
+
+  // Instruction operand printers, called by processInstruction...
+  void visitBranchInst(BranchInst *I);
+  void visitSwitchInst(SwitchInst *I);
+  void visitReturnInst(ReturnInst *I);
+  void visitCallInst(CallInst *I);
+  void visitAllocationInst(AllocationInst *I);
+  void visitInstruction(Instruction *I);
 };
 
 
@@ -58,7 +70,7 @@ bool AssemblyWriter::processConstPool(const ConstantPool &CP, bool isMethod) {
   // Done printing arguments...
   if (isMethod) Out << ")\n";
 
-  ModuleAnalyzer::processConstPool(CP, isMethod);
+  ModuleAnalyzer<AssemblyWriter>::processConstPool(CP, isMethod);
   
   if (isMethod)
     Out << "begin";
@@ -100,7 +112,7 @@ bool AssemblyWriter::processMethod(const Method *M) {
   // Print out the return type and name...
   Out << "\n" << M->getReturnType() << " \"" << M->getName() << "\"(";
   Table.incorporateMethod(M);
-  ModuleAnalyzer::processMethod(M);
+  ModuleAnalyzer<AssemblyWriter>::processMethod(M);
   Table.purgeMethod();
   Out << "end\n";
   return false;
@@ -139,90 +151,117 @@ bool AssemblyWriter::processBasicBlock(const BasicBlock *BB) {
       Out << "<badref>\n"; 
   }
 
-  ModuleAnalyzer::processBasicBlock(BB);
+  ModuleAnalyzer<AssemblyWriter>::processBasicBlock(BB);
   return false;
 }
 
-// processInstruction - This member is called for each Instruction in a methd.
+// The operands of most instructions are printed by visitInstruction, but a few
+// instructions are formatted specially.  These are the InstVisitor methods
+// that processInstruction dispatches to.
 //
-bool AssemblyWriter::processInstruction(const Instruction *I) {
-  Out << "\t";
 
-  // Print out name if it exists...
-  if (I && I->hasName())
-    Out << "%" << I->getName() << " = ";
-
-  // Print out the opcode...
-  Out << I->getOpcode();
+// visitBranchInst - Special case conditional branches to swizzle the condition
+// out to the front.
+//
+void AssemblyWriter::visitBranchInst(BranchInst *I) {
+  if (I->isUnconditional()) {
+    visitInstruction(I);
+    return;
+  }
+  writeOperand(I->getOperand(2), true);
+  Out << ",";
+  writeOperand(I->getOperand(0), true);
+  Out << ",";
+  writeOperand(I->getOperand(1), true);
+}
 
-  // Print out the type of the operands...
-  const Value *Operand = I->getOperand(0);
-
-  // Special case conditional branches to swizzle the condition out to the front
-  if (I->getInstType() == Instruction::Br && I->getOperand(1)) {
-    writeOperand(I->getOperand(2), true);
-    Out << ",";
-    writeOperand(Operand, true);
-    Out << ",";
-    writeOperand(I->getOperand(1), true);
-
-  } else if (I->getInstType() == Instruction::Switch) {
-    // Special case switch statement to get formatting nice and correct...
-    writeOperand(Operand         , true); Out << ",";
-    writeOperand(I->getOperand(1), true); Out << " [";
-
-    for (unsigned op = 2; (Operand = I->getOperand(op)); op += 2) {
-      Out << "\n\t\t";
-      writeOperand(Operand, true); Out << ",";
-      writeOperand(I->getOperand(op+1), true);
-    }
-    Out << "\n\t]";
+// visitSwitchInst - Special case switch statement to get formatting nice and
+// correct...
+//
+void AssemblyWriter::visitSwitchInst(SwitchInst *I) {
+  writeOperand(I->getOperand(0), true); Out << ",";
+  writeOperand(I->getOperand(1), true); Out << " [";
+
+  for (Instruction::op_iterator OI = I->op_begin()+2; OI != I->op_end(); 
+       OI += 2) {
+    Out << "\n\t\t";
+    writeOperand(OI[0], true); Out << ",";
+    writeOperand(OI[1], true);
+  }
+  Out << "\n\t]";
+}
 
-  } else if (I->getInstType() == Instruction::Ret && !Operand) {
+void AssemblyWriter::visitReturnInst(ReturnInst *I) {
+  if (I->getReturnValue())
+    visitInstruction(I);
+  else
     Out << " void";
-  } else if (I->getInstType() == Instruction::Call) {
-    writeOperand(Operand, true);
-    Out << "(";
-    Operand = I->getOperand(1);
-    if (Operand) writeOperand(Operand, true);
-    for (unsigned op = 2; (Operand = I->getOperand(op)); ++op) {
-      Out << ",";
-      writeOperand(Operand, true);
-    }
-
-    Out << " )";
-  } else if (I->getInstType() == Instruction::Malloc || 
-	     I->getInstType() == Instruction::Alloca) {
-    Out << " " << ((const PointerType*)((ConstPoolType*)Operand)
-		   ->getValue())->getValueType();
-    if ((Operand = I->getOperand(1))) {
-      Out << ","; writeOperand(Operand, true);
-    }
+}
 
-  } else if (Operand) {   // Print the normal way...
+void AssemblyWriter::visitCallInst(CallInst *I) {
+  writeOperand(I->getOperand(0), true);
+  Out << "(";
+  for (Instruction::op_iterator OI = I->op_begin()+1; OI != I->op_end(); 
+       ++OI) {
+    if (OI != I->op_begin()+1) Out << ",";
+    writeOperand(*OI, true);
+  }
+  Out << " )";
+}
 
-    // PrintAllTypes - Instructions who have operands of all the same type 
-    // omit the type from all but the first operand.  If the instruction has
-    // different type operands (for example br), then they are all printed.
-    bool PrintAllTypes = false;
-    const Type *TheType = Operand->getType();
-    unsigned i;
+// visitAllocationInst - Print the type allocated, instead of the constant that
+// holds the pointer type.
+//
+void AssemblyWriter::visitAllocationInst(AllocationInst *I) {
+  Out << " " << ((const PointerType*)I->getTypeConstant()->getValue())
+                  ->getValueType();
+  if (I->getArraySize()) {
+    Out << ","; writeOperand(I->getArraySize(), true);
+  }
+}
 
-    for (i = 1; (Operand = I->getOperand(i)); i++) {
-      if (Operand->getType() != TheType) {
-	PrintAllTypes = true;       // We have differing types!  Print them all!
-	break;
-      }
+// visitInstruction - Print the operands the normal way...
+//
+void AssemblyWriter::visitInstruction(Instruction *I) {
+  if (I->getNumOperands() == 0) return;
+
+  // PrintAllTypes - Instructions who have operands of all the same type 
+  // omit the type from all but the first operand.  If the instruction has
+  // different type operands (for example br), then they are all printed.
+  bool PrintAllTypes = false;
+  const Type *TheType = I->getOperand(0)->getType();
+  Instruction::op_iterator OI;
+
+  for (OI = I->op_begin()+1; OI != I->op_end(); ++OI) {
+    if ((*OI)->getType() != TheType) {
+      PrintAllTypes = true;       // We have differing types!  Print them all!
+      break;
     }
+  }
 
-    if (!PrintAllTypes)
-      Out << " " << I->getOperand(0)->getType();
+  if (!PrintAllTypes)
+    Out << " " << TheType;
 
-    for (unsigned i = 0; (Operand = I->getOperand(i)); i++) {
-      if (i) Out << ",";
-      writeOperand(Operand, PrintAllTypes);
-    }
+  for (OI = I->op_begin(); OI != I->op_end(); ++OI) {
+    if (OI != I->op_begin()) Out << ",";
+    writeOperand(*OI, PrintAllTypes);
   }
+}
+
+// processInstruction - This member is called for each Instruction in a methd.
+//
+bool AssemblyWriter::processInstruction(const Instruction *I) {
+  Out << "\t";
+
+  // Print out name if it exists...
+  if (I && I->hasName())
+    Out << "%" << I->getName() << " = ";
+
+  // Print out the opcode...
+  Out << I->getOpcode();
+
+  // Print out the operands...
+  visit((Instruction*)I);
 
   // Print a little comment after the instruction indicating which slot it
   // occupies.
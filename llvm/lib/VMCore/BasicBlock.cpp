@@ -7,10 +7,12 @@
 #include "llvm/ValueHolderImpl.h"
 #include "llvm/BasicBlock.h"
 #include "llvm/iTerminators.h"
+#include "llvm/iOther.h"
 #include "llvm/Module.h"
 #include "llvm/Method.h"
 #include "llvm/SymbolTable.h"
 #include "llvm/Type.h"
+#include <algorithm>
 
 // Instantiate Templates - This ugliness is the price we have to pay
 // for having a ValueHolderImpl.h file seperate from ValueHolder.h!  :(
@@ -25,7 +27,7 @@ BasicBlock::BasicBlock(const string &name, Method *parent)
 }
 
 BasicBlock::~BasicBlock() {
-  dropAllReferences();
+  if (!Value::InBulkTeardown) dropAllReferences();
   InstList.delete_all();
 }
 
@@ -38,7 +40,7 @@ void BasicBlock::setName(const string &name) {
 }
 
 void BasicBlock::setParent(Method *parent) { 
-  if (getParent() && hasName())
+  if (getParent() && hasName() && !Value::InBulkTeardown)
     getParent()->getSymbolTable()->remove(this);
 
   InstList.setParent(parent);
@@ -80,12 +82,26 @@ bool BasicBlock::hasConstantPoolReferences() const {
 }
 
 
+// removePHIOperand - Edge #i into this block is going away, so remove
+// incoming value #i from each of the PHI nodes that the block starts with.
+//
+void BasicBlock::removePHIOperand(unsigned i) {
+  for (InstListType::iterator II = InstList.begin();
+       II != InstList.end() && (*II)->getInstType() == Instruction::PHINode;
+       ++II)
+    ((PHINode*)*II)->removeIncoming(i);
+}
+
 // splitBasicBlock - This splits a basic block into two at the specified
 // instruction.  Note that all instructions BEFORE the specified iterator stay
 // as part of the original basic block, an unconditional branch is added to 
 // the new BB, and the rest of the instructions in the BB are moved to the new
 // BB, including the old terminator.  This invalidates the iterator.
 //
+// The new block goes right after this one.  Its edges are the ones that this
+// block had, and no other block comes between the two, so the incoming values
+// of the PHI nodes in the successors stay in the right order.
+//
 // Note that this only works on well formed basic blocks (must have a 
 // terminator), and 'I' must not be the end of instruction list (which would
 // cause a degenerate basic block to be formed, having a terminator inside of
@@ -96,7 +112,12 @@ BasicBlock *BasicBlock::splitBasicBlock(InstListType::iterator I) {
   assert(I != InstList.end() && 
 	 "Trying to get me to create degenerate basic block!");
 
-  BasicBlock *New = new BasicBlock("", getParent());
+  assert(getParent() && "Can't split a block that is not in a method!");
+  Method::BasicBlocksType &BBs = getParent()->getBasicBlocks();
+  Method::BasicBlocksType::iterator Pos = find(BBs.begin(), BBs.end(), this);
+  ++Pos;
+  BasicBlock *New = new BasicBlock();
+  BBs.insert(Pos, New);
 
   // Go from the end of the basic block through to the iterator pointer, moving
   // to the new basic block...
@@ -5,6 +5,21 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/Opt/ConstantHandling.h"
+#include <math.h>
+
+// getShiftAmount - Set Amt to the value of V, which is the amount of a shift.
+// Returns false if V is not an integer.  Negative amounts become very large,
+// which shift every bit out.
+//
+static inline bool getShiftAmount(const ConstPoolVal *V, uint64_t &Amt) {
+  if (V->getType()->isSigned())
+    Amt = (uint64_t)((const ConstPoolSInt*)V)->getValue();
+  else if (V->getType()->isUnsigned())
+    Amt = ((const ConstPoolUInt*)V)->getValue();
+  else
+    return false;
+  return true;
+}
 
 //===----------------------------------------------------------------------===//
 //                             TemplateRules Class
@@ -44,11 +59,90 @@ class TemplateRules : public ConstRules {
     return SubClassName::Sub((const ArgType *)V1, (const ArgType *)V2);  
   }
 
+  virtual ConstPoolVal *mul(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const { 
+    return SubClassName::Mul((const ArgType *)V1, (const ArgType *)V2);  
+  }
+
+  virtual ConstPoolVal *div(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const { 
+    return SubClassName::Div((const ArgType *)V1, (const ArgType *)V2);  
+  }
+
+  virtual ConstPoolVal *rem(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const { 
+    return SubClassName::Rem((const ArgType *)V1, (const ArgType *)V2);  
+  }
+
+  virtual ConstPoolVal *and(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const { 
+    return SubClassName::And((const ArgType *)V1, (const ArgType *)V2);  
+  }
+
+  virtual ConstPoolVal *or(const ConstPoolVal *V1, 
+                           const ConstPoolVal *V2) const { 
+    return SubClassName::Or((const ArgType *)V1, (const ArgType *)V2);  
+  }
+
+  virtual ConstPoolVal *xor(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const { 
+    return SubClassName::Xor((const ArgType *)V1, (const ArgType *)V2);  
+  }
+
+  virtual ConstPoolVal *shl(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const { 
+    uint64_t Amt;
+    if (!getShiftAmount(V2, Amt)) return 0;
+    return SubClassName::Shl((const ArgType *)V1, Amt);
+  }
+
+  virtual ConstPoolVal *shr(const ConstPoolVal *V1, 
+                            const ConstPoolVal *V2) const { 
+    uint64_t Amt;
+    if (!getShiftAmount(V2, Amt)) return 0;
+    return SubClassName::Shr((const ArgType *)V1, Amt);
+  }
+
   virtual ConstPoolBool *lessthan(const ConstPoolVal *V1, 
                                   const ConstPoolVal *V2) const { 
     return SubClassName::LessThan((const ArgType *)V1, (const ArgType *)V2);
   }
 
+  // Casting operators.  ick
+  virtual ConstPoolBool *castToBool(const ConstPoolVal *V) const {
+    return SubClassName::CastToBool((const ArgType*)V);
+  }
+  virtual ConstPoolSInt *castToSByte(const ConstPoolVal *V) const {
+    return SubClassName::CastToSByte((const ArgType*)V);
+  }
+  virtual ConstPoolUInt *castToUByte(const ConstPoolVal *V) const {
+    return SubClassName::CastToUByte((const ArgType*)V);
+  }
+  virtual ConstPoolSInt *castToShort(const ConstPoolVal *V) const {
+    return SubClassName::CastToShort((const ArgType*)V);
+  }
+  virtual ConstPoolUInt *castToUShort(const ConstPoolVal *V) const {
+    return SubClassName::CastToUShort((const ArgType*)V);
+  }
+  virtual ConstPoolSInt *castToInt(const ConstPoolVal *V) const {
+    return SubClassName::CastToInt((const ArgType*)V);
+  }
+  virtual ConstPoolUInt *castToUInt(const ConstPoolVal *V) const {
+    return SubClassName::CastToUInt((const ArgType*)V);
+  }
+  virtual ConstPoolSInt *castToLong(const ConstPoolVal *V) const {
+    return SubClassName::CastToLong((const ArgType*)V);
+  }
+  virtual ConstPoolUInt *castToULong(const ConstPoolVal *V) const {
+    return SubClassName::CastToULong((const ArgType*)V);
+  }
+  virtual ConstPoolFP   *castToFloat(const ConstPoolVal *V) const {
+    return SubClassName::CastToFloat((const ArgType*)V);
+  }
+  virtual ConstPoolFP   *castToDouble(const ConstPoolVal *V) const {
+    return SubClassName::CastToDouble((const ArgType*)V);
+  }
+
   //===--------------------------------------------------------------------===//
   // Default "noop" implementations
   //===--------------------------------------------------------------------===//
@@ -64,12 +158,61 @@ class TemplateRules : public ConstRules {
     return 0;
   }
 
+  inline static ConstPoolVal *Mul(const ArgType *V1, const ArgType *V2) {
+    return 0;
+  }
+
+  inline static ConstPoolVal *Div(const ArgType *V1, const ArgType *V2) {
+    return 0;
+  }
+
+  inline static ConstPoolVal *Rem(const ArgType *V1, const ArgType *V2) {
+    return 0;
+  }
+
+  inline static ConstPoolVal *And(const ArgType *V1, const ArgType *V2) {
+    return 0;
+  }
+
+  inline static ConstPoolVal *Or(const ArgType *V1, const ArgType *V2) {
+    return 0;
+  }
+
+  inline static ConstPoolVal *Xor(const ArgType *V1, const ArgType *V2) {
+    return 0;
+  }
+
+  inline static ConstPoolVal *Shl(const ArgType *V, uint64_t Amt) { return 0; }
+  inline static ConstPoolVal *Shr(const ArgType *V, uint64_t Amt) { return 0; }
+
   inline static ConstPoolBool *LessThan(const ArgType *V1, const ArgType *V2) {
     return 0;
   }
+
+  // Casting operators.  ick
+  inline static ConstPoolBool *CastToBool  (const ArgType *V) { return 0; }
+  inline static ConstPoolSInt *CastToSByte (const ArgType *V) { return 0; }
+  inline static ConstPoolUInt *CastToUByte (const ArgType *V) { return 0; }
+  inline static ConstPoolSInt *CastToShort (const ArgType *V) { return 0; }
+  inline static ConstPoolUInt *CastToUShort(const ArgType *V) { return 0; }
+  inline static ConstPoolSInt *CastToInt   (const ArgType *V) { return 0; }
+  inline static ConstPoolUInt *CastToUInt  (const ArgType *V) { return 0; }
+  inline static ConstPoolSInt *CastToLong  (const ArgType *V) { return 0; }
+  inline static ConstPoolUInt *CastToULong (const ArgType *V) { return 0; }
+  inline static ConstPoolFP   *CastToFloat (const ArgType *V) { return 0; }
+  inline static ConstPoolFP   *CastToDouble(const ArgType *V) { return 0; }
 };
 
 
+// DEF_CAST - Define a CastToTYPE method for a rules class, which converts the
+// value of the constant to the C type CTYPE.  SRCTYPE is the C type that the
+// value of the source constant is held as.
+//
+#define DEF_CAST(TYPE, CLASS, CTYPE, SRCTYPE)                               \
+  inline static CLASS *CastTo##TYPE(const SourceClass *V) {                 \
+    return new CLASS(Type::TYPE##Ty, (CTYPE)(SRCTYPE)V->getValue());        \
+  }
+
 
 //===----------------------------------------------------------------------===//
 //                             EmptyRules Class
@@ -91,6 +234,7 @@ struct EmptyRules : public TemplateRules<ConstPoolVal, EmptyRules> {
 //
 static   // BoolTyInst is static...
 struct BoolRules : public TemplateRules<ConstPoolBool, BoolRules> {
+  typedef ConstPoolBool SourceClass;
 
   inline static ConstPoolVal *Not(const ConstPoolBool *V) { 
     return new ConstPoolBool(!V->getValue());
@@ -107,6 +251,27 @@ struct BoolRules : public TemplateRules<ConstPoolBool, BoolRules> {
     bool Result = V1->getValue() & V2->getValue();
     return new ConstPoolBool(Result);
   }
+
+  inline static ConstPoolVal *Xor(const ConstPoolBool *V1, 
+                                  const ConstPoolBool *V2) {
+    bool Result = V1->getValue() ^ V2->getValue();
+    return new ConstPoolBool(Result);
+  }
+
+  // Casting operators.  true converts to 1, and false to 0.
+  inline static ConstPoolBool *CastToBool(const ConstPoolBool *V) {
+    return new ConstPoolBool(V->getValue());
+  }
+  DEF_CAST(SByte , ConstPoolSInt, signed char   , bool)
+  DEF_CAST(UByte , ConstPoolUInt, unsigned char , bool)
+  DEF_CAST(Short , ConstPoolSInt, signed short  , bool)
+  DEF_CAST(UShort, ConstPoolUInt, unsigned short, bool)
+  DEF_CAST(Int   , ConstPoolSInt, signed int    , bool)
+  DEF_CAST(UInt  , ConstPoolUInt, unsigned int  , bool)
+  DEF_CAST(Long  , ConstPoolSInt, int64_t       , bool)
+  DEF_CAST(ULong , ConstPoolUInt, uint64_t      , bool)
+  DEF_CAST(Float , ConstPoolFP  , float         , bool)
+  DEF_CAST(Double, ConstPoolFP  , double        , bool)
 } BoolTyInst;
 
 
@@ -118,10 +283,14 @@ struct BoolRules : public TemplateRules<ConstPoolBool, BoolRules> {
 // different types.  This allows the C++ compiler to automatically generate our
 // constant handling operations in a typesafe and accurate manner.
 //
-template<class ConstPoolClass, class BuiltinType, const Type **Ty>
-struct DirectRules 
-  : public TemplateRules<ConstPoolClass, 
-                         DirectRules<ConstPoolClass, BuiltinType, Ty> > {
+// The operations that are different for integer and floating point types are
+// provided by the IntRules and FPRules subclasses below, which pass themselves
+// in as SuperClass.
+//
+template<class ConstPoolClass, class BuiltinType, const Type **Ty,
+         class SuperClass>
+struct DirectRules : public TemplateRules<ConstPoolClass, SuperClass> {
+  typedef ConstPoolClass SourceClass;
 
   inline static ConstPoolVal *Neg(const ConstPoolClass *V) { 
     return new ConstPoolClass(*Ty, -(BuiltinType)V->getValue());;
@@ -144,13 +313,204 @@ struct DirectRules
     return new ConstPoolClass(*Ty, Result);
   }
 
+  inline static ConstPoolVal *Mul(const ConstPoolClass *V1, 
+                                  const ConstPoolClass *V2) {
+    BuiltinType Result = (BuiltinType)V1->getValue() *
+                         (BuiltinType)V2->getValue();
+    return new ConstPoolClass(*Ty, Result);
+  }
+
   inline static ConstPoolBool *LessThan(const ConstPoolClass *V1, 
                                         const ConstPoolClass *V2) {
     bool Result = (BuiltinType)V1->getValue() < (BuiltinType)V2->getValue();
     return new ConstPoolBool(Result);
   } 
+
+  // Casting operators.  ick
+  inline static ConstPoolBool *CastToBool(const ConstPoolClass *V) {
+    return new ConstPoolBool((BuiltinType)V->getValue() != 0);
+  }
+  DEF_CAST(SByte , ConstPoolSInt, signed char   , BuiltinType)
+  DEF_CAST(UByte , ConstPoolUInt, unsigned char , BuiltinType)
+  DEF_CAST(Short , ConstPoolSInt, signed short  , BuiltinType)
+  DEF_CAST(UShort, ConstPoolUInt, unsigned short, BuiltinType)
+  DEF_CAST(Int   , ConstPoolSInt, signed int    , BuiltinType)
+  DEF_CAST(UInt  , ConstPoolUInt, unsigned int  , BuiltinType)
+  DEF_CAST(Long  , ConstPoolSInt, int64_t       , BuiltinType)
+  DEF_CAST(ULong , ConstPoolUInt, uint64_t      , BuiltinType)
+  DEF_CAST(Float , ConstPoolFP  , float         , BuiltinType)
+  DEF_CAST(Double, ConstPoolFP  , double        , BuiltinType)
 };
 
+
+//===----------------------------------------------------------------------===//
+//                            IntRules Class
+//===----------------------------------------------------------------------===//
+//
+// IntRules - The rules for the integer types.  Arithmetic is done on
+// uint64_t and then truncated, so that it wraps around on overflow the same way
+// for every type, signed or not.  Not flips every bit of the value.
+//
+// The sign of a value is found from its top bit, and signedness from the Type,
+// because comparing a BuiltinType with zero warns for the unsigned types.
+//
+template<class ConstPoolClass, class BuiltinType, const Type **Ty>
+struct IntRules 
+  : public DirectRules<ConstPoolClass, BuiltinType, Ty,
+                       IntRules<ConstPoolClass, BuiltinType, Ty> > {
+
+  inline static bool isNegative(BuiltinType Val) {
+    return (*Ty)->isSigned() &&
+           (((uint64_t)Val >> (sizeof(BuiltinType)*8-1)) & 1);
+  }
+
+  inline static ConstPoolVal *Neg(const ConstPoolClass *V) { 
+    BuiltinType Result = (BuiltinType)(0 - (uint64_t)V->getValue());
+    return new ConstPoolClass(*Ty, Result);
+  }
+
+  inline static ConstPoolVal *Not(const ConstPoolClass *V) { 
+    BuiltinType Result = (BuiltinType)~(uint64_t)V->getValue();
+    return new ConstPoolClass(*Ty, Result);
+  }
+
+  inline static ConstPoolVal *Add(const ConstPoolClass *V1, 
+                                  const ConstPoolClass *V2) {
+    BuiltinType Result = (BuiltinType)((uint64_t)V1->getValue() + 
+                                       (uint64_t)V2->getValue());
+    return new ConstPoolClass(*Ty, Result);
+  }
+
+  inline static ConstPoolVal *Sub(const ConstPoolClass *V1, 
+                                  const ConstPoolClass *V2) {
+    BuiltinType Result = (BuiltinType)((uint64_t)V1->getValue() - 
+                                       (uint64_t)V2->getValue());
+    return new ConstPoolClass(*Ty, Result);
+  }
+
+  inline static ConstPoolVal *Mul(const ConstPoolClass *V1, 
+                                  const ConstPoolClass *V2) {
+    BuiltinType Result = (BuiltinType)((uint64_t)V1->getValue() * 
+                                       (uint64_t)V2->getValue());
+    return new ConstPoolClass(*Ty, Result);
+  }
+
+  // Division by zero is left for run time.  Dividing the most negative signed
+  // value by -1 overflows, so it is done as a negation instead, which wraps.
+  //
+  inline static ConstPoolVal *Div(const ConstPoolClass *V1, 
+                                  const ConstPoolClass *V2) {
+    BuiltinType LHS = (BuiltinType)V1->getValue();
+    BuiltinType RHS = (BuiltinType)V2->getValue();
+    if (RHS == 0) return 0;
+    if ((*Ty)->isSigned() && RHS == (BuiltinType)-1) return Neg(V1);
+    return new ConstPoolClass(*Ty, (BuiltinType)(LHS / RHS));
+  }
+
+  inline static ConstPoolVal *Rem(const ConstPoolClass *V1, 
+                                  const ConstPoolClass *V2) {
+    BuiltinType LHS = (BuiltinType)V1->getValue();
+    BuiltinType RHS = (BuiltinType)V2->getValue();
+    if (RHS == 0) return 0;
+    if ((*Ty)->isSigned() && RHS == (BuiltinType)-1)
+      return new ConstPoolClass(*Ty, 0);
+    return new ConstPoolClass(*Ty, (BuiltinType)(LHS % RHS));
+  }
+
+  inline static ConstPoolVal *And(const ConstPoolClass *V1, 
+                                  const ConstPoolClass *V2) {
+    BuiltinType Result = (BuiltinType)V1->getValue() & 
+                         (BuiltinType)V2->getValue();
+    return new ConstPoolClass(*Ty, Result);
+  }
+
+  inline static ConstPoolVal *Or(const ConstPoolClass *V1, 
+                                 const ConstPoolClass *V2) {
+    BuiltinType Result = (BuiltinType)V1->getValue() | 
+                         (BuiltinType)V2->getValue();
+    return new ConstPoolClass(*Ty, Result);
+  }
+
+  inline static ConstPoolVal *Xor(const ConstPoolClass *V1, 
+                                  const ConstPoolClass *V2) {
+    BuiltinType Result = (BuiltinType)V1->getValue() ^ 
+                         (BuiltinType)V2->getValue();
+    return new ConstPoolClass(*Ty, Result);
+  }
+
+  // Shifting by the width of the type or more shifts every bit out.  Right
+  // shifts of signed values fill with the sign bit.
+  //
+  inline static ConstPoolVal *Shl(const ConstPoolClass *V, uint64_t Amt) {
+    BuiltinType Result = 0;
+    if (Amt < sizeof(BuiltinType)*8)
+      Result = (BuiltinType)((uint64_t)V->getValue() << Amt);
+    return new ConstPoolClass(*Ty, Result);
+  }
+
+  inline static ConstPoolVal *Shr(const ConstPoolClass *V, uint64_t Amt) {
+    BuiltinType Val = (BuiltinType)V->getValue();
+    bool Negative = isNegative(Val);
+    if (Amt >= sizeof(BuiltinType)*8)
+      return new ConstPoolClass(*Ty, Negative ? (BuiltinType)-1 : 0);
+
+    BuiltinType Result = Negative ? (BuiltinType)~(~Val >> Amt) 
+                                  : (BuiltinType)(Val >> Amt);
+    return new ConstPoolClass(*Ty, Result);
+  }
+};
+
+
+//===----------------------------------------------------------------------===//
+//                            FPRules Class
+//===----------------------------------------------------------------------===//
+//
+// FPRules - The rules for the floating point types.  Division follows the
+// IEEE rules, so it is folded even when dividing by zero.  Casts to an integer
+// type are only folded if the value fits in it.
+//
+#define DEF_FP_CAST(TYPE, CLASS, CTYPE, MIN, MAX)                           \
+  inline static CLASS *CastTo##TYPE(const ConstPoolFP *V) {                 \
+    double D = (BuiltinType)V->getValue();                                  \
+    if (!(D > (MIN) - 1.0 && D < (MAX) + 1.0)) return 0;  /* NaN too */     \
+    return new CLASS(Type::TYPE##Ty, (CTYPE)D);                             \
+  }
+
+template<class BuiltinType, const Type **Ty>
+struct FPRules 
+  : public DirectRules<ConstPoolFP, BuiltinType, Ty,
+                       FPRules<BuiltinType, Ty> > {
+
+  inline static ConstPoolVal *Div(const ConstPoolFP *V1, 
+                                  const ConstPoolFP *V2) {
+    BuiltinType Result = (BuiltinType)V1->getValue() / 
+                         (BuiltinType)V2->getValue();
+    return new ConstPoolFP(*Ty, Result);
+  }
+
+  inline static ConstPoolVal *Rem(const ConstPoolFP *V1, 
+                                  const ConstPoolFP *V2) {
+    BuiltinType Result = fmod((BuiltinType)V1->getValue(),
+                              (BuiltinType)V2->getValue());
+    return new ConstPoolFP(*Ty, Result);
+  }
+
+  DEF_FP_CAST(SByte , ConstPoolSInt, signed char   , -128.0, 127.0)
+  DEF_FP_CAST(UByte , ConstPoolUInt, unsigned char , 0.0, 255.0)
+  DEF_FP_CAST(Short , ConstPoolSInt, signed short  , -32768.0, 32767.0)
+  DEF_FP_CAST(UShort, ConstPoolUInt, unsigned short, 0.0, 65535.0)
+  DEF_FP_CAST(Int   , ConstPoolSInt, signed int    , 
+              -2147483648.0, 2147483647.0)
+  DEF_FP_CAST(UInt  , ConstPoolUInt, unsigned int  , 0.0, 4294967295.0)
+  DEF_FP_CAST(Long  , ConstPoolSInt, int64_t       , 
+              -9223372036854775808.0, 9223372036854775807.0)
+  DEF_FP_CAST(ULong , ConstPoolUInt, uint64_t      , 
+              0.0, 18446744073709551615.0)
+};
+
+#undef DEF_FP_CAST
+#undef DEF_CAST
+
 //===----------------------------------------------------------------------===//
 //                            DirectRules Subclasses
 //===----------------------------------------------------------------------===//
@@ -159,21 +519,24 @@ struct DirectRules
 // code.  Thank goodness C++ compilers are great at stomping out layers of 
 // templates... can you imagine having to do this all by hand? (/me is lazy :)
 //
-static DirectRules<ConstPoolSInt,   signed char , &Type::SByteTy>  SByteTyInst;
-static DirectRules<ConstPoolUInt, unsigned char , &Type::UByteTy>  UByteTyInst;
-static DirectRules<ConstPoolSInt,   signed short, &Type::ShortTy>  ShortTyInst;
-static DirectRules<ConstPoolUInt, unsigned short, &Type::UShortTy> UShortTyInst;
-static DirectRules<ConstPoolSInt,   signed int  , &Type::IntTy>    IntTyInst;
-static DirectRules<ConstPoolUInt, unsigned int  , &Type::UIntTy>   UIntTyInst;
-static DirectRules<ConstPoolSInt,  int64_t      , &Type::LongTy>   LongTyInst;
-static DirectRules<ConstPoolUInt, uint64_t      , &Type::ULongTy>  ULongTyInst;
-static DirectRules<ConstPoolFP  , float         , &Type::FloatTy>  FloatTyInst;
-static DirectRules<ConstPoolFP  , double        , &Type::DoubleTy> DoubleTyInst;
+static IntRules<ConstPoolSInt, signed char   , &Type::SByteTy>   SByteTyInst;
+static IntRules<ConstPoolUInt, unsigned char , &Type::UByteTy>   UByteTyInst;
+static IntRules<ConstPoolSInt, signed short  , &Type::ShortTy>   ShortTyInst;
+static IntRules<ConstPoolUInt, unsigned short, &Type::UShortTy>  UShortTyInst;
+static IntRules<ConstPoolSInt, signed int    , &Type::IntTy>     IntTyInst;
+static IntRules<ConstPoolUInt, unsigned int  , &Type::UIntTy>    UIntTyInst;
+static IntRules<ConstPoolSInt, int64_t       , &Type::LongTy>    LongTyInst;
+static IntRules<ConstPoolUInt, uint64_t      , &Type::ULongTy>   ULongTyInst;
+static FPRules<float ,  &Type::FloatTy>  FloatTyInst;
+static FPRules<double,  &Type::DoubleTy> DoubleTyInst;
 
 
 // ConstRules::find - Return the constant rules that take care of the specified
-// type.  Note that this is cached in the Type value itself, so switch statement
-// is only hit at most once per type.
+// type.  This is called once per type, by the Type ctor, which keeps the
+// result, so the switch statement is only hit at most once per type.
+//
+// The rules objects below may not have been constructed yet when a static Type
+// calls this, but only their addresses are taken here.
 //
 const ConstRules *ConstRules::find(const Type *Ty) {
   const ConstRules *Result;
@@ -191,7 +554,24 @@ const ConstRules *ConstRules::find(const Type *Ty) {
   case Type::DoubleTyID: Result = &DoubleTyInst; break;
   default:               Result = &EmptyInst;    break;
   }
-
-  Ty->setConstRules(Result);   // Cache the value for future short circuiting!
   return Result;
 }
+
+// ConstRules::castTo - Dispatch to the cast method for the destination type.
+//
+ConstPoolVal *ConstRules::castTo(const ConstPoolVal *V, const Type *Ty) const {
+  switch (Ty->getPrimitiveID()) {
+  case Type::BoolTyID:   return castToBool(V);
+  case Type::SByteTyID:  return castToSByte(V);
+  case Type::UByteTyID:  return castToUByte(V);
+  case Type::ShortTyID:  return castToShort(V);
+  case Type::UShortTyID: return castToUShort(V);
+  case Type::IntTyID:    return castToInt(V);
+  case Type::UIntTyID:   return castToUInt(V);
+  case Type::LongTyID:   return castToLong(V);
+  case Type::ULongTyID:  return castToULong(V);
+  case Type::FloatTyID:  return castToFloat(V);
+  case Type::DoubleTyID: return castToDouble(V);
+  default:               return 0;
+  }
+}
@@ -23,13 +23,22 @@ void ConstantPool::setParent(SymTabValue *STV) {
     Planes[i]->setParent(Parent);  
 }
 
+// findPlane - Return the index that the plane for the specified type UID is
+// at, or would be inserted at if it does not exist.
+//
+unsigned ConstantPool::findPlane(unsigned UID) const {
+  return lower_bound(PlaneUIDs.begin(), PlaneUIDs.end(), UID) - 
+         PlaneUIDs.begin();
+}
+
 // Constant getPlane - Returns true if the type plane does not exist, otherwise
 // updates the pointer to point to the correct plane.
 //
 bool ConstantPool::getPlane(const Type *T, const PlaneType *&Plane) const {
   unsigned Ty = T->getUniqueID();
-  if (Ty >= Planes.size()) return true;
-  Plane = Planes[Ty];
+  unsigned i = findPlane(Ty);
+  if (i == Planes.size() || PlaneUIDs[i] != Ty) return true;
+  Plane = Planes[i];
   return false;
 }
 
@@ -38,49 +47,69 @@ bool ConstantPool::getPlane(const Type *T, const PlaneType *&Plane) const {
 //
 bool ConstantPool::getPlane(const Type *T, PlaneType *&Plane) {
   unsigned Ty = T->getUniqueID();
-  if (Ty >= Planes.size()) return true;
-  Plane = Planes[Ty];
+  unsigned i = findPlane(Ty);
+  if (i == Planes.size() || PlaneUIDs[i] != Ty) return true;
+  Plane = Planes[i];
   return false;
 }
 
-void ConstantPool::resize(unsigned size) {
-  unsigned oldSize = Planes.size();
-  Planes.resize(size, 0);
-  while (oldSize < size)
-    Planes[oldSize++] = new PlaneType(Parent, Parent);
-}
-
 ConstantPool::PlaneType &ConstantPool::getPlane(const Type *T) {
   unsigned Ty = T->getUniqueID();
-  if (Ty >= Planes.size()) resize(Ty+1);
-  return *Planes[Ty];
+  unsigned i = findPlane(Ty);
+  if (i == Planes.size() || PlaneUIDs[i] != Ty) {
+    Planes.insert(Planes.begin()+i, new PlaneType(Parent, Parent));
+    PlaneUIDs.insert(PlaneUIDs.begin()+i, Ty);
+  }
+  return *Planes[i];
 }
 
 // insert - Add constant into the symbol table...
 void ConstantPool::insert(ConstPoolVal *N) {
-  unsigned Ty = N->getType()->getUniqueID();
-  if (Ty >= Planes.size()) resize(Ty+1);
-  Planes[Ty]->push_back(N);
+  getPlane(N->getType()).push_back(N);
 }
 
 bool ConstantPool::remove(ConstPoolVal *N) {
-  unsigned Ty = N->getType()->getUniqueID();
-  if (Ty >= Planes.size()) return true;     // Doesn't contain any of that type
+  PlaneType *P;
+  if (getPlane(N->getType(), P)) return true;  // No constants of that type
 
-  PlaneType::iterator I = ::find(Planes[Ty]->begin(), Planes[Ty]->end(), N);
-  if (I == Planes[Ty]->end()) return true;
-  Planes[Ty]->remove(I);
+  PlaneType::iterator I = ::find(P->begin(), P->end(), N);
+  if (I == P->end()) return true;
+  P->remove(I);
   return false;
 }
 
 void ConstantPool::delete_all() {
-  dropAllReferences();
+  if (!Value::InBulkTeardown) dropAllReferences();
   for (unsigned i = 0; i < Planes.size(); i++) {
     Planes[i]->delete_all();
     Planes[i]->setParent(0);
     delete Planes[i];
   }
   Planes.clear();
+  PlaneUIDs.clear();
+}
+
+// sortPlanes - The new UID of a plane's type is found from the constants in
+// it, so empty planes are deleted.
+//
+void ConstantPool::sortPlanes() {
+  vector<pair<unsigned, PlaneType*> > Sorted;
+  for (unsigned i = 0; i < Planes.size(); i++)
+    if (Planes[i]->empty()) {
+      Planes[i]->setParent(0);
+      delete Planes[i];
+    } else {
+      const Type *Ty = Planes[i]->front()->getType();
+      Sorted.push_back(make_pair(Ty->getUniqueID(), Planes[i]));
+    }
+  sort(Sorted.begin(), Sorted.end());
+
+  Planes.resize(Sorted.size());
+  PlaneUIDs.resize(Sorted.size());
+  for (unsigned i = 0; i < Sorted.size(); i++) {
+    PlaneUIDs[i] = Sorted[i].first;
+    Planes[i] = Sorted[i].second;
+  }
 }
 
 void ConstantPool::dropAllReferences() {
@@ -220,8 +249,10 @@ ConstPoolArray::ConstPoolArray(const ArrayType *T,
   : ConstPoolVal(T, Name) {
   for (unsigned i = 0; i < V.size(); i++) {
     assert(V[i]->getType() == T->getElementType());
-    Val.push_back(ConstPoolUse(V[i], this));
+    Val.push_back(Use(V[i], this));
   }
+  if (!Val.empty()) Operands = &Val[0];
+  NumOperands = Val.size();
 }
 
 ConstPoolStruct::ConstPoolStruct(const StructType *T, 
@@ -232,8 +263,10 @@ ConstPoolStruct::ConstPoolStruct(const StructType *T,
 
   for (unsigned i = 0; i < V.size(); i++) {
     assert(V[i]->getType() == ETypes[i]);
-    Val.push_back(ConstPoolUse(V[i], this));
+    Val.push_back(Use(V[i], this));
   }
+  if (!Val.empty()) Operands = &Val[0];
+  NumOperands = Val.size();
 }
 
 
@@ -267,13 +300,17 @@ ConstPoolType::ConstPoolType(const ConstPoolType &CPT)
 ConstPoolArray::ConstPoolArray(const ConstPoolArray &CPA)
   : ConstPoolVal(CPA.getType()) {
   for (unsigned i = 0; i < CPA.Val.size(); i++)
-    Val.push_back(ConstPoolUse((ConstPoolVal*)CPA.Val[i], this));
+    Val.push_back(Use(CPA.Val[i], this));
+  if (!Val.empty()) Operands = &Val[0];
+  NumOperands = Val.size();
 }
 
 ConstPoolStruct::ConstPoolStruct(const ConstPoolStruct &CPS)
   : ConstPoolVal(CPS.getType()) {
   for (unsigned i = 0; i < CPS.Val.size(); i++)
-    Val.push_back(ConstPoolUse((ConstPoolVal*)CPS.Val[i], this));
+    Val.push_back(Use(CPS.Val[i], this));
+  if (!Val.empty()) Operands = &Val[0];
+  NumOperands = Val.size();
 }
 
 //===----------------------------------------------------------------------===//
@@ -306,11 +343,11 @@ string ConstPoolType::getStrValue() const {
 string ConstPoolArray::getStrValue() const {
   string Result = "[";
   if (Val.size()) {
-    Result += " " + Val[0]->getType()->getName() + 
-	      " " + Val[0]->getStrValue();
+    Result += " " + getElement(0)->getType()->getName() + 
+	      " " + getElement(0)->getStrValue();
     for (unsigned i = 1; i < Val.size(); i++)
-      Result += ", " + Val[i]->getType()->getName() + 
-	         " " + Val[i]->getStrValue();
+      Result += ", " + getElement(i)->getType()->getName() + 
+	         " " + getElement(i)->getStrValue();
   }
 
   return Result + " ]";
@@ -319,11 +356,11 @@ string ConstPoolArray::getStrValue() const {
 string ConstPoolStruct::getStrValue() const {
   string Result = "{";
   if (Val.size()) {
-    Result += " " + Val[0]->getType()->getName() + 
-	      " " + Val[0]->getStrValue();
+    Result += " " + getElement(0)->getType()->getName() + 
+	      " " + getElement(0)->getStrValue();
     for (unsigned i = 1; i < Val.size(); i++)
-      Result += ", " + Val[i]->getType()->getName() + 
-	         " " + Val[i]->getStrValue();
+      Result += ", " + getElement(i)->getType()->getName() + 
+	         " " + getElement(i)->getStrValue();
   }
 
   return Result + " }";
@@ -362,7 +399,7 @@ bool ConstPoolArray::equals(const ConstPoolVal *V) const {
   ConstPoolArray *AV = (ConstPoolArray*)V;
   if (Val.size() != AV->Val.size()) return false;
   for (unsigned i = 0; i < Val.size(); i++)
-    if (!Val[i]->equals(AV->Val[i])) return false;
+    if (!getElement(i)->equals(AV->getElement(i))) return false;
 
   return true;
 }
@@ -372,7 +409,7 @@ bool ConstPoolStruct::equals(const ConstPoolVal *V) const {
   ConstPoolStruct *SV = (ConstPoolStruct*)V;
   if (Val.size() != SV->Val.size()) return false;
   for (unsigned i = 0; i < Val.size(); i++)
-    if (!Val[i]->equals(SV->Val[i])) return false;
+    if (!getElement(i)->equals(SV->getElement(i))) return false;
 
   return true;
 }
@@ -423,11 +460,7 @@ bool ConstPoolFP::isValueValidForType(const Type *Ty, double Val) {
   default:
     return false;         // These can't be represented as floating point!
 
-    // TODO: Figure out how to test if a double can be cast to a float!
-    /*
-  case Type::FloatTyID:
-    return (Val <= UINT8_MAX);
-    */
+  case Type::FloatTyID:     // Too large values are infinities as floats
   case Type::DoubleTyID:
     return true;          // This is the largest type...
   }
@@ -26,12 +26,11 @@ Method::Method(const MethodType *Ty, const string &name)
 }
 
 Method::~Method() {
-  dropAllReferences();    // After this it is safe to delete instructions.
+  // After this it is safe to delete instructions.  If the whole module is
+  // being deleted, the references are just left to die with it.
+  if (!Value::InBulkTeardown) dropAllReferences();
 
-  // TODO: Should remove from the end, not the beginning of vector!
-  BasicBlocksType::iterator BI = BasicBlocks.begin();
-  while ((BI = BasicBlocks.begin()) != BasicBlocks.end())
-    delete BasicBlocks.remove(BI);
+  BasicBlocks.delete_all();
 
   // Delete all of the method arguments and unlink from symbol table...
   ArgumentList.delete_all();
@@ -61,6 +60,17 @@ const MethodType *Method::getMethodType() const {
   return (const MethodType *)getType();
 }
 
+// setMethodType - The module's symbol table keeps names in a plane per type,
+// so the name has to be moved to the plane of the new type.
+//
+void Method::setMethodType(const MethodType *Ty) {
+  assert(Ty->isMethodType() && "Method signature must be of method type!");
+  Module *P = getParent();
+  if (P && hasName()) P->getSymbolTable()->remove(this);
+  setType(Ty);
+  if (P && hasName()) P->getSymbolTableSure()->insert(this);
+}
+
 // dropAllReferences() - This function causes all the subinstructions to "let
 // go" of all references that they are maintaining.  This allows one to
 // 'delete' a whole class at a time, even though there may be circular
@@ -44,23 +44,32 @@ PHINode::PHINode(const Type *Ty, const string &name)
 PHINode::PHINode(const PHINode &PN) 
   : Instruction(PN.getType(), Instruction::PHINode) {
   
+  IncomingValues.reserve(PN.IncomingValues.size());
   for (unsigned i = 0; i < PN.IncomingValues.size(); i++)
     IncomingValues.push_back(Use(PN.IncomingValues[i], this));
+  if (!IncomingValues.empty()) Operands = &IncomingValues[0];
+  NumOperands = IncomingValues.size();
 }
 
 void PHINode::dropAllReferences() {
   IncomingValues.clear();
+  Operands = 0; NumOperands = 0;
 }
 
 bool PHINode::setOperand(unsigned i, Value *Val) {
   assert(Val && "PHI node must only reference nonnull definitions!");
-  if (i >= IncomingValues.size()) return false;
-
-  IncomingValues[i] = Val;
-  return true;
+  return Instruction::setOperand(i, Val);
 }
 
 void PHINode::addIncoming(Value *D) {
   IncomingValues.push_back(Use(D, this));
+  Operands = &IncomingValues[0];          // The vector may have moved...
+  NumOperands = IncomingValues.size();
 }
 
+void PHINode::removeIncoming(unsigned i) {
+  assert(i < IncomingValues.size() && "Incoming value out of range!");
+  IncomingValues.erase(IncomingValues.begin()+i);
+  Operands = IncomingValues.empty() ? 0 : &IncomingValues[0];
+  NumOperands = IncomingValues.size();
+}
@@ -14,13 +14,74 @@
 Instruction::Instruction(const Type *ty, unsigned it, const string &Name) 
   : User(ty, Value::InstructionVal, Name) {
   Parent = 0;
-  iType = it;
+  SubclassData = it;
+  assert(SubclassData == it && "Opcode does not fit in SubclassData!");
 }
 
 Instruction::~Instruction() {
   assert(getParent() == 0 && "Instruction still embeded in basic block!");
 }
 
+bool Instruction::setOperand(unsigned i, Value *Val) {
+  if (i >= NumOperands) return false;
+  Operands[i] = Val;
+  return true;
+}
+
+void Instruction::dropAllReferences() {
+  for (unsigned i = 0; i < NumOperands; ++i)
+    Operands[i] = 0;
+}
+
+// OpcodeNames - The names of the instructions, indexed by opcode.  This must be
+// kept in sync with the opcode enums in Instruction.h.
+//
+static const char *const OpcodeNames[] = {
+  "<invalid>",
+
+  // Terminators
+  "ret", "br", "switch",
+
+  // Unary operators
+  "neg", "not",
+  "tobool",
+  "toubyte", "tosbyte", "toushort", "toshort",
+  "touint", "toint", "toulong", "tolong",
+  "tofloat", "todouble", "toarray", "topointer",
+
+  // Binary operators
+  "add", "sub", "mul", "div", "rem",
+  "and", "or", "xor",
+  "seteq", "setne", "setle", "setge", "setlt", "setgt",
+
+  // Memory operators
+  "malloc", "free", "alloca", "load", "store", "getfield", "putfield",
+
+  // Other operators
+  "phi", "call", "shl", "shr",
+
+  "<invalid>",                    // NumOps
+  "userop1", "userop2",
+};
+
+const char *Instruction::getOpcodeName(unsigned Opcode) {
+  assert(sizeof(OpcodeNames)/sizeof(OpcodeNames[0]) == UserOp2+1 &&
+         "OpcodeNames is out of sync with the opcode enums!");
+  if (Opcode > UserOp2) return "<invalid>";
+  return OpcodeNames[Opcode];
+}
+
+bool Instruction::isCommutative(unsigned Opcode) {
+  switch (Opcode) {
+  case Add: case Mul:
+  case And: case Or: case Xor:
+  case SetEQ: case SetNE:
+    return true;
+  default:
+    return false;
+  }
+}
+
 // Specialize setName to take care of symbol table majik
 void Instruction::setName(const string &name) {
   BasicBlock *P = 0; Method *PP = 0;
@@ -37,6 +98,14 @@ Instruction *Instruction::getBinaryOperator(unsigned Op, Value *S1, Value *S2) {
   case Sub:
     return new SubInst(S1, S2);
 
+  case Mul:
+  case Div:
+  case Rem:
+  case And:
+  case Or:
+  case Xor:
+    return new GenericBinaryInst((BinaryOps)Op, S1, S2);
+
   case SetLT:
   case SetGT:
   case SetLE:
@@ -54,6 +123,16 @@ Instruction *Instruction::getBinaryOperator(unsigned Op, Value *S1, Value *S2) {
 
 Instruction *Instruction::getUnaryOperator(unsigned Op, Value *Source) {
   switch (Op) {
+  case Neg:
+  case Not:
+  case ToBoolTy:
+  case ToUByteTy:  case ToSByteTy:
+  case ToUShortTy: case ToShortTy:
+  case ToUInt:     case ToInt:
+  case ToULongTy:  case ToLongTy:
+  case ToFloatTy:  case ToDoubleTy:
+    return new GenericUnaryInst((UnaryOps)Op, Source);
+
   default:
     cerr << "Don't know how to GetUnaryOperator " << Op << endl;
     return 0;
@@ -9,6 +9,9 @@
 #include "llvm/BasicBlock.h"
 #include "llvm/Method.h"
 #include "llvm/Module.h"
+#include "llvm/TypeContext.h"
+#include "llvm/ConstPoolVals.h"
+#include "llvm/SymbolTable.h"
 
 // Instantiate Templates - This ugliness is the price we have to pay
 // for having a DefHolderImpl.h file seperate from DefHolder.h!  :(
@@ -17,13 +20,64 @@ template class ValueHolder<Method, Module>;
 
 Module::Module()
   : SymTabValue(0/*TODO: REAL TYPE*/, Value::ModuleVal, ""),
-    MethodList(this, this) {
+    MethodList(this, this), Context(TypeContext::getCurrent()) {
 }
 
+#ifndef NDEBUG
+// isUsedOutside - Return true if V is used by anything that is not part of M:
+// an instruction in one of its methods, or a constant in its constant pools.
+//
+static bool isUsedOutside(const Value *V, const Module *M) {
+  for (Value::use_const_iterator I = V->use_begin(); I != V->use_end(); ++I) {
+    const User *U = *I;
+    if (U->getValueType() == Value::InstructionVal) {
+      const BasicBlock *BB = ((const Instruction*)U)->getParent();
+      if (BB == 0 || BB->getParent() == 0 || BB->getParent()->getParent() != M)
+        return true;
+    } else if (U->getValueType() == Value::ConstantVal) {
+      const SymTabValue *P = ((const ConstPoolVal*)U)->getParent();
+      if (P != M && (P == 0 || P->getValueType() != Value::MethodVal ||
+                     ((const Method*)P)->getParent() != M))
+        return true;
+    } else {
+      return true;
+    }
+  }
+  return false;
+}
+#endif
+
 Module::~Module() {
-  dropAllReferences();
+  // Nothing outside of the module uses anything in it, so everything can be
+  // deleted without dropping references first or unlinking uses and names one
+  // at a time.  Debug builds check that this is so for the module level 
+  // values, which is cheap, instead of for every value.
+  //
+#ifndef NDEBUG
+  assert(use_empty() && "Module is still used!");
+  for (MethodListType::iterator MI = MethodList.begin(); 
+       MI != MethodList.end(); ++MI)
+    assert(!isUsedOutside(*MI, this) && "Method used outside of its module!");
+
+  ConstantPool &CP = getConstantPool();
+  for (ConstantPool::plane_iterator PI = CP.begin(); PI != CP.end(); ++PI)
+    for (ConstantPool::PlaneType::iterator I = (*PI)->begin(); 
+         I != (*PI)->end(); ++I)
+      assert(!isUsedOutside(*I, this) && "Constant used outside of module!");
+#endif
+
+  // The constant pool is deleted here, while the flag is still set, so that
+  // SymTabValue finds it empty.  The names in the symbol table all belong to
+  // values that are gone now, so they are dropped in one go.
+  //
+  bool WasInBulkTeardown = Value::InBulkTeardown;
+  Value::InBulkTeardown = true;
   MethodList.delete_all();
   MethodList.setParent(0);
+  getConstantPool().delete_all();
+  getConstantPool().setParent(0);
+  if (SymbolTable *ST = getSymbolTable()) ST->clear();
+  Value::InBulkTeardown = WasInBulkTeardown;
 }
 
 
@@ -0,0 +1,335 @@
+//===-- Pass.cpp - Implement the PassManager class ---------------*- C++ -*--=//
+//
+// This file implements the PassManager class, which runs passes over a module
+// and caches the analyses that they use.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Pass.h"
+#include "llvm/Module.h"
+#include "llvm/Method.h"
+#include "llvm/Instruction.h"
+#include "llvm/ConstPoolVals.h"
+#include "llvm/TypeContext.h"
+#include "llvm/Tools/ThreadPool.h"
+#include <algorithm>
+#include <map>
+
+bool AnalysisUsage::isPreserved(AnalysisID ID) const {
+  return PreservesAll ||
+         find(Preserved.begin(), Preserved.end(), ID) != Preserved.end();
+}
+
+PassManager::~PassManager() {
+  clearCache();
+  for (unsigned i = 0; i < Passes.size(); ++i)
+    delete Passes[i];
+  delete Pool;
+}
+
+void PassManager::setNumThreads(unsigned NumThreads) {
+  delete Pool;
+  Pool = NumThreads > 1 ? new ThreadPool(NumThreads) : 0;
+}
+
+void PassManager::clearCache() {
+  for (CacheType::iterator I = Cache.begin(); I != Cache.end(); ++I)
+    delete I->second;
+  Cache.clear();
+}
+
+// getAnalysis - Look the analysis up in the cache, and compute it if it is not
+// there.  While methods are being run in parallel, each thread only computes 
+// analyses of its own method, so the cache is only locked while it is being
+// looked at, not while an analysis is computed.
+//
+AnalysisResult *PassManager::getAnalysis(AnalysisID ID, Method *M) {
+  assert(CurModule && "Analyses are only available while passes run!");
+  if (!ID->isMethodAnalysis)
+    M = 0;
+  else
+    assert(M && "Method level analysis requested without a method!");
+
+  pair<const Method*, AnalysisID> Key(M, ID);
+  {
+    MutexLocker L(CacheLock);
+    CacheType::iterator I = Cache.find(Key);
+    if (I != Cache.end()) return I->second;
+  }
+
+  assert((M || !InParallel) &&
+         "Module level analyses must be required by parallel safe passes!");
+  AnalysisResult *Result = ID->Create(CurModule, M);
+
+  MutexLocker L(CacheLock);
+  return Cache[Key] = Result;
+}
+
+// dropAnalyses - Throw away the cached analyses of method M (or the module
+// level analyses if M is null) that are not preserved by AU.  The cache must
+// be locked.
+//
+void PassManager::dropAnalyses(const Method *M, const AnalysisUsage &AU) {
+  CacheType::iterator I = Cache.lower_bound(make_pair(M, (AnalysisID)0));
+  while (I != Cache.end() && I->first.first == M)
+    if (!AU.isPreserved(I->first.second)) {
+      delete I->second;
+      Cache.erase(I++);
+    } else {
+      ++I;
+    }
+}
+
+// invalidate - Pass P has just modified method M, or the whole module if M is
+// null.  Throw away all of the cached analyses of the changed code that P does
+// not preserve.  Module level analyses depend on every method, so they are
+// thrown away whatever was changed, unless MethodOnly is set.
+//
+void PassManager::invalidate(const Pass *P, const Method *M, bool MethodOnly) {
+  AnalysisUsage AU;
+  P->getAnalysisUsage(AU);
+  MutexLocker L(CacheLock);
+
+  if (M == 0) {
+    for (CacheType::iterator I = Cache.begin(); I != Cache.end(); )
+      if (!AU.isPreserved(I->first.second)) {
+        delete I->second;
+        Cache.erase(I++);
+      } else {
+        ++I;
+      }
+  } else {
+    dropAnalyses(M, AU);
+    if (!MethodOnly) dropAnalyses(0, AU);
+  }
+}
+
+// runMethodThroughPipeline - Run Meth through each of Passes[First, Last) in
+// turn.  PassChanged[i] is set if Passes[First+i] changed the method.
+//
+void PassManager::runMethodThroughPipeline(unsigned First, unsigned Last, 
+                                           Method *Meth,
+                                           const vector<AnalysisUsage> &Usage,
+                                           unsigned char *PassChanged) {
+  for (unsigned i = First; i < Last; ++i) {
+    // Make sure the required analyses are available before the pass runs...
+    const vector<AnalysisID> &Required = Usage[i-First].getRequired();
+    for (unsigned r = 0; r < Required.size(); ++r)
+      getAnalysis(Required[r], Meth);
+
+    if (Passes[i]->doPerMethodWork(Meth)) {
+      PassChanged[i-First] = true;
+      invalidate(Passes[i], Meth, InParallel);
+    }
+  }
+}
+
+// ParallelPipeline - Describes a pipeline being run over all of the methods of
+// a module by the ThreadPool.
+//
+struct ParallelPipeline {
+  PassManager *PM;
+  unsigned First, Last;
+  const vector<AnalysisUsage> *Usage;
+  vector<Method*> Methods;
+  vector<unsigned char> PassChanged;  // Indexed by MethodNo*(Last-First)+Pass
+
+  static void runTask(void *Arg, unsigned MethodNo) {
+    ParallelPipeline &PP = *(ParallelPipeline*)Arg;
+    TypeContext::Scope S(PP.PM->CurModule->getTypeContext());
+    PP.PM->runMethodThroughPipeline(PP.First, PP.Last, PP.Methods[MethodNo], 
+                                    *PP.Usage, 
+                                 &PP.PassChanged[MethodNo*(PP.Last-PP.First)]);
+  }
+};
+
+// isSharedValue - Return true if V may be used by more than one method of M,
+// so that the order of its use list depends on how the methods were scheduled.
+//
+static bool isSharedValue(const Value *V, const Module *M) {
+  switch (V->getValueType()) {
+  case Value::TypeVal:
+  case Value::MethodVal:   return true;
+  case Value::ConstantVal: return ((const ConstPoolVal*)V)->getParent() == M;
+  default:                 return false;
+  }
+}
+
+// SortSharedUseLists - While the methods run in parallel, each thread adds the
+// instructions that it makes use of module level values to their use lists as
+// it goes, so their order depends on the schedule.  Put the instructions back
+// into the order of the methods, and of the instructions and operands in them.
+// Uses by anything else are only added by module passes, so they keep their
+// order, in front of the instructions.  Instructions that are not in any
+// method (ones that a pass has taken out of their block, but not deleted yet)
+// are not found by the walk, so they keep their uses too, at the end.
+//
+static void SortSharedUseLists(Module *M) {
+  map<Value*, vector<User*> > InstUses;
+  Module::MethodListType &Methods = M->getMethodList();
+  for (Module::MethodListType::iterator MI = Methods.begin();
+       MI != Methods.end(); ++MI)
+    for (Method::inst_iterator I = (*MI)->inst_begin();
+         I != (*MI)->inst_end(); ++I)
+      for (unsigned i = 0; i < (*I)->getNumOperands(); ++i) {
+        Value *Op = (*I)->getOperand(i);
+        if (Op && isSharedValue(Op, M))
+          InstUses[Op].push_back(*I);
+      }
+
+  for (map<Value*, vector<User*> >::iterator VI = InstUses.begin();
+       VI != InstUses.end(); ++VI) {
+    Value *V = VI->first;
+    map<User*, unsigned> NumFound;            // Uses found by the walk
+    for (unsigned i = 0; i < VI->second.size(); ++i)
+      ++NumFound[VI->second[i]];
+
+    vector<User*> Others, Detached;
+    for (Value::use_iterator UI = V->use_begin(); UI != V->use_end(); ) {
+      User *U = V->use_remove(UI);            // UI now points to the next use
+      if (U->getValueType() != Value::InstructionVal)
+        Others.push_back(U);
+      else if (NumFound[U] == 0)
+        Detached.push_back(U);
+      else
+        --NumFound[U];
+    }
+
+    for (unsigned i = 0; i < Others.size(); ++i)
+      V->use_push_back(Others[i]);
+    for (unsigned i = 0; i < VI->second.size(); ++i)
+      V->use_push_back(VI->second[i]);
+    for (unsigned i = 0; i < Detached.size(); ++i)
+      V->use_push_back(Detached[i]);
+  }
+}
+
+// runPipelineInParallel - Run the methods through a pipeline of parallel safe 
+// passes on all of the threads of the pool.  
+//
+// Module level analyses are computed before any method is changed, and they
+// are not thrown away until every method has been through the pipeline, so 
+// every method sees the same module level information however the methods are
+// scheduled.  Afterwards the use lists of the module level values are put into
+// a fixed order.  This is all done even when there is only one thread, so that
+// the result does not depend on the number of threads.
+//
+void PassManager::runPipelineInParallel(unsigned First, unsigned Last,
+                                        Module *M,
+                                        const vector<AnalysisUsage> &Usage) {
+  for (unsigned i = First; i < Last; ++i) {
+    const vector<AnalysisID> &Required = Usage[i-First].getRequired();
+    for (unsigned r = 0; r < Required.size(); ++r)
+      if (!Required[r]->isMethodAnalysis)
+        getAnalysis(Required[r], 0);
+  }
+
+  ParallelPipeline PP;
+  PP.PM = this;
+  PP.First = First;
+  PP.Last = Last;
+  PP.Usage = &Usage;
+  Module::MethodListType &Methods = M->getMethodList();
+  for (Module::MethodListType::iterator MI = Methods.begin();
+       MI != Methods.end(); ++MI)
+    PP.Methods.push_back(*MI);
+  PP.PassChanged.resize(PP.Methods.size()*(Last-First));
+
+  InParallel = true;
+  if (Pool) {
+    Value::LockUseLists = true;
+    Pool->run(PP.Methods.size(), ParallelPipeline::runTask, &PP);
+    Value::LockUseLists = false;
+  } else {
+    for (unsigned m = 0; m < PP.Methods.size(); ++m)
+      ParallelPipeline::runTask(&PP, m);
+  }
+  InParallel = false;
+  SortSharedUseLists(M);
+
+  // Now that the threads are done, find out which passes changed anything,
+  // and throw away the module level analyses that they did not preserve...
+  //
+  for (unsigned i = First; i < Last; ++i) {
+    bool PassChanged = false;
+    for (unsigned m = 0; m < PP.Methods.size(); ++m)
+      PassChanged |= PP.PassChanged[m*(Last-First) + i-First];
+
+    if (PassChanged) {
+      Changed[i] = true;
+      MutexLocker L(CacheLock);
+      dropAnalyses(0, Usage[i-First]);
+    }
+  }
+}
+
+// runPipeline - Run Passes[First, Last) over the module, one method at a
+// time.
+//
+void PassManager::runPipeline(unsigned First, unsigned Last, Module *M) {
+  vector<AnalysisUsage> Usage(Last-First);
+  bool ParallelSafe = true;
+  for (unsigned i = First; i < Last; ++i) {
+    Passes[i]->getAnalysisUsage(Usage[i-First]);
+    ParallelSafe &= Passes[i]->isParallelSafe();
+  }
+
+  for (unsigned i = First; i < Last; ++i)
+    if (Passes[i]->doPassInitialization(M)) {
+      Changed[i] = true;
+      invalidate(Passes[i], 0);
+    }
+
+  if (ParallelSafe) {
+    runPipelineInParallel(First, Last, M, Usage);
+  } else {
+    vector<unsigned char> PassChanged(Last-First);
+    Module::MethodListType &Methods = M->getMethodList();
+    for (Module::MethodListType::iterator MI = Methods.begin();
+         MI != Methods.end(); ++MI)
+      runMethodThroughPipeline(First, Last, *MI, Usage, &PassChanged[0]);
+
+    for (unsigned i = First; i < Last; ++i)
+      if (PassChanged[i-First]) Changed[i] = true;
+  }
+
+  for (unsigned i = First; i < Last; ++i)
+    if (Passes[i]->doPassFinalization(M)) {
+      Changed[i] = true;
+      invalidate(Passes[i], 0);
+    }
+}
+
+// run - Run the passes in order.  Runs of consecutive passes that may be
+// pipelined are run together, and module passes are run on their own.
+//
+bool PassManager::run(Module *M) {
+  TypeContext::Scope S(M->getTypeContext());   // Create types in M's context
+  CurModule = M;
+  for (unsigned i = 0; i < Passes.size(); ++i) {
+    Passes[i]->Resolver = this;
+    Changed[i] = false;
+  }
+
+  unsigned First = 0;
+  while (First < Passes.size()) {
+    unsigned Last = First+1;
+    if (!Passes[First]->isModulePass())
+      while (Last < Passes.size() && !Passes[Last]->isModulePass())
+        ++Last;
+
+    runPipeline(First, Last, M);
+    First = Last;
+  }
+
+  // The analyses are only good for this module...
+  clearCache();
+  CurModule = 0;
+
+  bool AnyChanged = false;
+  for (unsigned i = 0; i < Passes.size(); ++i) {
+    Passes[i]->Resolver = 0;
+    AnyChanged |= Changed[i];
+  }
+  return AnyChanged;
+}
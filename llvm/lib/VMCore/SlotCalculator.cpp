@@ -125,7 +125,8 @@ bool SlotCalculator::processMethodArgument(const MethodArgument *MA) {
 
 bool SlotCalculator::processBasicBlock(const BasicBlock *BB) {
   insertVal(BB);
-  ModuleAnalyzer::processBasicBlock(BB);  // Lets visit the instructions too!
+  // Lets visit the instructions too!
+  ModuleAnalyzer<SlotCalculator>::processBasicBlock(BB);
   return false;
 }
 
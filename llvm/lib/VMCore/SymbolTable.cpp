@@ -13,6 +13,7 @@
 
 SymbolTable::~SymbolTable() {
 #ifndef NDEBUG   // Only do this in -g mode...
+  if (Value::InBulkTeardown) return;   // The names were left to die with it
   bool Good = true;
   for (iterator i = begin(); i != end(); i++) {
     if (i->second.begin() != i->second.end()) {
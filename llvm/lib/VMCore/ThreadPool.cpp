@@ -0,0 +1,178 @@
+//===-- ThreadPool.cpp - Run independent tasks on several threads -*- C++ -*-=//
+//
+// This file implements the ThreadPool class.
+//
+//===----------------------------------------------------------------------===//
+
+#include "llvm/Tools/ThreadPool.h"
+#include <unistd.h>             // for sysconf
+#include <assert.h>
+
+// ThreadStart - The argument passed to each thread when it is created.
+//
+struct ThreadStart {
+  ThreadPool *Pool;
+  unsigned ThreadNo;
+};
+
+ThreadPool::ThreadPool(unsigned NumThreads) 
+  : CurFn(0), CurArg(0), Generation(0), NumBusy(0), ShuttingDown(false) {
+  if (NumThreads == 0) NumThreads = 1;
+  pthread_mutex_init(&StateLock, 0);
+  pthread_cond_init(&WorkReady, 0);
+  pthread_cond_init(&WorkDone, 0);
+
+  for (unsigned i = 0; i < NumThreads; ++i)
+    Queues.push_back(new WorkQueue());
+
+  for (unsigned i = 1; i < NumThreads; ++i) {
+    ThreadStart *TS = new ThreadStart();
+    TS->Pool = this;
+    TS->ThreadNo = i;
+
+    pthread_t T;
+    if (pthread_create(&T, 0, threadMain, TS)) {
+      delete TS;          // Make do with the threads we have...
+      break;
+    }
+    Threads.push_back(T);
+  }
+
+  // Only keep queues for threads that exist...
+  while (Queues.size() > Threads.size()+1) {
+    delete Queues.back();
+    Queues.pop_back();
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  pthread_mutex_lock(&StateLock);
+  ShuttingDown = true;
+  pthread_cond_broadcast(&WorkReady);
+  pthread_mutex_unlock(&StateLock);
+
+  for (unsigned i = 0; i < Threads.size(); ++i)
+    pthread_join(Threads[i], 0);
+  for (unsigned i = 0; i < Queues.size(); ++i)
+    delete Queues[i];
+
+  pthread_cond_destroy(&WorkDone);
+  pthread_cond_destroy(&WorkReady);
+  pthread_mutex_destroy(&StateLock);
+}
+
+unsigned ThreadPool::getDefaultNumThreads() {
+  long NumCPUs = sysconf(_SC_NPROCESSORS_ONLN);
+  return NumCPUs > 0 ? NumCPUs : 1;
+}
+
+void *ThreadPool::threadMain(void *Arg) {
+  ThreadStart *TS = (ThreadStart*)Arg;
+  ThreadPool *Pool = TS->Pool;
+  unsigned ThreadNo = TS->ThreadNo;
+  delete TS;
+
+  Pool->workerLoop(ThreadNo);
+  return 0;
+}
+
+// workerLoop - Wait for a job to be started, help with it, and go back to 
+// waiting, until the pool is destroyed.
+//
+void ThreadPool::workerLoop(unsigned ThreadNo) {
+  unsigned SeenGeneration = 0;
+  while (1) {
+    pthread_mutex_lock(&StateLock);
+    while (Generation == SeenGeneration && !ShuttingDown)
+      pthread_cond_wait(&WorkReady, &StateLock);
+    if (ShuttingDown) {
+      pthread_mutex_unlock(&StateLock);
+      return;
+    }
+    SeenGeneration = Generation;
+    pthread_mutex_unlock(&StateLock);
+
+    doWork(ThreadNo);
+
+    pthread_mutex_lock(&StateLock);
+    if (--NumBusy == 0)
+      pthread_cond_signal(&WorkDone);
+    pthread_mutex_unlock(&StateLock);
+  }
+}
+
+void ThreadPool::run(unsigned NumTasks, TaskFn Fn, void *Arg) {
+  if (NumTasks == 0) return;
+
+  // Give each thread an equal share of the tasks to start with...
+  unsigned NumThreads = Queues.size();
+  for (unsigned i = 0; i < NumThreads; ++i) {
+    Queues[i]->Begin = (unsigned)((unsigned long long)NumTasks*i/NumThreads);
+    Queues[i]->End = (unsigned)((unsigned long long)NumTasks*(i+1)/NumThreads);
+  }
+
+  if (NumThreads == 1) {          // Don't bother with the threads...
+    for (unsigned i = 0; i < NumTasks; ++i)
+      Fn(Arg, i);
+    return;
+  }
+
+  pthread_mutex_lock(&StateLock);
+  CurFn = Fn;
+  CurArg = Arg;
+  NumBusy = NumThreads-1;
+  ++Generation;
+  pthread_cond_broadcast(&WorkReady);
+  pthread_mutex_unlock(&StateLock);
+
+  doWork(0);                      // The calling thread works too
+
+  pthread_mutex_lock(&StateLock);
+  while (NumBusy)
+    pthread_cond_wait(&WorkDone, &StateLock);
+  pthread_mutex_unlock(&StateLock);
+}
+
+void ThreadPool::doWork(unsigned ThreadNo) {
+  unsigned TaskNo;
+  while (getTask(ThreadNo, TaskNo))
+    CurFn(CurArg, TaskNo);
+}
+
+// getTask - Take the next task from our own queue.  If it is empty, steal the 
+// upper half of the queue of another thread.  Returns false when there is no
+// work left anywhere.
+//
+bool ThreadPool::getTask(unsigned ThreadNo, unsigned &TaskNo) {
+  WorkQueue &Mine = *Queues[ThreadNo];
+  {
+    MutexLocker L(Mine.Lock);
+    if (Mine.Begin != Mine.End) {
+      TaskNo = Mine.Begin++;
+      return true;
+    }
+  }
+
+  unsigned NumThreads = Queues.size();
+  for (unsigned i = 1; i < NumThreads; ++i) {
+    WorkQueue &Victim = *Queues[(ThreadNo+i) % NumThreads];
+    unsigned Begin, End;
+    {
+      MutexLocker L(Victim.Lock);
+      if (Victim.Begin == Victim.End) continue;
+      Begin = Victim.Begin + (Victim.End-Victim.Begin)/2;
+      End = Victim.End;
+      Victim.End = Begin;
+    }
+
+    // Run the first stolen task, and queue the rest where others can steal
+    // them back...
+    TaskNo = Begin;
+    MutexLocker L(Mine.Lock);
+    assert(Mine.Begin == Mine.End && "Only the owner adds to its queue!");
+    Mine.Begin = Begin+1;
+    Mine.End = End;
+    return true;
+  }
+  return false;
+}
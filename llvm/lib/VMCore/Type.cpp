@@ -5,30 +5,321 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/DerivedTypes.h"
+#include "llvm/TypeContext.h"
 #include "llvm/Tools/StringExtras.h"
+#include "llvm/Tools/Mutex.h"
+#include "llvm/Opt/ConstantHandling.h"
+#include <hash_map>
+#include <algorithm>
+
+//===----------------------------------------------------------------------===//
+//                          Type Table Implementation
+//===----------------------------------------------------------------------===//
+
+// Each kind of derived type is kept in a TypeTable, which hashes the parts of
+// the type (the element types, and so on).  The table is split into shards by
+// the hash, each with its own lock, so threads creating or looking up
+// different types rarely wait for each other.  A shard is only allocated when
+// a type first hashes to it, so a context that holds few types stays small.
+//
+template<class TypeClass>
+class TypeTable {
+  enum { NumShards = 64 };
+
+  struct Shard {
+    Mutex Lock;
+    hash_map<unsigned, vector<const TypeClass*> > Types;  // Hash -> types
+  };
+  Shard *Shards[NumShards];
+
+  // getShard - Return the shard for the specified hash, allocating it if this
+  // is the first type to hash to it.
+  //
+  Shard &getShard(unsigned Hash) {
+    Shard *&S = Shards[Hash % NumShards];
+    if (S == 0) {
+      Shard *NewShard = new Shard();
+
+      // Another thread may have beaten us to it...
+      if (!__sync_bool_compare_and_swap(&S, 0, NewShard))
+        delete NewShard;
+    }
+    return *S;
+  }
+
+  TypeTable(const TypeTable &);                 // Do not implement
+  void operator=(const TypeTable &);            // Do not implement
+public:
+  TypeTable() {
+    for (unsigned i = 0; i < NumShards; ++i) Shards[i] = 0;
+  }
+  ~TypeTable() {
+    for (unsigned i = 0; i < NumShards; ++i) delete Shards[i];
+  }
+
+  // Probe - Lock the shard that holds types with the specified hash, for as 
+  // long as the Probe lives.  The caller looks through the candidates for the
+  // type that it wants, and inserts it if it is not there.
+  //
+  class Probe {
+    Shard &S;
+    MutexLocker L;
+    vector<const TypeClass*> &Bucket;
+  public:
+    Probe(TypeTable &TT, unsigned Hash) 
+      : S(TT.getShard(Hash)), L(S.Lock), Bucket(S.Types[Hash]) {}
+
+    inline const vector<const TypeClass*> &getCandidates() const {
+      return Bucket;
+    }
+    inline const TypeClass *insert(const TypeClass *T) {
+      Bucket.push_back(T);
+      return T;
+    }
+  };
+
+  // clear/add - Empty the table, and add a type to it without looking for it
+  // first.  These are used to rehash the table when UIDs change, and must not
+  // be used while other threads may be using the table.
+  //
+  void clear() {
+    for (unsigned i = 0; i < NumShards; ++i) {
+      delete Shards[i];
+      Shards[i] = 0;
+    }
+  }
+  void add(unsigned Hash, const TypeClass *T) {
+    getShard(Hash).Types[Hash].push_back(T);
+  }
+};
+
+// HashTypes - Combine a hash value with the hash of a list of types.
+//
+static inline unsigned HashType(unsigned Hash, const Type *Ty) {
+  return Hash*37 + Ty->getUniqueID();
+}
+static unsigned HashTypes(unsigned Hash, const vector<const Type*> &Types) {
+  for (unsigned i = 0; i < Types.size(); ++i)
+    Hash = HashType(Hash, Types[i]);
+  return Hash;
+}
+
+// The hash of each kind of derived type, computed from its parts...
+//
+static inline unsigned HashMethodType(const Type *Ret,
+                                      const vector<const Type*> &Params) {
+  return HashTypes(HashType(0, Ret), Params);
+}
+static inline unsigned HashArrayType(const Type *ElTy, int NumElements) {
+  return HashType(NumElements, ElTy);
+}
+static inline unsigned HashStructType(const vector<const Type*> &ETypes) {
+  return HashTypes(0, ETypes);
+}
+static inline unsigned HashPointerType(const Type *ValTy) {
+  return HashType(0, ValTy);
+}
+
+
+//===----------------------------------------------------------------------===//
+//                       TypeContext Implementation
+//===----------------------------------------------------------------------===//
+
+// Types may be created by several threads at once (the assembly parser works
+// on methods in parallel, and so does the PassManager), so UIDs are handed out
+// with an atomic increment.  The UID to type mapping is kept in fixed size
+// chunks that never move once they are allocated, so that it can be read
+// without a lock.  The directory of chunks starts out empty and doubles in
+// size as it fills up.  A directory that has been replaced is kept until the
+// context dies, because another thread may still be reading it.
+//
+static const unsigned UIDChunkSize = 1024;      // Types per chunk
+
+struct UIDDirectory {
+  unsigned NumChunks;
+  const Type ***Chunks;
+
+  UIDDirectory(unsigned N) : NumChunks(N), Chunks(new const Type**[N]) {
+    for (unsigned i = 0; i < N; ++i) Chunks[i] = 0;
+  }
+  ~UIDDirectory() { delete [] Chunks; }
+};
+
+struct TypeContextImpl {
+  unsigned CurUID;                              // Next UID to hand out
+  UIDDirectory *UIDs;                           // Null until the first type
+  vector<UIDDirectory*> OldUIDs;                // Replaced by a bigger one
+  Mutex UIDLock;                                // Held to change UIDs
+
+  TypeTable<MethodType>  MethodTypes;
+  TypeTable<ArrayType>   ArrayTypes;
+  TypeTable<StructType>  StructTypes;
+  TypeTable<PointerType> PointerTypes;
+
+  TypeContextImpl() : CurUID(Type::FirstDerivedTyID), UIDs(0) {}
+
+  ~TypeContextImpl() {
+    if (UIDs)
+      for (unsigned i = 0; i < UIDs->NumChunks; ++i)
+        delete [] UIDs->Chunks[i];
+    delete UIDs;
+    for (unsigned i = 0; i < OldUIDs.size(); ++i)
+      delete OldUIDs[i];
+  }
+
+  // lookupUID - Return the type with the specified UID, or null if it has not
+  // been entered in the UID table.
+  //
+  const Type *lookupUID(unsigned UID) const {
+    unsigned Chunk = UID / UIDChunkSize;
+    UIDDirectory *Dir = UIDs;
+    if (Dir == 0 || Chunk >= Dir->NumChunks || Dir->Chunks[Chunk] == 0)
+      return 0;
+    return Dir->Chunks[Chunk][UID % UIDChunkSize];
+  }
+
+  // getUIDSlot - Return the slot in the UID table that the type with the 
+  // specified UID lives in, allocating the chunk that holds it if need be.
+  //
+  const Type *&getUIDSlot(unsigned UID) {
+    unsigned Chunk = UID / UIDChunkSize;
+    UIDDirectory *Dir = UIDs;
+    if (Dir && Chunk < Dir->NumChunks && Dir->Chunks[Chunk])
+      return Dir->Chunks[Chunk][UID % UIDChunkSize];
+
+    MutexLocker L(UIDLock);
+    Dir = UIDs;
+    if (Dir == 0 || Chunk >= Dir->NumChunks) {
+      unsigned N = Dir ? Dir->NumChunks : 1;
+      while (N <= Chunk) N *= 2;
+
+      UIDDirectory *NewDir = new UIDDirectory(N);
+      if (Dir) {
+        for (unsigned i = 0; i < Dir->NumChunks; ++i)
+          NewDir->Chunks[i] = Dir->Chunks[i];
+        OldUIDs.push_back(Dir);
+      }
+      __sync_synchronize();                     // Fill it in before it is seen
+      UIDs = Dir = NewDir;
+    }
+
+    if (Dir->Chunks[Chunk] == 0) {
+      const Type **NewChunk = new const Type*[UIDChunkSize];
+      for (unsigned i = 0; i < UIDChunkSize; ++i) NewChunk[i] = 0;
+      __sync_synchronize();
+      Dir->Chunks[Chunk] = NewChunk;
+    }
+    return Dir->Chunks[Chunk][UID % UIDChunkSize];
+  }
+
+  // contains - Return true if T may be used to build types in this context:
+  // either it is primitive, or it was created in this context.
+  //
+  bool contains(const Type *T) const {
+    unsigned UID = T->getUniqueID();
+    return UID < Type::FirstDerivedTyID || 
+           (UID < CurUID && lookupUID(UID) == T);
+  }
+};
+
+static __thread TypeContext *CurrentContext = 0;  // Null means the global one
+
+TypeContext::TypeContext() : Impl(new TypeContextImpl()) {}
+
+// TypeContext dtor - Delete all of the types, then the UID table...
+//
+TypeContext::~TypeContext() {
+  assert(this != getGlobal() && "The global context lives forever!");
+  for (unsigned UID = Type::FirstDerivedTyID; UID < Impl->CurUID; ++UID)
+    delete Impl->lookupUID(UID);
+  delete Impl;
+}
+
+TypeContext *TypeContext::getGlobal() {
+  static TypeContext *Global = 0;
+  if (Global == 0) Global = new TypeContext();
+  return Global;
+}
+
+TypeContext *TypeContext::getCurrent() {
+  return CurrentContext ? CurrentContext : getGlobal();
+}
+
+TypeContext::Scope::Scope(TypeContext *Ctx) : Old(CurrentContext) {
+  CurrentContext = Ctx;
+}
+
+TypeContext::Scope::~Scope() {
+  CurrentContext = Old;
+}
+
+// Make sure that the global context exists before main, so that threads never
+// race to create it.
+//
+static TypeContext *TheGlobalContext = TypeContext::getGlobal();
+
 
 //===----------------------------------------------------------------------===//
 //                         Type Class Implementation
 //===----------------------------------------------------------------------===//
 
-static unsigned CurUID = 0;
-static vector<const Type *> UIDMappings;
+// Primitive types are shared by all contexts, and there is exactly one of each
+// of them, so each has a fixed UID below FirstDerivedTyID.  Derived types get
+// the next UID of the current context.
+//
+// PrimitiveUIDs - The UID of each primitive type, indexed by PrimitiveID.
+// These are the UIDs that the types got when UIDs were handed out in the order
+// that types were created ("type" first, as it is made first).  Constant pool
+// planes are kept in UID order, and the writers print them in that order, so
+// these must not change.
+//
+static const unsigned PrimitiveUIDs[Type::FirstDerivedTyID] = {
+   1,  2,                  // void, bool
+   4,  3,                  // ubyte, sbyte
+   6,  5,                  // ushort, short
+   8,  7,                  // uint, int
+  10,  9,                  // ulong, long
+  11, 12,                  // float, double
+   0,                      // type
+  13, 14,                  // label, lock
+  15,                      // filler
+};
+
+static const Type *PrimitiveTypes[Type::FirstDerivedTyID];  // Indexed by UID
 
 Type::Type(const string &name, PrimitiveID id) 
   : Value(Type::TypeTy, Value::TypeVal, name) {
   ID = id;
-  ConstRulesImpl = 0;
-
-  UID = CurUID++;       // Assign types UID's as they are created
-  UIDMappings.push_back(this);
+  ConstRulesImpl = ConstRules::find(this);  // Only looks at the PrimitiveID
+
+  if (id < FirstDerivedTyID) {
+    UID = PrimitiveUIDs[id];
+    assert(PrimitiveTypes[UID] == 0 && "Primitive type created twice!");
+    PrimitiveTypes[UID] = this;
+  } else {
+    TypeContextImpl *Ctx = TypeContext::getCurrent()->getImpl();
+    UID = __sync_fetch_and_add(&Ctx->CurUID, 1); // Assign types UID's as they
+    Ctx->getUIDSlot(UID) = this;                 // are created
+  }
 }
 
+// getUniqueIDType - Derived type UIDs are looked up in the current context.
+//
 const Type *Type::getUniqueIDType(unsigned UID) {
-  assert(UID < UIDMappings.size() && 
-         "Type::getPrimitiveType: UID out of range!");
-  return UIDMappings[UID];
+  if (UID < FirstDerivedTyID) return PrimitiveTypes[UID];
+
+  TypeContextImpl *Ctx = TypeContext::getCurrent()->getImpl();
+  assert(UID < Ctx->CurUID && "Type::getUniqueIDType: UID out of range!");
+  return Ctx->lookupUID(UID);
 }
 
+// TheFillerType - The type returned for FillerTyID.  There is only one, so 
+// that asking for it does not allocate a type (and a UID) every time.
+//
+static struct FillerType : public Type {
+  FillerType() : Type("XXX FILLER XXX", FillerTyID) {}
+} TheFillerType;
+
 const Type *Type::getPrimitiveType(PrimitiveID IDNumber) {
   switch (IDNumber) {
   case VoidTyID  : return VoidTy;
@@ -46,7 +337,7 @@ const Type *Type::getPrimitiveType(PrimitiveID IDNumber) {
   case TypeTyID  : return TypeTy;
   case LabelTyID : return LabelTy;
   case LockTyID  : return LockTy;
-  case FillerTyID: return new Type("XXX FILLER XXX", FillerTyID); // TODO:KILLME
+  case FillerTyID: return &TheFillerType;                   // TODO:KILLME
   default:
     return 0;
   }
@@ -113,17 +404,12 @@ const Type *Type::VoidTy   = new            Type("void"  , VoidTyID),
 //                      Derived Type Implementations
 //===----------------------------------------------------------------------===//
 
-// Make sure that only one instance of a particular type may be created on any
-// given run of the compiler...
-//
-// TODO: This list should be kept in sorted order so that we can do a binary
-// TODO: search instead of linear search!
-//
-// TODO: This should be templatized so that every derived type can use the same
-// TODO: code!
+// Make sure that only one instance of a particular type may be created in any
+// given context...  The tables are in TypeContextImpl, above.
 //
 #define TEST_MERGE_TYPES 0
 
+
 #if TEST_MERGE_TYPES
 #include "llvm/Assembly/Writer.h"
 #endif
@@ -156,35 +442,20 @@ PointerType::PointerType(const Type *E)
 
 const MethodType *MethodType::getMethodType(const Type *ReturnType, 
                                             const vector<const Type*> &Params) {
-  static vector<const MethodType*> ExistingMethodTypesCache;
-  for (unsigned i = 0; i < ExistingMethodTypesCache.size(); i++) {
-    const MethodType *T = ExistingMethodTypesCache[i];
-    if (T->getReturnType() == ReturnType) {
-      const ParamTypes &EParams = T->getParamTypes();
-      ParamTypes::const_iterator I = Params.begin(); 
-      ParamTypes::const_iterator J = EParams.begin(); 
-      for (; I != Params.end() && J != EParams.end(); I++, J++)
-        if (*I != *J) break;  // These types aren't equal!
-
-      if (I == Params.end() && J == EParams.end()) {
-#if TEST_MERGE_TYPES == 2
-        ostream_iterator<const Type*> out(cerr, ", ");
-        cerr << "Type: \"";
-        copy(Params.begin(), Params.end(), out);
-        cerr << "\"\nEquals: \"";
-        copy(EParams.begin(), EParams.end(), out);
-        cerr << "\"" << endl;
-#endif
-        return T;
-      }
-    }
-  }  
-#if TEST_MERGE_TYPES == 2
-  ostream_iterator<const Type*> out(cerr, ", ");
-  cerr << "Input Types: ";
-  copy(Params.begin(), Params.end(), out);
-  cerr << endl;
-#endif
+  TypeContextImpl *Ctx = TypeContext::getCurrent()->getImpl();
+  assert(Ctx->contains(ReturnType) && "Return type is from another context!");
+  for (unsigned i = 0; i < Params.size(); ++i)
+    assert(Ctx->contains(Params[i]) && "Param type is from another context!");
+
+  TypeTable<MethodType>::Probe P(Ctx->MethodTypes, 
+                                 HashMethodType(ReturnType, Params));
+
+  const vector<const MethodType*> &Candidates = P.getCandidates();
+  for (unsigned i = 0; i < Candidates.size(); i++) {
+    const MethodType *T = Candidates[i];
+    if (T->getReturnType() == ReturnType && T->getParamTypes() == Params)
+      return T;
+  }
 
   // Calculate the string name for the new type...
   string Name = ReturnType->getName() + " (";
@@ -200,19 +471,22 @@ const MethodType *MethodType::getMethodType(const Type *ReturnType,
   cerr << "Derived new type: " << Name << endl;
 #endif
 
-  MethodType *Result = new MethodType(ReturnType, Params, Name);
-  ExistingMethodTypesCache.push_back(Result);
-  return Result;
+  return P.insert(new MethodType(ReturnType, Params, Name));
 }
 
 
 const ArrayType *ArrayType::getArrayType(const Type *ElementType, 
 					 int NumElements = -1) {
-  static vector<const ArrayType*> ExistingTypesCache;
+  TypeContextImpl *Ctx = TypeContext::getCurrent()->getImpl();
+  assert(Ctx->contains(ElementType) && "Element type is from another context!");
+
+  TypeTable<ArrayType>::Probe P(Ctx->ArrayTypes, 
+                                HashArrayType(ElementType, NumElements));
 
   // Search cache for value...
-  for (unsigned i = 0; i < ExistingTypesCache.size(); i++) {
-    const ArrayType *T = ExistingTypesCache[i];
+  const vector<const ArrayType*> &Candidates = P.getCandidates();
+  for (unsigned i = 0; i < Candidates.size(); i++) {
+    const ArrayType *T = Candidates[i];
 
     if (T->getElementType() == ElementType && 
 	T->getNumElements() == NumElements)
@@ -225,8 +499,8 @@ const ArrayType *ArrayType::getArrayType(const Type *ElementType,
 
   Name += ElementType->getName();
   
-  ArrayType *Result = new ArrayType(ElementType, NumElements, Name + "]");
-  ExistingTypesCache.push_back(Result);
+  const ArrayType *Result = 
+    P.insert(new ArrayType(ElementType, NumElements, Name + "]"));
 
 #if TEST_MERGE_TYPES
   cerr << "Derived new type: " << Result->getName() << endl;
@@ -235,37 +509,19 @@ const ArrayType *ArrayType::getArrayType(const Type *ElementType,
 }
 
 const StructType *StructType::getStructType(const ElementTypes &ETypes) {
-  static vector<const StructType*> ExistingStructTypesCache;
-
-  for (unsigned i = 0; i < ExistingStructTypesCache.size(); i++) {
-    const StructType *T = ExistingStructTypesCache[i];
-
-    const ElementTypes &Elements = T->getElementTypes();
-    ElementTypes::const_iterator I = ETypes.begin(); 
-    ElementTypes::const_iterator J = Elements.begin(); 
-    for (; I != ETypes.end() && J != Elements.end(); I++, J++)
-      if (*I != *J) break;  // These types aren't equal!
-    
-    if (I == ETypes.end() && J == Elements.end()) {
-#if TEST_MERGE_TYPES == 2
-      ostream_iterator<const Type*> out(cerr, ", ");
-      cerr << "Type: \"";
-      copy(ETypes.begin(), ETypes.end(), out);
-      cerr << "\"\nEquals: \"";
-      copy(Elements.begin(), Elements.end(), out);
-      cerr << "\"" << endl;
-#endif
+  TypeContextImpl *Ctx = TypeContext::getCurrent()->getImpl();
+  for (unsigned i = 0; i < ETypes.size(); ++i)
+    assert(Ctx->contains(ETypes[i]) && "Element type is from another context!");
+
+  TypeTable<StructType>::Probe P(Ctx->StructTypes, HashStructType(ETypes));
+
+  const vector<const StructType*> &Candidates = P.getCandidates();
+  for (unsigned i = 0; i < Candidates.size(); i++) {
+    const StructType *T = Candidates[i];
+    if (T->getElementTypes() == ETypes)
       return T;
-    }
   }
 
-#if TEST_MERGE_TYPES == 2
-  ostream_iterator<const Type*> out(cerr, ", ");
-  cerr << "Input Types: ";
-  copy(ETypes.begin(), ETypes.end(), out);
-  cerr << endl;
-#endif
-
   // Calculate the string name for the new type...
   string Name = "{ ";
   for (ElementTypes::const_iterator I = ETypes.begin();  
@@ -280,25 +536,27 @@ const StructType *StructType::getStructType(const ElementTypes &ETypes) {
   cerr << "Derived new type: " << Name << endl;
 #endif
 
-  StructType *Result = new StructType(ETypes, Name);
-  ExistingStructTypesCache.push_back(Result);
-  return Result;
+  return P.insert(new StructType(ETypes, Name));
 }
 
 
 const PointerType *PointerType::getPointerType(const Type *ValueType) {
-  static vector<const PointerType*> ExistingTypesCache;
+  TypeContextImpl *Ctx = TypeContext::getCurrent()->getImpl();
+  assert(Ctx->contains(ValueType) && "Value type is from another context!");
+
+  TypeTable<PointerType>::Probe P(Ctx->PointerTypes, 
+                                  HashPointerType(ValueType));
 
   // Search cache for value...
-  for (unsigned i = 0; i < ExistingTypesCache.size(); i++) {
-    const PointerType *T = ExistingTypesCache[i];
+  const vector<const PointerType*> &Candidates = P.getCandidates();
+  for (unsigned i = 0; i < Candidates.size(); i++) {
+    const PointerType *T = Candidates[i];
 
     if (T->getValueType() == ValueType)
       return T;
   }
 
-  PointerType *Result = new PointerType(ValueType);
-  ExistingTypesCache.push_back(Result);
+  const PointerType *Result = P.insert(new PointerType(ValueType));
 
 #if TEST_MERGE_TYPES
   cerr << "Derived new type: " << Result->getName() << endl;
@@ -306,3 +564,128 @@ const PointerType *PointerType::getPointerType(const Type *ValueType) {
   return Result;
 }
 
+
+//===----------------------------------------------------------------------===//
+//                             Type Renumbering
+//===----------------------------------------------------------------------===//
+
+unsigned TypeContext::getNextUID() const {
+  return Impl->CurUID;
+}
+
+// getComponentTypes - Add the types that T is made of to Parts.
+//
+static void getComponentTypes(const Type *T, vector<const Type*> &Parts) {
+  switch (T->getPrimitiveID()) {
+  case Type::MethodTyID: {
+    const MethodType *MT = (const MethodType*)T;
+    Parts.push_back(MT->getReturnType());
+    Parts.insert(Parts.end(), MT->getParamTypes().begin(),
+                 MT->getParamTypes().end());
+    break;
+  }
+  case Type::ArrayTyID:
+    Parts.push_back(((const ArrayType*)T)->getElementType());
+    break;
+  case Type::StructTyID: {
+    const StructType *ST = (const StructType*)T;
+    Parts.insert(Parts.end(), ST->getElementTypes().begin(),
+                 ST->getElementTypes().end());
+    break;
+  }
+  case Type::PointerTyID:
+    Parts.push_back(((const PointerType*)T)->getValueType());
+    break;
+  default:
+    break;
+  }
+}
+
+// NumberType - Give T the next new UID, after the types that it is made of.
+// NewUIDs is indexed by old UID - FirstUID, and is zero for the types that
+// have not been numbered yet.
+//
+static void NumberType(const Type *T, unsigned FirstUID, 
+                       vector<unsigned> &NewUIDs, unsigned &NextUID) {
+  unsigned UID = T->getUniqueID();
+  if (UID < FirstUID || NewUIDs[UID-FirstUID]) return;  // Old or done
+
+  vector<const Type*> Parts;
+  getComponentTypes(T, Parts);
+  for (unsigned i = 0; i < Parts.size(); ++i)
+    NumberType(Parts[i], FirstUID, NewUIDs, NextUID);
+  NewUIDs[UID-FirstUID] = NextUID++;
+}
+
+struct TypeNameLess {
+  inline bool operator()(const Type *T1, const Type *T2) const {
+    return T1->getName() < T2->getName();
+  }
+};
+
+void TypeContext::renumberTypes(unsigned FirstUID) {
+  unsigned EndUID = Impl->CurUID;
+  assert(FirstUID >= Type::FirstDerivedTyID && FirstUID <= EndUID &&
+         "Not a UID returned by getNextUID!");
+  if (FirstUID == EndUID) return;
+
+  // The name of a derived type is spelled out from its parts, so no two types
+  // in a context have the same name, and the names give a canonical order.
+  //
+  vector<const Type*> Types;
+  for (unsigned UID = FirstUID; UID < EndUID; ++UID)
+    Types.push_back(Impl->lookupUID(UID));
+  sort(Types.begin(), Types.end(), TypeNameLess());
+
+  vector<unsigned> NewUIDs(EndUID-FirstUID, 0);
+  unsigned NextUID = FirstUID;
+  for (unsigned i = 0; i < Types.size(); ++i) {
+    assert((i == 0 || Types[i-1]->getName() != Types[i]->getName()) &&
+           "Two types have the same name!");
+    NumberType(Types[i], FirstUID, NewUIDs, NextUID);
+  }
+  assert(NextUID == EndUID && "Some type was not numbered!");
+
+  for (unsigned i = 0; i < Types.size(); ++i) {
+    Type *T = (Type*)Types[i];
+    T->UID = NewUIDs[T->UID-FirstUID];
+    Impl->getUIDSlot(T->UID) = T;
+  }
+
+  // The hashes of the types are computed from the UIDs of their parts, so the
+  // type tables have to be rebuilt...
+  //
+  Impl->MethodTypes.clear();
+  Impl->ArrayTypes.clear();
+  Impl->StructTypes.clear();
+  Impl->PointerTypes.clear();
+  for (unsigned UID = Type::FirstDerivedTyID; UID < EndUID; ++UID) {
+    const Type *T = Impl->lookupUID(UID);
+    switch (T->getPrimitiveID()) {
+    case Type::MethodTyID: {
+      const MethodType *MT = (const MethodType*)T;
+      Impl->MethodTypes.add(HashMethodType(MT->getReturnType(),
+                                           MT->getParamTypes()), MT);
+      break;
+    }
+    case Type::ArrayTyID: {
+      const ArrayType *AT = (const ArrayType*)T;
+      Impl->ArrayTypes.add(HashArrayType(AT->getElementType(),
+                                         AT->getNumElements()), AT);
+      break;
+    }
+    case Type::StructTyID: {
+      const StructType *ST = (const StructType*)T;
+      Impl->StructTypes.add(HashStructType(ST->getElementTypes()), ST);
+      break;
+    }
+    case Type::PointerTyID: {
+      const PointerType *PT = (const PointerType*)T;
+      Impl->PointerTypes.add(HashPointerType(PT->getValueType()), PT);
+      break;
+    }
+    default:
+      assert(0 && "Unknown kind of derived type!");
+    }
+  }
+}
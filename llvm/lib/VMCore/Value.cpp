@@ -11,28 +11,50 @@
 #include "llvm/ConstantPool.h"
 #include "llvm/ConstPoolVals.h"
 #include "llvm/Type.h"
+#include "llvm/Tools/Mutex.h"
 #ifndef NDEBUG      // Only in -g mode...
 #include "llvm/Assembly/Writer.h"
 #endif
 #include <algorithm>
+#include <set>
 
 //===----------------------------------------------------------------------===//
 //                                Value Class
 //===----------------------------------------------------------------------===//
 
-Value::Value(const Type *ty, ValueTy vty, const string &name = "") : Name(name){
+const string Value::EmptyName;
+
+Value::Value(const Type *ty, ValueTy vty, const string &name = "") {
+  Name = name.empty() ? 0 : new string(name);
   Ty = ty;
   VTy = vty;
+  SubclassData = 0;
 }
 
 Value::~Value() {
+  // When a whole module is deleted, the users of a value may be deleted after
+  // it, without unlinking themselves (see InBulkTeardown).
+  //
 #ifndef NDEBUG      // Only in -g mode...
-  if (Uses.begin() != Uses.end()) {
+  if (Uses.begin() != Uses.end() && !InBulkTeardown) {
     for (use_const_iterator I = Uses.begin(); I != Uses.end(); I++)
       cerr << "Use still stuck around after Def is destroyed:" << *I << endl;
   }
 #endif
-  assert(Uses.begin() == Uses.end());
+  assert((Uses.begin() == Uses.end() || InBulkTeardown) &&
+         "Value still used when it was deleted!");
+  delete Name;
+}
+
+void Value::setName(const string &name) {
+  if (name.empty()) {
+    delete Name;
+    Name = 0;
+  } else if (Name) {
+    *Name = name;
+  } else {
+    Name = new string(name);
+  }
 }
 
 void Value::replaceAllUsesWith(Value *D) {
@@ -52,12 +74,33 @@ void Value::replaceAllUsesWith(Value *D) {
   }
 }
 
+bool Value::LockUseLists = false;
+__thread bool Value::InBulkTeardown = false;
+
+// Use lists are protected by a small set of locks, picked by the address of 
+// the value.
+//
+static Mutex UseListLocks[32];
+
+static inline Mutex &getUseListLock(const Value *V) {
+  return UseListLocks[((unsigned long)V >> 4) & 31];
+}
+
+void Value::lockedAddUse(User *I) {
+  MutexLocker L(getUseListLock(this));
+  Uses.push_back(I);
+}
+
 void Value::killUse(User *i) {
   if (i == 0) return;
-  use_iterator I = find(Uses.begin(), Uses.end(), i);
+  Mutex *Lock = LockUseLists ? &getUseListLock(this) : 0;
+  if (Lock) Lock->acquire();
 
+  use_iterator I = find(Uses.begin(), Uses.end(), i);
   assert(I != Uses.end() && "Use not in uses list!!");
   Uses.erase(I);
+
+  if (Lock) Lock->release();
 }
 
 User *Value::use_remove(use_iterator &I) {
@@ -74,6 +117,8 @@ User *Value::use_remove(use_iterator &I) {
 
 User::User(const Type *Ty, ValueTy vty, const string &name) 
   : Value(Ty, vty, name) {
+  Operands = 0;
+  NumOperands = 0;
 }
 
 // replaceUsesOfWith - Replaces all references to the "From" definition with
@@ -92,6 +137,47 @@ void User::replaceUsesOfWith(Value *From, Value *To) {
   }
 }
 
+unsigned User::replaceUsesOfWith(const map<const Value*, Value*> &ValueMap) {
+  map<const Value*, Value*>::const_iterator I;
+  unsigned NumFound = 0;
+
+  if (getValueType() == Value::InstructionVal) {
+    // Instructions keep their operands in an array, so walk it directly...
+    Instruction *Inst = (Instruction*)this;
+    for (Instruction::op_iterator OI = Inst->op_begin(); 
+         OI != Inst->op_end(); ++OI)
+      if ((I = ValueMap.find(*OI)) != ValueMap.end()) {
+        if (I->second != *OI) *OI = I->second;
+        ++NumFound;
+      }
+  } else {
+    for (unsigned OpNum = 0; Value *D = getOperand(OpNum); OpNum++)
+      if ((I = ValueMap.find(D)) != ValueMap.end()) {
+        if (I->second != D) setOperand(OpNum, I->second);
+        ++NumFound;
+      }
+  }
+  return NumFound;
+}
+
+void User::replaceAllUses(const map<const Value*, Value*> &ValueMap) {
+  // Find the users of all of the old values, each one once, in the order that
+  // they are first seen (not in address order, which changes from run to run)
+  vector<User*> Users;
+  set<User*> Seen;
+  map<const Value*, Value*>::const_iterator I;
+  for (I = ValueMap.begin(); I != ValueMap.end(); ++I)
+    if (I->first != I->second)
+      for (Value::use_const_iterator UI = I->first->use_begin();
+           UI != I->first->use_end(); ++UI)
+        if (Seen.insert(*UI).second)
+          Users.push_back(*UI);
+
+  // Then fix up each of them in one pass over its operands...
+  for (unsigned i = 0; i < Users.size(); ++i)
+    Users[i]->replaceUsesOfWith(ValueMap);
+}
+
 
 //===----------------------------------------------------------------------===//
 //                             SymTabValue Class
@@ -109,7 +195,6 @@ SymTabValue::SymTabValue(const Type *Ty, ValueTy dty, const string &name = "")
 
 
 SymTabValue::~SymTabValue() {
-  ConstPool.dropAllReferences();
   ConstPool.delete_all();
   ConstPool.setParent(0);
 
@@ -15,7 +15,9 @@
 
 template<class ValueSubclass, class ItemParentType>
 void ValueHolder<ValueSubclass,ItemParentType>::setParent(SymTabValue *P) { 
-  if (Parent) {     // Remove all of the items from the old symbol table..
+  // Remove all of the items from the old symbol table, unless it is dying
+  // along with everything in it...
+  if (Parent && !Value::InBulkTeardown) {
     SymbolTable *SymTab = Parent->getSymbolTable();
     for (iterator I = begin(); I != end(); I++)
       if ((*I)->hasName()) SymTab->remove(*I);
@@ -53,7 +55,7 @@ ValueSubclass *ValueHolder<ValueSubclass,ItemParentType>::remove(iterator &DI) {
   i->setParent(0);  // I don't own you anymore... byebye...
   
   // You don't get to be in the symbol table anymore... byebye
-  if (i->hasName() && Parent)
+  if (i->hasName() && Parent && !Value::InBulkTeardown)
     Parent->getSymbolTable()->remove(i);
   
   return i;
@@ -82,4 +84,16 @@ void ValueHolder<ValueSubclass,ItemParentType>::push_back(ValueSubclass *Inst) {
     Parent->getSymbolTableSure()->insert(Inst);
 }
 
+template<class ValueSubclass, class ItemParentType>
+void ValueHolder<ValueSubclass,ItemParentType>::insert(iterator &Pos,
+                                                       ValueSubclass *Inst) {
+  assert(Inst->getParent() == 0 && "Value already has parent!");
+  Inst->setParent(ItemParent);
+
+  Pos = ValueList.insert(Pos, Inst);
+
+  if (Inst->hasName() && Parent)
+    Parent->getSymbolTableSure()->insert(Inst);
+}
+
 #endif
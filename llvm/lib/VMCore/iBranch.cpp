@@ -13,8 +13,7 @@
 #endif
 
 BranchInst::BranchInst(BasicBlock *True, BasicBlock *False, Value *Cond) 
-  : TerminatorInst(Instruction::Br), TrueDest(True, this), 
-    FalseDest(False, this), Condition(Cond, this) {
+  : TerminatorInst(Instruction::Br) {
   assert(True != 0 && "True branch destination may not be null!!!");
 
 #ifndef NDEBUG
@@ -23,47 +22,51 @@ BranchInst::BranchInst(BasicBlock *True, BasicBlock *False, Value *Cond)
 #endif
   assert((Cond == 0 || Cond->getType() == Type::BoolTy) && 
          "May only branch on boolean predicates!!!!");
-}
 
-BranchInst::BranchInst(const BranchInst &BI) 
-  : TerminatorInst(Instruction::Br), TrueDest(BI.TrueDest, this), 
-    FalseDest(BI.FalseDest, this), Condition(BI.Condition, this) {
+  Ops[0].init(True, this);
+  Ops[1].init(False, this);
+  Ops[2].init(Cond, this);
+  Operands = Ops; NumOperands = isUnconditional() ? 1 : 3;
 }
 
-
-void BranchInst::dropAllReferences() {
-  Condition = 0;
-  TrueDest = FalseDest = 0;
+BranchInst::BranchInst(const BranchInst &BI) 
+  : TerminatorInst(Instruction::Br) {
+  Ops[0].init(BI.Ops[0], this);
+  Ops[1].init(BI.Ops[1], this);
+  Ops[2].init(BI.Ops[2], this);
+  Operands = Ops; NumOperands = BI.NumOperands;
 }
 
-const Value *BranchInst::getOperand(unsigned i) const {
-    return (i == 0) ? (Value*)TrueDest : 
-          ((i == 1) ? (Value*)FalseDest : 
-          ((i == 2) ? (Value*)Condition : 0));
+const BasicBlock *BranchInst::getSuccessor(unsigned i) const {
+  return (i < getNumSuccessors()) ? (const BasicBlock*)(const Value*)Ops[i] : 0;
 }
 
-const BasicBlock *BranchInst::getSuccessor(unsigned i) const {
-  return (i == 0) ? (const BasicBlock*)TrueDest : 
-        ((i == 1) ? (const BasicBlock*)FalseDest : 0);
+void BranchInst::setSuccessor(unsigned i, BasicBlock *B) {
+  assert(i < getNumSuccessors() && B && "Successor # out of range!");
+  Ops[i] = B;
 }
 
+// setOperand - The false destination and the condition may be set on an
+// unconditional branch, which becomes conditional when both are set.
+//
 bool BranchInst::setOperand(unsigned i, Value *Val) { 
   switch (i) {
   case 0:
     assert(Val && "Can't change primary direction to 0!");
     assert(Val->getType() == Type::LabelTy);
-    TrueDest = (BasicBlock*)Val;
-    return true;
+    break;
   case 1:
     assert(Val == 0 || Val->getType() == Type::LabelTy);
-    FalseDest = (BasicBlock*)Val;
-    return true;
+    break;
   case 2:
-    Condition = Val;
-    assert(!Condition || Condition->getType() == Type::BoolTy && 
+    assert(!Val || Val->getType() == Type::BoolTy && 
            "Condition expr must be a boolean expression!");
-    return true;
+    break;
+  default:
+    return false;
   } 
 
-  return false;
+  Ops[i] = Val;
+  NumOperands = isUnconditional() ? 1 : 3;
+  return true;
 }
@@ -8,9 +8,9 @@
 #include "llvm/DerivedTypes.h"
 #include "llvm/Method.h"
 
-CallInst::CallInst(Method *m, vector<Value*> &params, 
+CallInst::CallInst(Method *M, vector<Value*> &params, 
                    const string &Name) 
-  : Instruction(m->getReturnType(), Instruction::Call, Name), M(m, this) {
+  : Instruction(M->getReturnType(), Instruction::Call, Name) {
 
   const MethodType* MT = M->getMethodType();
   const MethodType::ParamTypes &PL = MT->getParamTypes();
@@ -18,31 +18,30 @@ CallInst::CallInst(Method *m, vector<Value*> &params,
 #ifndef NDEBUG
   MethodType::ParamTypes::const_iterator It = PL.begin();
 #endif
+  Ops.reserve(params.size()+1);
+  Ops.push_back(Use(M, this));
   for (unsigned i = 0; i < params.size(); i++) {
     assert(*It++ == params[i]->getType());
-    Params.push_back(Use(params[i], this));
+    Ops.push_back(Use(params[i], this));
   }
+  Operands = &Ops[0]; NumOperands = Ops.size();
 }
 
 CallInst::CallInst(const CallInst &CI) 
-  : Instruction(CI.getType(), Instruction::Call), M(CI.M, this) {
-  for (unsigned i = 0; i < CI.Params.size(); i++)
-    Params.push_back(Use(CI.Params[i], this));
-}
-
-void CallInst::dropAllReferences() { 
-  M = 0;
-  Params.clear(); 
+  : Instruction(CI.getType(), Instruction::Call) {
+  Ops.reserve(CI.Ops.size());
+  for (unsigned i = 0; i < CI.Ops.size(); i++)
+    Ops.push_back(Use(CI.Ops[i], this));
+  Operands = &Ops[0]; NumOperands = Ops.size();
 }
 
 bool CallInst::setOperand(unsigned i, Value *Val) {
-  if (i > Params.size()) return false;
+  if (i >= NumOperands) return false;
   if (i == 0) {
     assert(Val->getValueType() == Value::MethodVal);
-    M = (Method*)Val;
   } else {
     // TODO: assert = method arg type
-    Params[i-1] = Val;
   }
+  Ops[i] = Val;
   return true;
 }
@@ -5,8 +5,37 @@
 //===----------------------------------------------------------------------===//
 
 #include "llvm/iBinary.h"
+#include "llvm/iUnary.h"
 #include "llvm/Type.h"
 
+//===----------------------------------------------------------------------===//
+//                           GenericUnaryInst Class
+//===----------------------------------------------------------------------===//
+
+GenericUnaryInst::GenericUnaryInst(UnaryOps Opcode, Value *S, 
+                                   const string &Name)
+  : UnaryOperator(S, Opcode, Name) {
+  if (const Type *Ty = getCastType(Opcode))
+    setType(Ty);           // A cast produces the type that it converts to
+}
+
+const Type *GenericUnaryInst::getCastType(unsigned Opcode) {
+  switch (Opcode) {
+  case ToBoolTy:   return Type::BoolTy;
+  case ToUByteTy:  return Type::UByteTy;
+  case ToSByteTy:  return Type::SByteTy;
+  case ToUShortTy: return Type::UShortTy;
+  case ToShortTy:  return Type::ShortTy;
+  case ToUInt:     return Type::UIntTy;
+  case ToInt:      return Type::IntTy;
+  case ToULongTy:  return Type::ULongTy;
+  case ToLongTy:   return Type::LongTy;
+  case ToFloatTy:  return Type::FloatTy;
+  case ToDoubleTy: return Type::DoubleTy;
+  default:         return 0;   // Not a cast, or to a derived type
+  }
+}
+
 //===----------------------------------------------------------------------===//
 //                             SetCondInst Class
 //===----------------------------------------------------------------------===//
@@ -15,23 +44,9 @@ SetCondInst::SetCondInst(BinaryOps opType, Value *S1, Value *S2,
                          const string &Name) 
   : BinaryOperator(opType, S1, S2, Name) {
 
-  OpType = opType;
   setType(Type::BoolTy);   // setcc instructions always return bool type.
 
   // Make sure it's a valid type...
-  assert(getOpcode() != "Invalid opcode type to SetCondInst class!");
-}
-
-string SetCondInst::getOpcode() const {
-  switch (OpType) {
-  case SetLE:  return "setle";
-  case SetGE:  return "setge";
-  case SetLT:  return "setlt";
-  case SetGT:  return "setgt";
-  case SetEQ:  return "seteq";
-  case SetNE:  return "setne";
-  default:
-    assert(0 && "Invalid opcode type to SetCondInst class!");
-    return "invalid opcode type to SetCondInst";
-  }
+  assert(opType >= SetEQ && opType <= SetGT &&
+         "Invalid opcode type to SetCondInst class!");
 }
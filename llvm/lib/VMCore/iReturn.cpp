@@ -7,19 +7,20 @@
 #include "llvm/iTerminators.h"
 
 ReturnInst::ReturnInst(Value *V)
-  : TerminatorInst(Instruction::Ret), Val(V, this) {
+  : TerminatorInst(Instruction::Ret) {
+  Ops[0].init(V, this);
+  Operands = Ops; NumOperands = V != 0;
 }
 
 ReturnInst::ReturnInst(const ReturnInst &RI)
-  : TerminatorInst(Instruction::Ret), Val(RI.Val, this) {
-}
-
-void ReturnInst::dropAllReferences() {
-  Val = 0;
+  : TerminatorInst(Instruction::Ret) {
+  Ops[0].init(RI.Ops[0], this);
+  Operands = Ops; NumOperands = RI.NumOperands;
 }
 
 bool ReturnInst::setOperand(unsigned i, Value *V) { 
   if (i) return false; 
-  Val = V;
+  Ops[0] = V;
+  NumOperands = V != 0;
   return true;
 }
@@ -11,71 +11,45 @@
 #endif
 
 SwitchInst::SwitchInst(Value *V, BasicBlock *DefV) 
-  : TerminatorInst(Instruction::Switch), 
-    DefaultDest(DefV, this), Val(V, this) {
-  assert(Val && DefV);
+  : TerminatorInst(Instruction::Switch) {
+  assert(V && DefV);
+  Ops.push_back(Use(V, this));
+  Ops.push_back(Use(DefV, this));
+  Operands = &Ops[0]; NumOperands = Ops.size();
 }
 
 SwitchInst::SwitchInst(const SwitchInst &SI) 
-  : TerminatorInst(Instruction::Switch), DefaultDest(SI.DefaultDest), 
-    Val(SI.Val) {
-
-  for (dest_const_iterator I = SI.Destinations.begin(), 
-	                 end = SI.Destinations.end(); I != end; ++I)
-    Destinations.push_back(dest_value(ConstPoolUse(I->first, this), 
-				      BasicBlockUse(I->second, this)));
+  : TerminatorInst(Instruction::Switch) {
+  Ops.reserve(SI.Ops.size());
+  for (unsigned i = 0; i < SI.Ops.size(); ++i)
+    Ops.push_back(Use(SI.Ops[i], this));
+  Operands = &Ops[0]; NumOperands = Ops.size();
 }
 
 
 void SwitchInst::dest_push_back(ConstPoolVal *OnVal, BasicBlock *Dest) {
-  Destinations.push_back(dest_value(ConstPoolUse(OnVal, this), 
-                                    BasicBlockUse(Dest, this)));
-}
-
-void SwitchInst::dropAllReferences() {
-  Val = 0;
-  DefaultDest = 0;
-  Destinations.clear();
+  Ops.push_back(Use(OnVal, this));
+  Ops.push_back(Use(Dest, this));
+  Operands = &Ops[0]; NumOperands = Ops.size();  // Ops may have moved
 }
 
 const BasicBlock *SwitchInst::getSuccessor(unsigned idx) const {
-  if (idx == 0) return DefaultDest;
-  if (idx > Destinations.size()) return 0;
-  return Destinations[idx-1].second;
+  if (idx >= getNumSuccessors()) return 0;
+  return (const BasicBlock*)(const Value*)Ops[idx*2+1];
 }
 
-unsigned SwitchInst::getNumOperands() const {
-  return 2+Destinations.size();
-}
-
-const Value *SwitchInst::getOperand(unsigned i) const {
-  if (i == 0) return Val;
-  else if (i == 1) return DefaultDest;
-
-  unsigned slot = (i-2) >> 1;
-  if (slot >= Destinations.size()) return 0;
-  
-  if (i & 1) return Destinations[slot].second;
-  return Destinations[slot].first;
+void SwitchInst::setSuccessor(unsigned idx, BasicBlock *B) {
+  assert(idx < getNumSuccessors() && B && "Successor # out of range!");
+  Ops[idx*2+1] = B;
 }
 
 bool SwitchInst::setOperand(unsigned i, Value *V) {
-  if (i == 0) { Val = V; return true; }
-  else if (i == 1) { 
-    assert(V->getType() == Type::LabelTy); 
-    DefaultDest = (BasicBlock*)V;
-    return true; 
-  }
-
-  unsigned slot = (i-2) >> 1;
-  if (slot >= Destinations.size()) return 0;
-
+  if (i >= NumOperands) return false;
   if (i & 1) {
     assert(V->getType() == Type::LabelTy);
-    Destinations[slot].second = (BasicBlock*)V;
-  } else {
+  } else if (i) {
     // TODO: assert constant
-    Destinations[slot].first = (ConstPoolVal*)V;
   }
+  Ops[i] = V;
   return true;
 }
@@ -0,0 +1,46 @@
+; Redundant computations for -gvn to remove.  The comments say which
+; instructions should be replaced by an earlier one.
+
+implementation
+
+int "same block"(int %a, int %b)
+begin
+	%x = add int %a, %b
+	%y = add int %b, %a           ; Same as %x, add is commutative
+	%z = sub int %a, %b
+	%w = sub int %b, %a           ; Not the same, sub is not commutative
+	%s = add int %x, %y
+	%t = add int %z, %w
+	%u = add int %s, %t
+	ret int %u
+end
+
+bool "dominating block"(int %a, int %b, bool %c)
+begin
+	%x = setlt int %a, %b
+	br bool %c, label %Then, label %Else
+Then:
+	%y = setlt int %a, %b         ; Same as %x, which dominates it
+	ret bool %y
+Else:
+	ret bool %x
+end
+
+int "sibling blocks"(int %a, int %b, bool %c)
+begin
+	br bool %c, label %Then, label %Else
+Then:
+	%x = mul int %a, %b
+	ret int %x
+Else:
+	%y = mul int %a, %b           ; Not the same, %x does not dominate it
+	ret int %y
+end
+
+int "constants"(int %a)
+begin
+	%x = add int %a, 4
+	%y = add int %a, 4            ; Same as %x, the constants are equal
+	%z = add int %x, %y
+	ret int %z
+end
@@ -0,0 +1,63 @@
+; Each method triggers one group of the -instcombine rules.  The comments say
+; what the return value should simplify to.
+
+implementation
+
+int "commute constant"(int %a)
+begin
+	%x = add int 1, %a            ; Becomes add int %a, 1
+	%y = mul int 7, %x            ; Becomes mul int %x, 7
+	ret int %y
+end
+
+int "identity operand"(int %a)
+begin
+	%b = add int %a, 0
+	%c = sub int %b, 0
+	%d = mul int %c, 1
+	%e = or int %d, 0
+	%f = xor int %e, 0
+	%g = and int %f, %f
+	%h = or int %g, %g
+	ret int %h                    ; Should be %a
+end
+
+int "zero operand"(int %a)
+begin
+	%b = mul int %a, 0
+	%c = and int %a, 0
+	%d = add int %b, %c
+	ret int %d                    ; Should be 0
+end
+
+int "same operands"(int %a, int %b)
+begin
+	%c = sub int %a, %a
+	%d = xor int %b, %b
+	%e = or int %c, %d
+	ret int %e                    ; Should be 0
+end
+
+int "double negation"(int %a)
+begin
+	%b = neg int %a
+	%c = neg int %b
+	%d = not int %c
+	%e = not int %d
+	ret int %e                    ; Should be %a
+end
+
+bool "not setcc"(int %a, int %b)
+begin
+	%c = setlt int %a, %b
+	%d = not bool %c              ; Becomes setge int %a, %b
+	ret bool %d
+end
+
+bool "not setcc with other uses"(int %a, int %b)
+begin
+	%c = seteq int %a, %b
+	%d = not bool %c              ; Left alone, %c is used below
+	%e = and bool %c, %d
+	ret bool %e
+end
@@ -8,11 +8,32 @@
 //  opt [options] -constprop - Run a constant propogation pass on input 
 //                             bytecodes
 //  opt [options] -inline    - Run a method inlining pass on input bytecodes
+//  opt [options] -simplifycfg - Remove empty blocks and fold trivial branches
+//  opt [options] -mem2reg   - Promote allocas that are only loaded from and
+//                             stored to into SSA registers
+//  opt [options] -instcombine - Simplify operators with algebraic identities
+//  opt [options] -gvn       - Remove redundant arithmetic with value numbering
+//  opt [options] -licm      - Hoist loop invariant code out of loops
+//  opt [options] -tailrecelim - Turn self recursive tail calls into loops
+//  opt [options] -deadmethods - Delete methods that can not be reached from
+//                             the roots of the module
+//  opt [options] -deadargs  - Remove method arguments that are never used
+//  opt [options] -ipconstprop - Propagate constant arguments into the methods
+//                             that are called with them
 //  opt [options] -strip     - Strip symbol tables out of methods
 //  opt [options] -mstrip    - Strip module & method symbol tables
 //
 // Optimizations may be specified an arbitrary number of times on the command
-// line, they are run in the order specified.
+// line, they are run in the order specified.  The optimizations are run by a
+// PassManager, which runs each method through all of them in turn.
+//
+//  opt [options] -j N ...   - Run method level optimizations on N threads.  The
+//                             default is the number of processors.  The output
+//                             does not depend on N.
+//
+//  opt [options] -root M ... - Treat method M as an entry point of the module,
+//                             which may be called from outside of it.  This may
+//                             be given more than once.  The default is main.
 //
 // TODO: Add a -all option to keep applying all optimizations until the program
 //       stops permuting.
@@ -28,21 +49,49 @@
 #include "llvm/Bytecode/Writer.h"
 #include "llvm/Tools/CommandLine.h"
 #include "llvm/Opt/AllOpts.h"
+#include "llvm/Pass.h"
+#include "llvm/Tools/ThreadPool.h"
+#include <stdlib.h>
+
+template<class PassClass>
+static Pass *New() { return new PassClass(); }
+
+// RootMethods - The methods named with -root, which the interprocedural passes
+// must keep, with the same signature.
+//
+static vector<string> RootMethods;
+
+template<class PassClass>
+static Pass *NewWithRoots() { return new PassClass(RootMethods); }
 
 struct {
   const string ArgName, Name;
-  bool (*OptPtr)(Module *C);
+  Pass *(*CreatePass)();
 } OptTable[] = {
-  { "-dce",      "Dead Code Elimination", DoDeadCodeElimination },
-  { "-constprop","Constant Propogation",  DoConstantPropogation }, 
-  { "-inline"   ,"Method Inlining",       DoMethodInlining      },
-  { "-strip"    ,"Strip Symbols",         DoSymbolStripping     },
-  { "-mstrip"   ,"Strip Module Symbols",  DoFullSymbolStripping },
+  { "-dce",      "Dead Code Elimination", New<DeadCodeElimination> },
+  { "-constprop","Constant Propogation",  New<ConstantPropogation> }, 
+  { "-inline"   ,"Method Inlining",       New<MethodInlining>      },
+  { "-simplifycfg","CFG Simplification",  New<CFGSimplification>   },
+  { "-mem2reg"  ,"Promote Memory to Register", New<PromoteMemoryToRegister> },
+  { "-instcombine","Instruction Combining", New<InstructionCombining> },
+  { "-gvn"      ,"Global Value Numbering", New<GlobalValueNumbering> },
+  { "-licm"     ,"Loop Invariant Code Motion", New<LoopInvariantCodeMotion> },
+  { "-tailrecelim","Tail Recursion Elimination",
+                 New<TailRecursionElimination> },
+  { "-deadmethods","Dead Method Elimination",
+                 NewWithRoots<DeadMethodElimination> },
+  { "-deadargs" ,"Dead Argument Elimination",
+                 NewWithRoots<DeadArgumentElimination> },
+  { "-ipconstprop","Interprocedural Constant Propagation",
+                 NewWithRoots<IPConstantPropagation> },
+  { "-strip"    ,"Strip Symbols",         New<SymbolStripping>     },
+  { "-mstrip"   ,"Strip Module Symbols",  New<FullSymbolStripping> },
 };
 
 int main(int argc, char **argv) {
   ToolCommandLine Opts(argc, argv, false);
   bool Quiet = false;
+  unsigned NumThreads = ThreadPool::getDefaultNumThreads();
 
   for (int i = 1; i < argc; i++) {
     if (string(argv[i]) == string("--help")) {
@@ -51,8 +100,17 @@ int main(int argc, char **argv) {
       return 1;
     } else if (string(argv[i]) == string("-q")) {
       Quiet = true; argv[i] = 0;
+    } else if (string(argv[i]) == string("-j") && i+1 < argc) {
+      NumThreads = atoi(argv[i+1]);
+      argv[i] = argv[i+1] = 0;
+      ++i;
+    } else if (string(argv[i]) == string("-root") && i+1 < argc) {
+      RootMethods.push_back(argv[i+1]);
+      argv[i] = argv[i+1] = 0;
+      ++i;
     }
   }
+  if (RootMethods.empty()) RootMethods.push_back("main");
   
   ostream *Out = &cout;  // Default to printing to stdout...
 
@@ -63,13 +121,17 @@ int main(int argc, char **argv) {
   }
 
 
+  PassManager Passes;
+  Passes.setNumThreads(NumThreads);
+  vector<unsigned> PassOpts;   // OptTable index of each pass in Passes
+
   for (int i = 1; i < argc; i++) {
     if (argv[i] == 0) continue;
     unsigned j;
     for (j = 0; j < sizeof(OptTable)/sizeof(OptTable[0]); j++) {
       if (string(argv[i]) == OptTable[j].ArgName) {
-        if (OptTable[j].OptPtr(C) && !Quiet)
-          cerr << OptTable[j].Name << " pass made modifications!\n";
+        Passes.add(OptTable[j].CreatePass());
+        PassOpts.push_back(j);
         break;
       }
     }
@@ -78,6 +140,13 @@ int main(int argc, char **argv) {
       cerr << "'" << argv[i] << "' argument unrecognized: ignored\n";
   }
 
+  Passes.run(C);
+
+  if (!Quiet)
+    for (unsigned i = 0; i < PassOpts.size(); ++i)
+      if (Passes.passChanged(i))
+        cerr << OptTable[PassOpts[i]].Name << " pass made modifications!\n";
+
   if (Opts.getOutputFilename() != "-") {
     Out = new ofstream(Opts.getOutputFilename().c_str(), 
                        (Opts.getForce() ? 0 : ios::noreplace)|ios::out);